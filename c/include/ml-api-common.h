@@ -146,6 +146,21 @@ typedef enum _ml_tensor_type_e
   ML_TENSOR_TYPE_UNKNOWN         /**< Unknown type */
 } ml_tensor_type_e;
 
+/**
+ * @brief Flags of the policy to allocate the buffers of tensors data.
+ * @details The flags may be combined with bitwise-or. The largest alignment is applied if several alignments are given.
+ * @since_tizen 8.0
+ */
+typedef enum
+{
+  ML_TENSORS_ALLOC_DEFAULT = 0,                 /**< Zero-filled buffers with the alignment of the system allocator. For the tensors information, the default policy set by ml_tensors_data_set_default_alloc_policy() is applied. */
+  ML_TENSORS_ALLOC_ALIGN_CACHE_LINE = (1 << 0), /**< Buffers aligned to the cache line (64 bytes). */
+  ML_TENSORS_ALLOC_ALIGN_PAGE = (1 << 1),       /**< Buffers aligned to the memory page. */
+  ML_TENSORS_ALLOC_HUGE_PAGE = (1 << 2),        /**< Buffers of the tensors larger than 2 MiB are aligned to 2 MiB and backed by transparent huge pages if the system supports it. */
+  ML_TENSORS_ALLOC_NO_ZERO_FILL = (1 << 3),     /**< Buffers are not filled with zero. The application should write the data before reading it. */
+  ML_TENSORS_ALLOC_CONTIGUOUS = (1 << 4)        /**< All the tensors of the data are in a single buffer, and the offset of each tensor is aligned to the alignment of the policy (at least to the cache line). See ml_tensors_data_get_contiguous_buffer(). */
+} ml_tensors_alloc_policy_e;
+
 /**
  * @brief The function to be called when destroying the data in machine learning API.
  * @since_tizen 7.0
@@ -348,6 +363,43 @@ int ml_tensors_info_get_tensor_dimension (ml_tensors_info_h info, unsigned int i
  */
 int ml_tensors_info_get_tensor_size (ml_tensors_info_h info, int index, size_t *data_size);
 
+/**
+ * @brief Sets the affine quantization parameters of the tensor with given handle of tensors information.
+ * @details The real value of a quantized element is (quantized - zero_point) * scale.
+ *          If @a num_channels is 1, the parameters are applied to all elements of the tensor (per-tensor).
+ *          Otherwise, @a num_channels should be the size of the dimension at @a axis, and each channel has its own parameters (per-channel).
+ * @since_tizen 8.0
+ * @param[in] info The handle of tensors information.
+ * @param[in] index The index of the tensor to be updated.
+ * @param[in] axis The index of the dimension of the channels. It is ignored for the per-tensor parameters.
+ * @param[in] num_channels The number of the scales and zero points.
+ * @param[in] scales The scales, which should be positive. NULL to clear the quantization parameters.
+ * @param[in] zero_points The zero points. NULL if all zero points are 0.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_info_set_tensor_quantization (ml_tensors_info_h info, unsigned int index, unsigned int axis, unsigned int num_channels, const float *scales, const int32_t *zero_points);
+
+/**
+ * @brief Gets the affine quantization parameters of the tensor with given handle of tensors information.
+ * @since_tizen 8.0
+ * @remarks If the function succeeds, @a scales and @a zero_points should be released using g_free(). If the tensor is not quantized, @a num_channels is 0 and @a scales and @a zero_points are NULL.
+ * @param[in] info The handle of tensors information.
+ * @param[in] index The index of the tensor.
+ * @param[out] axis The index of the dimension of the channels.
+ * @param[out] num_channels The number of the scales and zero points.
+ * @param[out] scales The scales.
+ * @param[out] zero_points The zero points.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_info_get_tensor_quantization (ml_tensors_info_h info, unsigned int index, unsigned int *axis, unsigned int *num_channels, float **scales, int32_t **zero_points);
+
 /**
  * @brief Creates a tensor data frame with the given tensors information.
  * @since_tizen 5.5
@@ -362,6 +414,188 @@ int ml_tensors_info_get_tensor_size (ml_tensors_info_h info, int index, size_t *
  */
 int ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h *data);
 
+/**
+ * @brief Sets the policy to allocate the buffers of tensors data, which is applied if the tensors information does not have its own policy.
+ * @details See #ml_tensors_alloc_policy_e for the flags. The policy is applied to the tensors data created after calling this, in all the threads.
+ * @since_tizen 8.0
+ * @param[in] policy The bitwise-or of #ml_tensors_alloc_policy_e flags. #ML_TENSORS_ALLOC_DEFAULT to allocate zero-filled buffers of the system allocator.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_data_set_default_alloc_policy (unsigned int policy);
+
+/**
+ * @brief Sets the policy to allocate the buffers of tensors data created with the given tensors information.
+ * @details See #ml_tensors_alloc_policy_e for the flags. The policy is copied with the tensors information by ml_tensors_info_clone().
+ * @since_tizen 8.0
+ * @param[in] info The handle of tensors information.
+ * @param[in] policy The bitwise-or of #ml_tensors_alloc_policy_e flags. #ML_TENSORS_ALLOC_DEFAULT to follow the policy set by ml_tensors_data_set_default_alloc_policy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_info_set_alloc_policy (ml_tensors_info_h info, unsigned int policy);
+
+/**
+ * @brief Gets the policy to allocate the buffers of tensors data created with the given tensors information.
+ * @since_tizen 8.0
+ * @param[in] info The handle of tensors information.
+ * @param[out] policy The bitwise-or of #ml_tensors_alloc_policy_e flags. #ML_TENSORS_ALLOC_DEFAULT if the information follows the default policy.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_info_get_alloc_policy (ml_tensors_info_h info, unsigned int *policy);
+
+/**
+ * @brief Gets the single buffer of all the tensors in the given data, which is created with #ML_TENSORS_ALLOC_CONTIGUOUS.
+ * @details The tensors are placed in the buffer in order. Use ml_tensors_data_get_tensor_data() to get the location of each tensor in the buffer.
+ * @since_tizen 8.0
+ * @param[in] data The handle of tensors data.
+ * @param[out] raw_data The single buffer of all the tensors. Do not free the buffer, it is released with @a data.
+ * @param[out] data_size The byte size of the buffer, including the padding for the alignment of the tensors.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the data is not created with the contiguous layout.
+ */
+int ml_tensors_data_get_contiguous_buffer (ml_tensors_data_h data, void **raw_data, size_t *data_size);
+
+/**
+ * @brief Sets the tensors information to be used only in the calling thread, which skips the locks to access it.
+ * @details The tensors data created with the single-owner information in the owner thread is also the single-owner handle of the thread.
+ *          Set @a single_owner false in the owner thread to share the information with the other threads again.
+ * @since_tizen 8.0
+ * @remarks The handle is not thread-safe while it is the single-owner handle. Accessing it in other threads is undefined, or aborts if the library is built with the thread-confined check.
+ *          Bind the handle after the other threads have finished accessing it, because the calls in progress in the other threads are not waited for.
+ * @param[in] info The handle of tensors information.
+ * @param[in] single_owner True to bind the handle to the calling thread, false to release it.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the handle is owned by another thread.
+ */
+int ml_tensors_info_set_single_owner (ml_tensors_info_h info, bool single_owner);
+
+/**
+ * @brief Sets the tensors data to be used only in the calling thread, which skips the locks to access it.
+ * @details Set @a single_owner false in the owner thread before passing the data to the other threads.
+ * @since_tizen 8.0
+ * @remarks The handle is not thread-safe while it is the single-owner handle. Accessing it in other threads is undefined, or aborts if the library is built with the thread-confined check.
+ *          Bind the handle after the other threads have finished accessing it, because the calls in progress in the other threads are not waited for.
+ * @param[in] data The handle of tensors data.
+ * @param[in] single_owner True to bind the handle to the calling thread, false to release it.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the handle is owned by another thread.
+ */
+int ml_tensors_data_set_single_owner (ml_tensors_data_h data, bool single_owner);
+
+/**
+ * @brief Converts the elements of the tensors data to the types of the destination.
+ * @details Each element of the tensors in @a src is converted to the type of the corresponding tensor in @a dest.
+ *          The values out of the range of the destination type are saturated, and the floating-point values are rounded to the nearest integer (ties to even) if the destination type is an integer type.
+ *          The common conversions (e.g., uint8 or float16 to float32) are accelerated with the SIMD instructions of the CPU if available.
+ * @since_tizen 8.0
+ * @param[in] src The handle of tensors data to be converted.
+ * @param[out] dest The handle of tensors data to store the converted elements. It should be created with the types to convert to, and should have the same number of tensors and elements as @a src. It may be same as @a src.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the number of tensors or elements is different.
+ */
+int ml_tensors_data_convert (const ml_tensors_data_h src, ml_tensors_data_h dest);
+
+/**
+ * @brief Normalizes the elements of the tensors data, and stores them with the types of the destination.
+ * @details Each element of the tensors in @a dest is (@a src * @a scale + @a offset), converted as ml_tensors_data_convert() does.
+ *          For example, to feed uint8 images to a float32 model with the input in [-1, 1], set 1/127.5 to @a scale and -1 to @a offset.
+ * @since_tizen 8.0
+ * @param[in] src The handle of tensors data to be normalized.
+ * @param[out] dest The handle of tensors data to store the normalized elements. It should be created with the types to convert to, and should have the same number of tensors and elements as @a src. It may be same as @a src.
+ * @param[in] scale The factor to multiply each element by.
+ * @param[in] offset The value to add to each element after the scaling.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the number of tensors or elements is different.
+ */
+int ml_tensors_data_normalize (const ml_tensors_data_h src, ml_tensors_data_h dest, float scale, float offset);
+
+/**
+ * @brief Quantizes the elements of the tensors data with the quantization parameters of the destination.
+ * @details Each element of the tensors in @a src is quantized to round (@a src / scale) + zero_point, rounding the halfway quotient to even, and saturated to the type of @a dest.
+ *          The parameters are set by ml_tensors_info_set_tensor_quantization() to the tensors information of @a dest, or of @a src if the tensor of @a dest does not have them.
+ *          The tensor without the quantization parameters is converted as ml_tensors_data_convert() does.
+ *          The common quantization (float32 to int8 or uint8) is accelerated with the SIMD instructions of the CPU if available, and the large tensors are quantized with multiple threads.
+ * @since_tizen 8.0
+ * @param[in] src The handle of tensors data to be quantized.
+ * @param[out] dest The handle of tensors data to store the quantized elements. It should have the same number of tensors and elements as @a src.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, the number of tensors or elements is different, or the quantization parameters do not match the dimension.
+ */
+int ml_tensors_data_quantize (const ml_tensors_data_h src, ml_tensors_data_h dest);
+
+/**
+ * @brief Dequantizes the elements of the tensors data with the quantization parameters of the source.
+ * @details Each element of the tensors in @a src is dequantized to (@a src - zero_point) * scale, and stored with the type of @a dest.
+ *          The parameters are set by ml_tensors_info_set_tensor_quantization() to the tensors information of @a src, or of @a dest if the tensor of @a src does not have them (e.g., the output of ml_single_invoke()).
+ *          The tensor without the quantization parameters is converted as ml_tensors_data_convert() does.
+ *          The common dequantization (int8 or uint8 to float32) is accelerated with the SIMD instructions of the CPU if available, and the large tensors are dequantized with multiple threads.
+ * @since_tizen 8.0
+ * @param[in] src The handle of tensors data to be dequantized.
+ * @param[out] dest The handle of tensors data to store the dequantized elements. It should have the same number of tensors and elements as @a src.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, the number of tensors or elements is different, or the quantization parameters do not match the dimension.
+ */
+int ml_tensors_data_dequantize (const ml_tensors_data_h src, ml_tensors_data_h dest);
+
+/**
+ * @brief Permutes the axes of a tensor of the tensors data, e.g., to change the layout from NHWC to NCHW.
+ * @details The axis @a i of the tensor in @a dest is the axis @a axes[i] of the tensor in @a src, and the axes from @a rank are kept.
+ *          The axes are counted from the innermost one, as ml_tensor_dimension. For example, NHWC (dimension C:W:H:N) to NCHW (dimension W:H:C:N) is {1, 2, 0, 3}, and NCHW to NHWC is {2, 0, 1, 3}.
+ *          The elements are copied in the tiles fitting in the cache, and the 3-channel uint8 images are (de)interleaved with the SIMD instructions of the CPU if available.
+ * @since_tizen 8.0
+ * @param[in] src The handle of tensors data to be permuted.
+ * @param[out] dest The handle of tensors data to store the permuted tensor. The tensor at @a index should have the same type as @a src, and the permuted dimension. It should not be same as @a src.
+ * @param[in] index The index of the tensor to be permuted.
+ * @param[in] axes The axes of @a src, for each axis of @a dest. It should be a permutation from 0 to (@a rank - 1).
+ * @param[in] rank The number of the axes to be permuted, up to #ML_TENSOR_RANK_LIMIT.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the type or dimension of @a dest does not match.
+ */
+int ml_tensors_data_permute (const ml_tensors_data_h src, ml_tensors_data_h dest, unsigned int index, const unsigned int *axes, unsigned int rank);
+
+/**
+ * @brief Permutes the axes and reorders the channels of a tensor of the tensors data, e.g., to change the layout from NHWC to NCHW and RGB to BGR at once.
+ * @details The axes are permuted as ml_tensors_data_permute() does. Along the channel axis, the channel @a c of @a dest is the channel @a channel_order[c] of @a src.
+ *          For example, RGB to BGR is {2, 1, 0} at the channel axis 0 of the NHWC image.
+ * @since_tizen 8.0
+ * @param[in] src The handle of tensors data to be permuted.
+ * @param[out] dest The handle of tensors data to store the permuted tensor. The tensor at @a index should have the same type as @a src, and the permuted dimension. It should not be same as @a src.
+ * @param[in] index The index of the tensor to be permuted.
+ * @param[in] axes The axes of @a src, for each axis of @a dest. It should be a permutation from 0 to (@a rank - 1).
+ * @param[in] rank The number of the axes to be permuted, up to #ML_TENSOR_RANK_LIMIT.
+ * @param[in] channel_axis The channel axis of @a src. It should be smaller than @a rank.
+ * @param[in] channel_order The channels of @a src, for each channel of @a dest. It should be a permutation of the channels.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the type or dimension of @a dest does not match.
+ */
+int ml_tensors_data_permute_with_channel_order (const ml_tensors_data_h src, ml_tensors_data_h dest, unsigned int index, const unsigned int *axes, unsigned int rank, unsigned int channel_axis, const unsigned int *channel_order);
+
 /**
  * @brief Frees the given tensors' data handle.
  * @details Note that the opened handle should be closed before calling this function in the case of a single API.
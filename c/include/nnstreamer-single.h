@@ -33,6 +33,59 @@ extern "C" {
  */
 typedef void *ml_single_h;
 
+/**
+ * @brief A handle of a pool of single-shot instances.
+ * @since_tizen 8.0
+ */
+typedef void *ml_single_pool_h;
+
+/**
+ * @brief A handle of the series of the models, where the output of a model is the input of the next model.
+ * @since_tizen 8.0
+ */
+typedef void *ml_single_series_h;
+
+/**
+ * @brief A handle of the ensemble of the models, which are invoked at the same time with the same input.
+ * @since_tizen 8.0
+ */
+typedef void *ml_single_ensemble_h;
+
+/**
+ * @brief Enumeration for the methods to reduce the outputs of the models in the ensemble into a single output.
+ * @since_tizen 8.0
+ */
+typedef enum {
+  ML_SINGLE_ENSEMBLE_REDUCE_AVERAGE = 0, /**< The element-wise mean of the outputs. The value is rounded to the nearest integer for the integer types. */
+  ML_SINGLE_ENSEMBLE_REDUCE_VOTE = 1     /**< Each model votes for the element of its maximum value in each innermost row of the tensor (e.g., the class of the highest score for each batch), and the output has the number of votes for each element, saturated at the maximum of the output type. */
+} ml_single_ensemble_reduce_e;
+
+/**
+ * @brief Callback for the result of ml_single_invoke_async().
+ * @details If @a status is #ML_ERROR_NONE, @a output is the result of the inference and the application owns it.
+ *          The application should release @a output with ml_tensors_data_destroy().
+ *          Otherwise, @a output is NULL and @a status is the error of the inference.
+ * @since_tizen 8.0
+ * @remarks The callback is called in the internal thread of the handle. Do not call ml_single_close() in the callback.
+ *          The synchronous invoke of the same handle (e.g., ml_single_invoke()) in the callback returns #ML_ERROR_INVALID_PARAMETER, because the thread cannot wait for itself.
+ *          Call ml_single_invoke_async() instead, but not with the property 'queue-policy' 'block' if the request queue may be full.
+ * @param[in] status The result of the inference. #ML_ERROR_STREAMS_PIPE if the handle is closed before processing the request.
+ * @param[in] output The output data of the inference, or NULL if an error occurs.
+ * @param[in] user_data User application's private data.
+ */
+typedef void (*ml_single_invoke_cb) (int status, ml_tensors_data_h output, void *user_data);
+
+/**
+ * @brief Callback for the result of loading the model opened by ml_single_open_async().
+ * @details If @a status is not #ML_ERROR_NONE, the handle cannot be used and the application should close it with ml_single_close().
+ * @since_tizen 8.0
+ * @remarks The callback is called in the internal thread loading the model. Do not call ml_single_close() in the callback.
+ * @param[in] single The model handle returned by ml_single_open_async().
+ * @param[in] status The result of loading the model.
+ * @param[in] user_data User application's private data.
+ */
+typedef void (*ml_single_open_cb) (ml_single_h single, int status, void *user_data);
+
 /*************
  * MAIN FUNC *
  *************/
@@ -100,6 +153,56 @@ int ml_single_open (ml_single_h *single, const char *model, const ml_tensors_inf
  */
 int ml_single_open_full (ml_single_h *single, const char *model, const ml_tensors_info_h input_info, const ml_tensors_info_h output_info, ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, const char *custom_option);
 
+/**
+ * @brief Opens an ML model in the memory and returns the instance as a handle.
+ * @details The model is written to an anonymous file in the memory (memfd, or an unlinked temporary file if memfd is not available),
+ *          and the neural network framework loads the model from it. The model is not written to the filesystem.
+ *          The application may free @a data after this function returns.
+ * @since_tizen 8.0
+ * @param[out] single This is the model handle opened. Users are required to close
+ *                   the given instance with ml_single_close().
+ * @param[in] data The neural network model in the memory.
+ * @param[in] size The size of @a data in bytes.
+ * @param[in] input_info This is required if the given model has flexible input dimension. You may set NULL if it's not required.
+ * @param[in] output_info This is required if the given model has flexible output dimension. You may set NULL if it's not required.
+ * @param[in] nnfw The neural network framework used to open the given model.
+ *                 #ML_NNFW_TYPE_ANY is not allowed because the model has no file extension to detect the framework.
+ * @param[in] hw Tell the corresponding @a nnfw to use a specific hardware.
+ *               Set #ML_NNFW_HW_ANY if it does not matter.
+ * @param[in] custom_option Comma separated list of options (see ml_single_open_full()). You may set NULL if it's not required.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or the platform does not provide procfs to load the model (Linux only).
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to start the pipeline.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_open_from_buffer (ml_single_h *single, const void *data, size_t size, const ml_tensors_info_h input_info, const ml_tensors_info_h output_info, ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, const char *custom_option);
+
+/**
+ * @brief Opens an ML model in the file descriptor (e.g., memfd) and returns the instance as a handle.
+ * @details The handle duplicates @a fd and the neural network framework loads the model from the beginning of the file.
+ *          The application may close @a fd after this function returns.
+ * @since_tizen 8.0
+ * @param[out] single This is the model handle opened. Users are required to close
+ *                   the given instance with ml_single_close().
+ * @param[in] fd The file descriptor of the neural network model.
+ * @param[in] input_info This is required if the given model has flexible input dimension. You may set NULL if it's not required.
+ * @param[in] output_info This is required if the given model has flexible output dimension. You may set NULL if it's not required.
+ * @param[in] nnfw The neural network framework used to open the given model.
+ *                 #ML_NNFW_TYPE_ANY is not allowed because the model has no file extension to detect the framework.
+ * @param[in] hw Tell the corresponding @a nnfw to use a specific hardware.
+ *               Set #ML_NNFW_HW_ANY if it does not matter.
+ * @param[in] custom_option Comma separated list of options (see ml_single_open_full()). You may set NULL if it's not required.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or the platform does not provide procfs to load the model (Linux only).
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to start the pipeline.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_open_from_fd (ml_single_h *single, int fd, const ml_tensors_info_h input_info, const ml_tensors_info_h output_info, ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, const char *custom_option);
+
 /**
  * @brief Closes the opened model handle.
  * @details Note that this should be called before destroying the inference data by ml_tensors_data_destroy().
@@ -154,10 +257,114 @@ int ml_single_invoke (ml_single_h single, const ml_tensors_data_h input, ml_tens
  */
 int ml_single_invoke_fast (ml_single_h single, const ml_tensors_data_h input, ml_tensors_data_h output);
 
+/**
+ * @brief Requests to invoke the model with the given input data, and returns without waiting for the result.
+ * @details The requests are processed in order by the internal thread of the handle, and the result is passed to @a cb.
+ *          If the request queue is full, this follows the property 'queue-policy' (see ml_single_set_property()).
+ *          The input data is copied in the API, so the application may release @a input after calling this.
+ *          If the property 'borrow-input' is 'true', the input data is not copied and the application should keep @a input until @a cb is called.
+ *          The callbacks of the requests not processed yet are called with #ML_ERROR_STREAMS_PIPE when closing the handle.
+ *          Note that the timeout set with ml_single_set_timeout() is not applied to the asynchronous request.
+ *          Note that @a cb is called in the internal thread of the handle, so the synchronous invoke of the same handle in @a cb fails (see #ml_single_invoke_cb).
+ * @since_tizen 8.0
+ * @param[in] single The model handle to be inferred.
+ * @param[in] input The input data to be inferred.
+ * @param[in] cb The callback to get the result of the inference.
+ * @param[in] user_data Private data for the callback.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE The handle is being closed.
+ * @retval #ML_ERROR_TRY_AGAIN The request queue is full and the property 'queue-policy' is 'fail'.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_invoke_async (ml_single_h single, const ml_tensors_data_h input, ml_single_invoke_cb cb, void *user_data);
+
+/**
+ * @brief Requests to invoke the model with the given input data and deadline, and returns the id to cancel the request.
+ * @details This is same as ml_single_invoke_async(), except the deadline and the id of the request.
+ *          If the deadline passes while the request is waiting in the queue, the model is not invoked with the input.
+ *          If the deadline passes while the model is running, the output is dropped.
+ *          In both cases, @a cb is called with #ML_ERROR_TIMED_OUT.
+ *          The request can be cancelled with ml_single_cancel() until @a cb is called.
+ * @since_tizen 8.0
+ * @param[in] single The model handle to be inferred.
+ * @param[in] input The input data to be inferred.
+ * @param[in] cb The callback to get the result of the inference.
+ * @param[in] user_data Private data for the callback.
+ * @param[in] timeout The time in milliseconds to get the result after requesting, 0 if there is no deadline.
+ * @param[out] request_id The id of the request to be cancelled. Set NULL if the request is not cancelled.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE The handle is being closed.
+ * @retval #ML_ERROR_TRY_AGAIN The request queue is full and the property 'queue-policy' is 'fail'.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_invoke_async_full (ml_single_h single, const ml_tensors_data_h input, ml_single_invoke_cb cb, void *user_data, unsigned int timeout, unsigned int *request_id);
+
+/**
+ * @brief Cancels the request of ml_single_invoke_async_full().
+ * @details If the request is waiting in the queue, the request is removed and its callback is called with #ML_ERROR_TRY_AGAIN before this returns.
+ *          If the model is running with the request, the model cannot be stopped. The output is dropped, and the callback is called with #ML_ERROR_TRY_AGAIN when the model returns.
+ * @since_tizen 8.0
+ * @param[in] single The model handle.
+ * @param[in] request_id The id of the request given by ml_single_invoke_async_full().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid, or the request is already completed or cancelled.
+ */
+int ml_single_cancel (ml_single_h single, unsigned int request_id);
+
+/**
+ * @brief Invokes the model with the array of the input data, and waits for all the outputs.
+ * @details This validates the handle and the inputs once, and invokes the model with the inputs in order without the hand-off for each input.
+ *          If there is no timeout, the inputs are not copied. Otherwise, the inputs are copied while the model runs with the previous input.
+ *          The timeout set with ml_single_set_timeout() is applied to each input.
+ *          If the property 'queue-policy' is not 'block', this still waits for the room of the request queue.
+ *          If an error occurs, all the outputs are released and set NULL.
+ * @since_tizen 8.0
+ * @param[in] single The model handle to be inferred.
+ * @param[in] inputs The array of the input data to be inferred.
+ * @param[out] outputs The array to store the output data for each input. The caller is responsible for freeing each output with ml_tensors_data_destroy().
+ * @param[in] n The number of the input data. It should be positive.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to invoke the model, or the handle is being closed.
+ * @retval #ML_ERROR_TIMED_OUT Failed to get the result of an input in the timeout.
+ * @retval #ML_ERROR_TRY_AGAIN The model is still being loaded (see ml_single_open_async()).
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_invoke_batch (ml_single_h single, const ml_tensors_data_h *inputs, ml_tensors_data_h *outputs, unsigned int n);
+
+/**
+ * @brief Invokes the model @a n times with synthetic input data to warm up the neural network framework.
+ * @details The first invocations after opening the model are usually slow because the framework allocates the memory and selects the kernels lazily.
+ *          The input data is filled with zero and has the size of the input tensors of the model.
+ *          The invocations to warm up are not counted in the latency statistics of the handle (see the property 'latency-stats' in ml_single_set_property()).
+ * @since_tizen 8.0
+ * @param[in] single The model handle to be warmed up.
+ * @param[in] n The number of the invocations. It should be positive.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to invoke the model.
+ * @retval #ML_ERROR_TRY_AGAIN The model is still being loaded (see ml_single_open_async()).
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_warmup (ml_single_h single, unsigned int n);
+
 /**
  * @brief Invokes the model with the given input data with the given tensors information.
  * @details This function changes the input tensors information for the model, and returns the corresponding output data.
  *          A model/framework may not support changing the information.
+ *          If the model is already configured with the given information, this does not configure the model again.
  *          Note that this will wait for the result until the invoke process is done. If an application wants to change the time to wait for an output, set the timeout using ml_single_set_timeout().
  * @since_tizen 6.0
  * @param[in] single The model handle to be inferred.
@@ -236,6 +443,23 @@ int ml_single_set_timeout (ml_single_h single, unsigned int timeout);
 /**
  * @brief Sets the property value for the given model.
  * @details Note that a model/framework may not support changing the property after opening the model.
+ *          The property 'borrow-input' (boolean, 'true' or 'false') is handled by the single-shot instance itself.
+ *          If it is 'true', ml_single_invoke() and ml_single_invoke_fast() pass the input data to the framework without copying it,
+ *          and the caller should not free or modify the input data until the invoke returns.
+ *          The input data is still copied if the timeout is set with ml_single_set_timeout() or the request waits in the queue of a busy handle, because the framework may access it after the invoke has returned.
+ *          When the handle is busy, the requests wait in a bounded queue and are processed in order.
+ *          The property 'queue-size' (positive integer, default 16) limits the number of the requests in the queue,
+ *          and the property 'queue-policy' decides what to do when the queue is full:
+ *          'block' (default) waits for the room, 'fail' returns #ML_ERROR_TRY_AGAIN, and 'drop-oldest' completes the oldest request with #ML_ERROR_TRY_AGAIN.
+ *          The read-only properties 'queue-depth', 'queue-wait-time', 'queue-max-wait-time' (in microseconds) and 'queue-dropped' give the statistics of the queue.
+ *          The output data allocated by ml_single_invoke() returns its memory to the handle when destroyed, and the next invoke reuses it.
+ *          The property 'output-pool-size' (non-negative integer, default 4) limits the number of the output buffers kept, and '0' disables reusing.
+ *          The read-only properties 'output-pool-available' and 'output-pool-high-water' give the number of the buffers kept and the max number of the outputs in use at once.
+ *          The read-only property 'latency-stats' gives the latency (in microseconds) from the invoke request to the output, including the wait in the queue,
+ *          as 'count=N,p50=X,p90=X,p99=X,max=X,framework-avg=X', where 'framework-avg' is the average invoke latency of the framework in this process.
+ *          The percentiles are estimated from a histogram of which buckets are about 25% wide.
+ *          The property 'handoff-spin-us' (non-negative integer up to 1000000, default 0) is the time in microseconds that the caller and the internal thread of the handle
+ *          busy-wait for each other before sleeping, when the request is passed to the internal thread (e.g., with timeout). This lowers the latency of the small models at the cost of the CPU time.
  * @since_tizen 6.0
  * @param[in] single The model handle.
  * @param[in] name The property name.
@@ -262,6 +486,17 @@ int ml_single_get_property (ml_single_h single, const char *name, char **value);
 
 /**
  * @brief Makes a single instance with given ml-option.
+ * @details The ml-option keys 'max-batch' and 'max-wait-us' (unsigned int) enable batching of the requests waiting for the handle.
+ *          The handle gathers up to 'max-batch' requests, waiting up to 'max-wait-us' microseconds for more requests,
+ *          stacks the inputs along the outermost dimension, invokes the model once, and splits the output back to each request.
+ *          If the model does not accept the stacked input, the handle invokes each request separately.
+ *          The ml-option key 'shared-model' (string, 'true' or 'false') shares the model loaded by other handles
+ *          opened with the same models, framework, accelerator, custom option, tensors information and 'max-batch', instead of loading it again.
+ *          The handles sharing a model invoke it one at a time, and cannot change the input information (see ml_single_get_model_cache_stats()).
+ *          A handle which changes the input information while not sharing the model is not shared with the handles opened later.
+ *          The ml-option keys 'cpu-affinity' (string, the list of CPUs such as '0-3,6'), 'sched-policy' (string, one of 'other', 'batch', 'idle', 'fifo' and 'rr'),
+ *          'sched-priority' (string, the priority for 'fifo' and 'rr', 1 by default, given with 'sched-policy') and 'nice' (string, from '-20' to '19') are applied to the internal thread invoking the model,
+ *          e.g., to run the inference on dedicated cores. These keys are supported on Linux only, and the real-time policies and the negative nice value may require the privilege.
  * @since_tizen 7.0
  * @remarks %http://tizen.org/privilege/mediastorage is needed if @a option is relevant to media storage.
  * @remarks %http://tizen.org/privilege/externalstorage is needed if @a option is relevant to external storage.
@@ -271,12 +506,311 @@ int ml_single_get_property (ml_single_h single, const char *name, char **value);
  * @return @c 0 on success. Otherwise a negative error value.
  * @retval #ML_ERROR_NONE Successful.
  * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
- * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the media storage or external storage.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the media storage or external storage, or to set the scheduling of the internal thread.
  * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
  * @retval #ML_ERROR_STREAMS_PIPE Failed to start the pipeline.
  * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
  */
 int ml_single_open_with_option (ml_single_h *single, const ml_option_h option);
+
+/**
+ * @brief Makes a single instance with given ml-option and loads the model in the background.
+ * @details This returns the handle at once and loads the model in an internal thread. When the model is loaded, @a cb is called with the result.
+ *          Until then, the functions using the model (e.g., ml_single_invoke(), ml_single_get_input_info() and ml_single_get_property()) return #ML_ERROR_TRY_AGAIN.
+ *          If the handle is closed while loading the model, ml_single_close() waits until loading is done and @a cb is called.
+ *          See ml_single_open_with_option() for the keys of @a option.
+ * @since_tizen 8.0
+ * @remarks %http://tizen.org/privilege/mediastorage is needed if @a option is relevant to media storage.
+ * @remarks %http://tizen.org/privilege/externalstorage is needed if @a option is relevant to external storage.
+ * @param[out] single This is the model handle opened. Users are required to close
+ *                   the given instance with ml_single_close().
+ * @param[in] option The handle of ml-option. The application may destroy it after this function returns.
+ * @param[in] cb The callback to get the result of loading the model.
+ * @param[in] user_data Private data for the callback.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the media storage or external storage.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_open_async (ml_single_h *single, const ml_option_h option, ml_single_open_cb cb, void *user_data);
+
+/**
+ * @brief Gets the statistics of the models shared among the single-shot handles in this process.
+ * @details The models are shared by the handles opened with the ml-option key 'shared-model' (see ml_single_open_with_option()).
+ * @since_tizen 8.0
+ * @param[out] hits The number of the opens which have shared the loaded model. Set NULL if it's not required.
+ * @param[out] misses The number of the opens which have loaded the model. Set NULL if it's not required.
+ * @param[out] resident The number of the models loaded and shared now. Set NULL if it's not required.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. All the parameters are NULL.
+ */
+int ml_single_get_model_cache_stats (unsigned int *hits, unsigned int *misses, unsigned int *resident);
+
+/**
+ * @brief Opens a pool of single-shot instances of the same model with given ml-option.
+ * @details The pool opens @a n_instances instances, each of which has its own thread to invoke the model.
+ *          ml_single_pool_invoke() passes the request to the idle instance that has processed the fewest requests.
+ *          If all instances are busy, the request waits in the pool and the first instance to finish takes it,
+ *          so faster instances process more requests.
+ * @since_tizen 8.0
+ * @remarks %http://tizen.org/privilege/mediastorage is needed if @a option is relevant to media storage.
+ * @remarks %http://tizen.org/privilege/externalstorage is needed if @a option is relevant to external storage.
+ * @param[out] pool The pool handle opened. Users are required to close the given instance with ml_single_pool_close().
+ * @param[in] option The handle of ml-option to open each instance (see ml_single_open_with_option()).
+ * @param[in] n_instances The number of instances, up to 64. Set 0 to open as many instances as the number of processors (up to 64).
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the media storage or external storage.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to start the pipeline.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_pool_open (ml_single_pool_h *pool, const ml_option_h option, unsigned int n_instances);
+
+/**
+ * @brief Invokes the model with the given input data, using an instance of the pool.
+ * @details This waits for the result until the invoke process is done. Multiple threads may call this with the same pool at the same time.
+ *          The input data is not copied, so the caller should not free or modify @a input until this returns.
+ * @since_tizen 8.0
+ * @param[in] pool The pool handle.
+ * @param[in] input The input data to be inferred.
+ * @param[out] output The allocated output buffer. The caller is responsible for freeing the output buffer with ml_tensors_data_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to invoke the model, or the pool is being closed.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_pool_invoke (ml_single_pool_h pool, const ml_tensors_data_h input, ml_tensors_data_h *output);
+
+/**
+ * @brief Gets the information (tensor dimension, type, name and so on) of required input data for the model of the pool.
+ * @since_tizen 8.0
+ * @param[in] pool The pool handle.
+ * @param[out] info The handle of input tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_pool_get_input_info (ml_single_pool_h pool, ml_tensors_info_h *info);
+
+/**
+ * @brief Gets the information (tensor dimension, type, name and so on) of output data for the model of the pool.
+ * @since_tizen 8.0
+ * @param[in] pool The pool handle.
+ * @param[out] info The handle of output tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_pool_get_output_info (ml_single_pool_h pool, ml_tensors_info_h *info);
+
+/**
+ * @brief Closes the pool and all the single-shot instances.
+ * @details The requests waiting for an idle instance return #ML_ERROR_STREAMS_PIPE.
+ * @since_tizen 8.0
+ * @param[in] pool The pool handle to be closed.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_pool_close (ml_single_pool_h pool);
+
+/**
+ * @brief Opens the series of the models, where the output of a model is the input of the next model.
+ * @details Each model is opened with the ml-option of the same index (see ml_single_open_with_option()), and has its own thread to invoke the model.
+ *          The output of a model is given to the next model without copying, so the number and size of the output tensors of a model should be same as the input tensors of the next model.
+ *          ml_single_series_invoke_async() passes the request from a model to the next model in their threads,
+ *          so a model processes a request while the next model processes the previous request.
+ * @since_tizen 8.0
+ * @remarks %http://tizen.org/privilege/mediastorage is needed if @a options are relevant to media storage.
+ * @remarks %http://tizen.org/privilege/externalstorage is needed if @a options are relevant to external storage.
+ * @param[out] series The series handle opened. Users are required to close the given instance with ml_single_series_close().
+ * @param[in] options The array of ml-option to open each model, in the order of the series.
+ * @param[in] num_models The number of the models. It should be positive.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the media storage or external storage.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid, or the output of a model is not compatible with the input of the next model.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to start the pipeline.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_series_open (ml_single_series_h *series, const ml_option_h *options, unsigned int num_models);
+
+/**
+ * @brief Invokes the models of the series in order with the given input data, and returns the output of the last model.
+ * @details This waits for the result until the last model is done. Multiple threads may call this with the same series at the same time.
+ * @since_tizen 8.0
+ * @param[in] series The series handle.
+ * @param[in] input The input data of the first model.
+ * @param[out] output The output of the last model. The caller is responsible for freeing the output buffer with ml_tensors_data_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to invoke a model, or the series is being closed.
+ * @retval #ML_ERROR_TIMED_OUT Failed to get the result of a model in the timeout.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_series_invoke (ml_single_series_h series, const ml_tensors_data_h input, ml_tensors_data_h *output);
+
+/**
+ * @brief Requests to invoke the models of the series in order with the given input data, and returns without waiting for the result.
+ * @details The output of the last model is passed to @a cb, which is called in the thread of the last model.
+ *          If a model fails, @a cb is called with the error in the thread of the model.
+ *          The input data is copied in the API, so the application may release @a input after calling this.
+ * @since_tizen 8.0
+ * @param[in] series The series handle.
+ * @param[in] input The input data of the first model.
+ * @param[in] cb The callback to get the output of the last model.
+ * @param[in] user_data Private data for the callback.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE The series is being closed.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_series_invoke_async (ml_single_series_h series, const ml_tensors_data_h input, ml_single_invoke_cb cb, void *user_data);
+
+/**
+ * @brief Gets the information (tensor dimension, type, name and so on) of required input data for the first model of the series.
+ * @since_tizen 8.0
+ * @param[in] series The series handle.
+ * @param[out] info The handle of input tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_series_get_input_info (ml_single_series_h series, ml_tensors_info_h *info);
+
+/**
+ * @brief Gets the information (tensor dimension, type, name and so on) of output data for the last model of the series.
+ * @since_tizen 8.0
+ * @param[in] series The series handle.
+ * @param[out] info The handle of output tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_series_get_output_info (ml_single_series_h series, ml_tensors_info_h *info);
+
+/**
+ * @brief Closes the series and all the models.
+ * @details This waits until the requests in progress pass through all the models.
+ * @since_tizen 8.0
+ * @param[in] series The series handle to be closed.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_series_close (ml_single_series_h series);
+
+/**
+ * @brief Opens the ensemble of the models, which are invoked at the same time with the same input.
+ * @details Each model is opened with the ml-option of the same index (see ml_single_open_with_option()), and has its own thread to invoke the model.
+ *          The input is shared by all the models without copying, so the number, type and size of the input tensors of the models should be same.
+ *          The outputs may be reduced into a single output with ml_single_ensemble_invoke_reduce() if all the models have the same number, type and size of the output tensors.
+ * @since_tizen 8.0
+ * @remarks %http://tizen.org/privilege/mediastorage is needed if @a options are relevant to media storage.
+ * @remarks %http://tizen.org/privilege/externalstorage is needed if @a options are relevant to external storage.
+ * @param[out] ensemble The ensemble handle opened. Users are required to close the given instance with ml_single_ensemble_close().
+ * @param[in] options The array of ml-option to open each model.
+ * @param[in] num_models The number of the models. It should be positive.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the media storage or external storage.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid, or the input of a model is not compatible with the input of the first model.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to start the pipeline.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_ensemble_open (ml_single_ensemble_h *ensemble, const ml_option_h *options, unsigned int num_models);
+
+/**
+ * @brief Invokes all the models of the ensemble at the same time with the given input data, and returns the output of each model.
+ * @details This waits for the result until all the models are done, so the latency is close to the one of the slowest model.
+ *          If a model fails, the outputs of the other models are released and this returns the error.
+ *          Multiple threads may call this with the same ensemble at the same time.
+ * @since_tizen 8.0
+ * @param[in] ensemble The ensemble handle.
+ * @param[in] input The input data shared by the models. It is not copied, and the models use it until this returns.
+ * @param[out] outputs The array to store the output of each model, of which length is the number of the models given to ml_single_ensemble_open(). The caller is responsible for freeing each output with ml_tensors_data_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to invoke a model, or the ensemble is being closed.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_ensemble_invoke (ml_single_ensemble_h ensemble, const ml_tensors_data_h input, ml_tensors_data_h *outputs);
+
+/**
+ * @brief Invokes all the models of the ensemble at the same time with the given input data, and reduces the outputs into a single output.
+ * @details The output has the same information as the output of the first model. See #ml_single_ensemble_reduce_e for the methods to reduce.
+ * @since_tizen 8.0
+ * @param[in] ensemble The ensemble handle.
+ * @param[in] input The input data shared by the models. It is not copied, and the models use it until this returns.
+ * @param[in] reduce The method to reduce the outputs.
+ * @param[out] output The reduced output. The caller is responsible for freeing the output buffer with ml_tensors_data_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, the models do not have the same output, or the type of the output (e.g., float16) is not supported to reduce.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to invoke a model, or the ensemble is being closed.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_ensemble_invoke_reduce (ml_single_ensemble_h ensemble, const ml_tensors_data_h input, ml_single_ensemble_reduce_e reduce, ml_tensors_data_h *output);
+
+/**
+ * @brief Gets the information (tensor dimension, type, name and so on) of required input data for the models of the ensemble.
+ * @since_tizen 8.0
+ * @param[in] ensemble The ensemble handle.
+ * @param[out] info The handle of input tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_ensemble_get_input_info (ml_single_ensemble_h ensemble, ml_tensors_info_h *info);
+
+/**
+ * @brief Gets the information (tensor dimension, type, name and so on) of output data for the given model of the ensemble.
+ * @since_tizen 8.0
+ * @param[in] ensemble The ensemble handle.
+ * @param[in] index The index of the model, in the order of the options given to ml_single_ensemble_open().
+ * @param[out] info The handle of output tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_ensemble_get_output_info (ml_single_ensemble_h ensemble, unsigned int index, ml_tensors_info_h *info);
+
+/**
+ * @brief Closes the ensemble and all the models.
+ * @details This waits until the requests in progress are done by all the models.
+ * @since_tizen 8.0
+ * @param[in] ensemble The ensemble handle to be closed.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_ensemble_close (ml_single_ensemble_h ensemble);
 /**
  * @}
  */
@@ -37,6 +37,16 @@ typedef struct {
   char *models;                  /**< Comma separated neural network model files. */
   char *custom_option;           /**< Custom option string for neural network framework. */
   char *fw_name;                 /**< The explicit framework name given by user */
+  unsigned int max_batch;        /**< Max number of requests to be invoked at once. 0 or 1 disables batching. */
+  unsigned int max_wait_us;      /**< Max time in microseconds to wait for gathering a batch. */
+  int shared_model;              /**< Share the loaded model among the handles with the same model, framework, accelerator, custom option, tensors information and max_batch. */
+  int model_is_fd;               /**< The model path refers to the file descriptor (/proc/self/fd), which has no file extension to be checked. */
+  ml_single_open_cb open_cb;     /**< If given, the model is loaded in the background and this is called when loaded (see ml_single_open_async()). */
+  void *open_user_data;          /**< Private data for open_cb. */
+  char *cpu_affinity;            /**< The list of CPUs to run the invoke thread, such as '0-3,6'. */
+  char *sched_policy;            /**< The scheduling policy of the invoke thread (other, batch, idle, fifo or rr). */
+  char *sched_priority;          /**< The priority of the invoke thread with the real-time scheduling policy (fifo or rr). */
+  char *nice;                    /**< The nice value of the invoke thread. */
 } ml_single_preset;
 
 /**
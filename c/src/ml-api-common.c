@@ -14,11 +14,242 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include <glib.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+#if defined(__x86_64__) && defined(__GNUC__)
+#define ML_TENSORS_CONVERT_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define ML_TENSORS_CONVERT_NEON 1
+#include <arm_neon.h>
+#endif
 
 #include "nnstreamer.h"
 #include "ml-api-internal.h"
 
+/**
+ * @brief The max number of the free handles cached in a thread, for each kind of handle.
+ */
+#define ML_TENSORS_CACHE_LOCAL_MAX (16U)
+
+/**
+ * @brief The max number of the free handles shared by the threads, for each kind of handle.
+ */
+#define ML_TENSORS_CACHE_GLOBAL_MAX (256U)
+
+/**
+ * @brief The kinds of the handles cached by the allocator.
+ */
+typedef enum
+{
+  ML_TENSORS_CACHE_DATA = 0,
+  ML_TENSORS_CACHE_INFO,
+
+  ML_TENSORS_CACHE_KINDS
+} ml_tensors_cache_kind_e;
+
+/**
+ * @brief The free handles cached in a thread.
+ */
+typedef struct
+{
+  gpointer objects[ML_TENSORS_CACHE_KINDS][ML_TENSORS_CACHE_LOCAL_MAX];
+  guint num[ML_TENSORS_CACHE_KINDS];
+} ml_tensors_cache_local_s;
+
+static void _ml_tensors_cache_local_free (gpointer data);
+
+/**
+ * @brief Macro to return the error if the tensors information is frozen and shared by the handles.
+ */
+#define _ml_tensors_info_return_if_frozen(i) \
+  do { \
+    if (g_atomic_int_get (&(i)->ref_count) > 0) \
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER, \
+          "The given tensors information is frozen and shared by the tensors data handles. It cannot be updated."); \
+  } while (0)
+
+/**
+ * The handles of tensors data and information are created and destroyed for every frame.
+ * The destroyed handles are kept with the lock initialized and the fields cleared,
+ * in the cache of the thread first, and in the global cache if the cache of the thread is full.
+ * Thus a handle destroyed in a thread (e.g., the application) may be reused in another thread (e.g., the pipeline).
+ */
+static GPrivate tensors_cache_local = G_PRIVATE_INIT (_ml_tensors_cache_local_free);
+static gpointer tensors_cache_global[ML_TENSORS_CACHE_KINDS][ML_TENSORS_CACHE_GLOBAL_MAX];
+static guint tensors_cache_global_num[ML_TENSORS_CACHE_KINDS];
+G_LOCK_DEFINE_STATIC (tensors_cache);
+
+/* counters of the handles allocated from the heap and reused from the cache */
+static gint tensors_cache_allocated[ML_TENSORS_CACHE_KINDS];
+static gint tensors_cache_reused[ML_TENSORS_CACHE_KINDS];
+
+/**
+ * @brief Internal function to free the handle which is not cached.
+ */
+static void
+_ml_tensors_cache_finalize (ml_tensors_cache_kind_e kind, gpointer object)
+{
+  if (kind == ML_TENSORS_CACHE_DATA)
+    g_mutex_clear (&((ml_tensors_data_s *) object)->lock);
+  else
+    g_mutex_clear (&((ml_tensors_info_s *) object)->lock);
+
+  g_free (object);
+}
+
+/**
+ * @brief Internal function to move the handles cached in the exiting thread to the global cache.
+ */
+static void
+_ml_tensors_cache_local_free (gpointer data)
+{
+  ml_tensors_cache_local_s *local = (ml_tensors_cache_local_s *) data;
+  guint k, i;
+
+  G_LOCK (tensors_cache);
+  for (k = 0; k < ML_TENSORS_CACHE_KINDS; k++) {
+    for (i = 0; i < local->num[k]; i++) {
+      if (tensors_cache_global_num[k] < ML_TENSORS_CACHE_GLOBAL_MAX)
+        tensors_cache_global[k][tensors_cache_global_num[k]++] =
+            local->objects[k][i];
+      else
+        _ml_tensors_cache_finalize (k, local->objects[k][i]);
+    }
+  }
+  G_UNLOCK (tensors_cache);
+
+  g_free (local);
+}
+
+/**
+ * @brief Internal function to get the cache of the calling thread.
+ */
+static ml_tensors_cache_local_s *
+_ml_tensors_cache_local_get (void)
+{
+  ml_tensors_cache_local_s *local;
+
+  local = (ml_tensors_cache_local_s *) g_private_get (&tensors_cache_local);
+  if (G_UNLIKELY (!local)) {
+    local = g_try_new0 (ml_tensors_cache_local_s, 1);
+    if (local)
+      g_private_set (&tensors_cache_local, local);
+  }
+
+  return local;
+}
+
+/**
+ * @brief Internal function to get a handle from the cache, or to allocate a new handle.
+ * @details The handle from the cache has the initialized lock and cleared fields.
+ *          The new handle is filled with zero and the caller should initialize it.
+ * @param[out] reused TRUE if the handle is from the cache.
+ */
+static gpointer
+_ml_tensors_cache_acquire (ml_tensors_cache_kind_e kind, gsize size,
+    gboolean * reused)
+{
+  ml_tensors_cache_local_s *local;
+  gpointer object = NULL;
+
+  local = _ml_tensors_cache_local_get ();
+  if (local && local->num[kind] > 0) {
+    object = local->objects[kind][--local->num[kind]];
+  } else {
+    G_LOCK (tensors_cache);
+    if (tensors_cache_global_num[kind] > 0)
+      object = tensors_cache_global[kind][--tensors_cache_global_num[kind]];
+    G_UNLOCK (tensors_cache);
+  }
+
+  if (object) {
+    g_atomic_int_inc (&tensors_cache_reused[kind]);
+    *reused = TRUE;
+    return object;
+  }
+
+  object = g_try_malloc0 (size);
+  if (object)
+    g_atomic_int_inc (&tensors_cache_allocated[kind]);
+  *reused = FALSE;
+  return object;
+}
+
+/**
+ * @brief Internal function to put the handle of which fields are cleared into the cache.
+ */
+static void
+_ml_tensors_cache_release (ml_tensors_cache_kind_e kind, gpointer object)
+{
+  ml_tensors_cache_local_s *local;
+
+  local = _ml_tensors_cache_local_get ();
+  if (local && local->num[kind] < ML_TENSORS_CACHE_LOCAL_MAX) {
+    local->objects[kind][local->num[kind]++] = object;
+    return;
+  }
+
+  G_LOCK (tensors_cache);
+  if (tensors_cache_global_num[kind] < ML_TENSORS_CACHE_GLOBAL_MAX) {
+    tensors_cache_global[kind][tensors_cache_global_num[kind]++] = object;
+    object = NULL;
+  }
+  G_UNLOCK (tensors_cache);
+
+  if (object)
+    _ml_tensors_cache_finalize (kind, object);
+}
+
+/**
+ * @brief Gets the counters of the handles of tensors data and information allocated from the heap and reused from the cache.
+ */
+void
+_ml_tensors_cache_get_stats (ml_tensors_cache_stats_s * stats)
+{
+  if (!stats)
+    return;
+
+  stats->data_allocated =
+      g_atomic_int_get (&tensors_cache_allocated[ML_TENSORS_CACHE_DATA]);
+  stats->data_reused =
+      g_atomic_int_get (&tensors_cache_reused[ML_TENSORS_CACHE_DATA]);
+  stats->info_allocated =
+      g_atomic_int_get (&tensors_cache_allocated[ML_TENSORS_CACHE_INFO]);
+  stats->info_reused =
+      g_atomic_int_get (&tensors_cache_reused[ML_TENSORS_CACHE_INFO]);
+}
+
+/**
+ * @brief Internal function to allocate a tensors information handle with default value.
+ */
+static ml_tensors_info_s *
+_ml_tensors_info_alloc (bool is_extended)
+{
+  ml_tensors_info_s *tensors_info;
+  gboolean reused;
+
+  tensors_info = (ml_tensors_info_s *) _ml_tensors_cache_acquire
+      (ML_TENSORS_CACHE_INFO, sizeof (ml_tensors_info_s), &reused);
+  if (tensors_info == NULL)
+    return NULL;
+
+  if (!reused) {
+    g_mutex_init (&tensors_info->lock);
+
+    /* init tensors info struct */
+    _ml_tensors_info_initialize (tensors_info);
+  }
+
+  tensors_info->is_extended = is_extended;
+  return tensors_info;
+}
+
 /**
  * @brief Allocates a tensors information handle with default value.
  */
@@ -33,16 +264,12 @@ ml_tensors_info_create (ml_tensors_info_h * info)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, info, is NULL. Provide a valid pointer.");
 
-  *info = tensors_info = g_new0 (ml_tensors_info_s, 1);
+  *info = tensors_info = _ml_tensors_info_alloc (false);
   if (tensors_info == NULL)
     _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
         "Failed to allocate the tensors info handle. Out of memory?");
 
-  g_mutex_init (&tensors_info->lock);
-  tensors_info->is_extended = false;
-
-  /* init tensors info struct */
-  return _ml_tensors_info_initialize (tensors_info);
+  return ML_ERROR_NONE;
 }
 
 /**
@@ -59,16 +286,12 @@ ml_tensors_info_create_extended (ml_tensors_info_h * info)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, info, is NULL. Provide a valid pointer.");
 
-  *info = tensors_info = g_new0 (ml_tensors_info_s, 1);
+  *info = tensors_info = _ml_tensors_info_alloc (true);
   if (tensors_info == NULL)
     _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
         "Failed to allocate the tensors info handle. Out of memory?");
 
-  g_mutex_init (&tensors_info->lock);
-  tensors_info->is_extended = true;
-
-  /* init tensors info struct */
-  return _ml_tensors_info_initialize (tensors_info);
+  return ML_ERROR_NONE;
 }
 
 /**
@@ -77,6 +300,7 @@ ml_tensors_info_create_extended (ml_tensors_info_h * info)
 int
 ml_tensors_info_destroy (ml_tensors_info_h info)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
 
   check_feature_state (ML_FEATURE);
@@ -87,13 +311,82 @@ ml_tensors_info_destroy (ml_tensors_info_h info)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, info, is NULL. Provide a valid pointer.");
 
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  /* The frozen information is released with the last reference. */
+  if (g_atomic_int_get (&tensors_info->ref_count) > 0 &&
+      !g_atomic_int_dec_and_test (&tensors_info->ref_count))
+    return ML_ERROR_NONE;
+
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   _ml_tensors_info_free (tensors_info);
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
-  g_mutex_clear (&tensors_info->lock);
-  g_free (tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
+
+  /* The handle is cleared, keep it with the lock for the next allocation. */
+  tensors_info->nolock = 0;
+  tensors_info->owner = NULL;
+  tensors_info->is_extended = false;
+  _ml_tensors_cache_release (ML_TENSORS_CACHE_INFO, tensors_info);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Freezes the tensors information to share it without copying.
+ */
+void
+_ml_tensors_info_freeze (ml_tensors_info_h info)
+{
+  ml_tensors_info_s *tensors_info = (ml_tensors_info_s *) info;
+
+  if (!tensors_info || g_atomic_int_get (&tensors_info->ref_count) > 0)
+    return;
+
+  /**
+   * The caller owns the information when freezing it.
+   * Nothing changes the frozen information, thus no need for locks.
+   */
+  tensors_info->nolock = 1;
+  tensors_info->owner = NULL;
+  g_atomic_int_set (&tensors_info->ref_count, 1);
+}
+
+/**
+ * @brief Gets the frozen tensors information sharing the given information.
+ */
+int
+_ml_tensors_info_share (const ml_tensors_info_h info,
+    ml_tensors_info_h * shared)
+{
+  ml_tensors_info_s *tensors_info = (ml_tensors_info_s *) info;
+  ml_tensors_info_s *frozen;
+  int status;
+
+  if (!tensors_info || !shared)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info or shared, is NULL. Provide a valid pointer.");
+
+  /* Sharing the frozen information is a reference. */
+  if (g_atomic_int_get (&tensors_info->ref_count) > 0) {
+    g_atomic_int_inc (&tensors_info->ref_count);
+    *shared = tensors_info;
+    return ML_ERROR_NONE;
+  }
+
+  frozen = _ml_tensors_info_alloc (tensors_info->is_extended);
+  if (frozen == NULL)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the tensors info handle. Out of memory?");
+
+  status = ml_tensors_info_clone (frozen, tensors_info);
+  if (status != ML_ERROR_NONE) {
+    ml_tensors_info_destroy (frozen);
+    _ml_error_report_return_continue (status,
+        "Failed to copy the tensors information to share. Error code: %d",
+        status);
+  }
 
+  _ml_tensors_info_freeze (frozen);
+  *shared = frozen;
   return ML_ERROR_NONE;
 }
 
@@ -110,10 +403,12 @@ _ml_tensors_info_initialize (ml_tensors_info_s * info)
         "The parameter, info, is NULL. Provide a valid pointer.");
 
   info->num_tensors = 0;
+  info->alloc_policy = ML_TENSORS_ALLOC_DEFAULT;
 
   for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
     info->info[i].name = NULL;
     info->info[i].type = ML_TENSOR_TYPE_UNKNOWN;
+    info->info[i].quant = NULL;
 
     for (j = 0; j < ML_TENSOR_RANK_LIMIT; j++) {
       info->info[i].dimension[j] = 0;
@@ -215,6 +510,7 @@ done:
 int
 ml_tensors_info_validate (const ml_tensors_info_h info, bool *valid)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
   int ret = ML_ERROR_NONE;
 
@@ -230,11 +526,11 @@ ml_tensors_info_validate (const ml_tensors_info_h info, bool *valid)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The input parameter, tensors_info, is NULL. It should be a valid ml_tensors_info_h, which is usually created by ml_tensors_info_create().");
 
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   ret = _ml_tensors_info_validate_nolock (info, valid);
 
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
   return ret;
 }
 
@@ -245,6 +541,7 @@ int
 _ml_tensors_info_compare (const ml_tensors_info_h info1,
     const ml_tensors_info_h info2, bool *equal)
 {
+  int i1_nolock, i2_nolock;
   ml_tensors_info_s *i1, *i2;
   guint i;
 
@@ -261,9 +558,9 @@ _ml_tensors_info_compare (const ml_tensors_info_h info1,
         "The output parameter, equal, should be a valid pointer allocated by the caller. However, equal is NULL.");
 
   i1 = (ml_tensors_info_s *) info1;
-  G_LOCK_UNLESS_NOLOCK (*i1);
+  G_LOCK_UNLESS_NOLOCK (*i1, i1_nolock);
   i2 = (ml_tensors_info_s *) info2;
-  G_LOCK_UNLESS_NOLOCK (*i2);
+  G_LOCK_UNLESS_NOLOCK (*i2, i2_nolock);
 
   /* init false */
   *equal = false;
@@ -282,8 +579,8 @@ _ml_tensors_info_compare (const ml_tensors_info_h info1,
   *equal = true;
 
 done:
-  G_UNLOCK_UNLESS_NOLOCK (*i2);
-  G_UNLOCK_UNLESS_NOLOCK (*i1);
+  G_UNLOCK_UNLESS_NOLOCK (*i2, i2_nolock);
+  G_UNLOCK_UNLESS_NOLOCK (*i1, i1_nolock);
   return ML_ERROR_NONE;
 }
 
@@ -306,6 +603,7 @@ ml_tensors_info_set_count (ml_tensors_info_h info, unsigned int count)
         count);
 
   tensors_info = (ml_tensors_info_s *) info;
+  _ml_tensors_info_return_if_frozen (tensors_info);
 
   /* This is atomic. No need for locks */
   tensors_info->num_tensors = count;
@@ -344,6 +642,7 @@ int
 ml_tensors_info_set_tensor_name (ml_tensors_info_h info,
     unsigned int index, const char *name)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
 
   check_feature_state (ML_FEATURE);
@@ -353,10 +652,11 @@ ml_tensors_info_set_tensor_name (ml_tensors_info_h info,
         "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which is usually created by ml_tensors_info_create().");
 
   tensors_info = (ml_tensors_info_s *) info;
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  _ml_tensors_info_return_if_frozen (tensors_info);
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   if (tensors_info->num_tensors <= index) {
-    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, index, is too large, it should be smaller than the number of tensors, given by info. info says num_tensors is %u and index is %u.",
         tensors_info->num_tensors, index);
@@ -370,7 +670,7 @@ ml_tensors_info_set_tensor_name (ml_tensors_info_h info,
   if (name)
     tensors_info->info[index].name = g_strdup (name);
 
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
   return ML_ERROR_NONE;
 }
 
@@ -381,6 +681,7 @@ int
 ml_tensors_info_get_tensor_name (ml_tensors_info_h info,
     unsigned int index, char **name)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
 
   check_feature_state (ML_FEATURE);
@@ -393,10 +694,10 @@ ml_tensors_info_get_tensor_name (ml_tensors_info_h info,
         "The parameter, name, is NULL. It should be a valid char ** pointer, allocated by the caller. E.g., char *name; ml_tensors_info_get_tensor_name (info, index, &name);");
 
   tensors_info = (ml_tensors_info_s *) info;
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   if (tensors_info->num_tensors <= index) {
-    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, index, is too large. It should be smaller than the number of tensors, given by info. info says num_tensors is %u and index is %u.",
         tensors_info->num_tensors, index);
@@ -404,7 +705,160 @@ ml_tensors_info_get_tensor_name (ml_tensors_info_h info,
 
   *name = g_strdup (tensors_info->info[index].name);
 
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to allocate the quantization parameters.
+ */
+static ml_tensor_quant_s *
+_ml_tensor_quant_new (unsigned int axis, unsigned int num_channels,
+    const float *scales, const int32_t * zero_points)
+{
+  ml_tensor_quant_s *quant;
+
+  quant = (ml_tensor_quant_s *) g_try_malloc (sizeof (ml_tensor_quant_s) +
+      num_channels * (sizeof (float) + sizeof (int32_t)));
+  if (quant == NULL)
+    return NULL;
+
+  quant->axis = axis;
+  quant->num_channels = num_channels;
+  quant->scales = (float *) (quant + 1);
+  quant->zero_points = (int32_t *) (quant->scales + num_channels);
+
+  memcpy (quant->scales, scales, num_channels * sizeof (float));
+  if (zero_points)
+    memcpy (quant->zero_points, zero_points, num_channels * sizeof (int32_t));
+  else
+    memset (quant->zero_points, 0, num_channels * sizeof (int32_t));
+
+  return quant;
+}
+
+/**
+ * @brief Internal function to copy the quantization parameters.
+ */
+static ml_tensor_quant_s *
+_ml_tensor_quant_dup (const ml_tensor_quant_s * quant)
+{
+  if (quant == NULL)
+    return NULL;
+
+  return _ml_tensor_quant_new (quant->axis, quant->num_channels,
+      quant->scales, quant->zero_points);
+}
+
+/**
+ * @brief Sets the quantization parameters of the tensor with given handle of tensors information.
+ */
+int
+ml_tensors_info_set_tensor_quantization (ml_tensors_info_h info,
+    unsigned int index, unsigned int axis, unsigned int num_channels,
+    const float *scales, const int32_t * zero_points)
+{
+  int nolock;
+  ml_tensors_info_s *tensors_info;
+  ml_tensor_quant_s *quant = NULL;
+  unsigned int i;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which is usually created by ml_tensors_info_create().");
+
+  tensors_info = (ml_tensors_info_s *) info;
+  _ml_tensors_info_return_if_frozen (tensors_info);
+
+  if (scales) {
+    if (num_channels == 0)
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The parameter, num_channels, is 0. It should be 1 for the per-tensor parameters, or the size of the dimension at axis for the per-channel parameters.");
+    if (axis >= ML_TENSOR_RANK_LIMIT)
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The parameter, axis (%u), is too large. It should be smaller than %u.",
+          axis, ML_TENSOR_RANK_LIMIT);
+
+    for (i = 0; i < num_channels; i++) {
+      if (!(scales[i] > 0.0f) || scales[i] > G_MAXFLOAT)
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The parameter, scales, has an invalid value (%f) at index %u. The scales should be positive and finite.",
+            scales[i], i);
+    }
+
+    quant = _ml_tensor_quant_new (axis, num_channels, scales, zero_points);
+    if (quant == NULL)
+      _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+          "Failed to allocate the quantization parameters. Out of memory?");
+  }
+
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
+
+  if (tensors_info->num_tensors <= index) {
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
+    g_free (quant);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, index, is too large, it should be smaller than the number of tensors, given by info. info says num_tensors is %u and index is %u.",
+        tensors_info->num_tensors, index);
+  }
+
+  g_free (tensors_info->info[index].quant);
+  tensors_info->info[index].quant = quant;
+
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the quantization parameters of the tensor with given handle of tensors information.
+ */
+int
+ml_tensors_info_get_tensor_quantization (ml_tensors_info_h info,
+    unsigned int index, unsigned int *axis, unsigned int *num_channels,
+    float **scales, int32_t ** zero_points)
+{
+  int nolock;
+  ml_tensors_info_s *tensors_info;
+  ml_tensor_quant_s *quant;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which is usually created by ml_tensors_info_create().");
+  if (!axis || !num_channels || !scales || !zero_points)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, axis, num_channels, scales or zero_points, is NULL. It should be a valid pointer to store the quantization parameters.");
+
+  tensors_info = (ml_tensors_info_s *) info;
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
+
+  if (tensors_info->num_tensors <= index) {
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, index, is too large. It should be smaller than the number of tensors, given by info. info says num_tensors is %u and index is %u.",
+        tensors_info->num_tensors, index);
+  }
+
+  quant = tensors_info->info[index].quant;
+  if (quant) {
+    *axis = quant->axis;
+    *num_channels = quant->num_channels;
+    *scales = g_new (float, quant->num_channels);
+    *zero_points = g_new (int32_t, quant->num_channels);
+    memcpy (*scales, quant->scales, quant->num_channels * sizeof (float));
+    memcpy (*zero_points, quant->zero_points,
+        quant->num_channels * sizeof (int32_t));
+  } else {
+    *axis = 0;
+    *num_channels = 0;
+    *scales = NULL;
+    *zero_points = NULL;
+  }
+
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
   return ML_ERROR_NONE;
 }
 
@@ -415,6 +869,7 @@ int
 ml_tensors_info_set_tensor_type (ml_tensors_info_h info,
     unsigned int index, const ml_tensor_type_e type)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
 
   check_feature_state (ML_FEATURE);
@@ -436,16 +891,17 @@ ml_tensors_info_set_tensor_type (ml_tensors_info_h info,
   /** @todo add BFLOAT16 when nnstreamer is ready for it. */
 
   tensors_info = (ml_tensors_info_s *) info;
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  _ml_tensors_info_return_if_frozen (tensors_info);
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   if (tensors_info->num_tensors <= index) {
-    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
     return ML_ERROR_INVALID_PARAMETER;
   }
 
   tensors_info->info[index].type = type;
 
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
   return ML_ERROR_NONE;
 }
 
@@ -456,6 +912,7 @@ int
 ml_tensors_info_get_tensor_type (ml_tensors_info_h info,
     unsigned int index, ml_tensor_type_e * type)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
 
   check_feature_state (ML_FEATURE);
@@ -468,16 +925,16 @@ ml_tensors_info_get_tensor_type (ml_tensors_info_h info,
         "The parameter, type, is NULL. It should be a valid pointer of ml_tensor_type_e *, allocated by the caller. E.g., ml_tensor_type_e t; ml_tensors_info_get_tensor_type (info, index, &t);");
 
   tensors_info = (ml_tensors_info_s *) info;
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   if (tensors_info->num_tensors <= index) {
-    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
     return ML_ERROR_INVALID_PARAMETER;
   }
 
   *type = tensors_info->info[index].type;
 
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
   return ML_ERROR_NONE;
 }
 
@@ -488,6 +945,7 @@ int
 ml_tensors_info_set_tensor_dimension (ml_tensors_info_h info,
     unsigned int index, const ml_tensor_dimension dimension)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
   guint i;
 
@@ -498,10 +956,11 @@ ml_tensors_info_set_tensor_dimension (ml_tensors_info_h info,
         "The parameter, info, is NULL. It should be a valid pointer of ml_tensors_info_h, which is usually created by ml_tensors_info_create().");
 
   tensors_info = (ml_tensors_info_s *) info;
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  _ml_tensors_info_return_if_frozen (tensors_info);
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   if (tensors_info->num_tensors <= index) {
-    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The number of tensors in 'info' parameter is %u, which is not larger than the given 'index' %u. Thus, we cannot get %u'th tensor from 'info'. Please set the number of tensors of 'info' correctly or check the value of the given 'index'.",
         tensors_info->num_tensors, index, index);
@@ -517,7 +976,7 @@ ml_tensors_info_set_tensor_dimension (ml_tensors_info_h info,
     }
   }
 
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
   return ML_ERROR_NONE;
 }
 
@@ -528,6 +987,7 @@ int
 ml_tensors_info_get_tensor_dimension (ml_tensors_info_h info,
     unsigned int index, ml_tensor_dimension dimension)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
   guint i, valid_rank = ML_TENSOR_RANK_LIMIT;
 
@@ -538,10 +998,10 @@ ml_tensors_info_get_tensor_dimension (ml_tensors_info_h info,
         "The parameter, info, is NULL. It should be a valid pointer of ml_tensors_info_h, which is usually created by ml_tensors_info_create().");
 
   tensors_info = (ml_tensors_info_s *) info;
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   if (tensors_info->num_tensors <= index) {
-    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
     return ML_ERROR_INVALID_PARAMETER;
   }
 
@@ -552,7 +1012,7 @@ ml_tensors_info_get_tensor_dimension (ml_tensors_info_h info,
     dimension[i] = tensors_info->info[index].dimension[i];
   }
 
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
   return ML_ERROR_NONE;
 }
 
@@ -610,6 +1070,7 @@ int
 ml_tensors_info_get_tensor_size (ml_tensors_info_h info,
     int index, size_t *data_size)
 {
+  int nolock;
   ml_tensors_info_s *tensors_info;
 
   check_feature_state (ML_FEATURE);
@@ -622,7 +1083,7 @@ ml_tensors_info_get_tensor_size (ml_tensors_info_h info,
         "The parameter, data_size, is NULL. It should be a valid size_t * pointer allocated by the caller. E.g., size_t d; ml_tensors_info_get_tensor_size (info, index, &d);");
 
   tensors_info = (ml_tensors_info_s *) info;
-  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+  G_LOCK_UNLESS_NOLOCK (*tensors_info, nolock);
 
   /* init 0 */
   *data_size = 0;
@@ -638,7 +1099,7 @@ ml_tensors_info_get_tensor_size (ml_tensors_info_h info,
     }
   } else {
     if (tensors_info->num_tensors <= index) {
-      G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+      G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
       _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
           "The parameter, index (%u), is too large. Index should be smaller than the number of tensors of the parameter, info (info's num-tensors: %u).",
           index, tensors_info->num_tensors);
@@ -649,7 +1110,7 @@ ml_tensors_info_get_tensor_size (ml_tensors_info_h info,
         tensors_info->is_extended);
   }
 
-  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info, nolock);
   return ML_ERROR_NONE;
 }
 
@@ -669,6 +1130,8 @@ _ml_tensors_info_free (ml_tensors_info_s * info)
     if (info->info[i].name) {
       g_free (info->info[i].name);
     }
+
+    g_free (info->info[i].quant);
   }
 
   _ml_tensors_info_initialize (info);
@@ -683,6 +1146,7 @@ _ml_tensors_info_free (ml_tensors_info_s * info)
 int
 _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_data)
 {
+  int nolock;
   int status = ML_ERROR_NONE;
   ml_tensors_data_s *_data;
   guint i;
@@ -692,7 +1156,7 @@ _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_data)
         "The parameter, data, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
 
   _data = (ml_tensors_data_s *) data;
-  G_LOCK_UNLESS_NOLOCK (*_data);
+  G_LOCK_UNLESS_NOLOCK (*_data, nolock);
 
   if (free_data) {
     if (_data->destroy) {
@@ -711,11 +1175,21 @@ _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_data)
     }
   }
 
-  ml_tensors_info_destroy (_data->info);
+  if (_data->info)
+    ml_tensors_info_destroy (_data->info);
+
+  G_UNLOCK_UNLESS_NOLOCK (*_data, nolock);
+
+  /* Clear the handle and keep it with the lock for the next allocation. */
+  _data->num_tensors = 0;
+  memset (_data->tensors, 0, sizeof (_data->tensors));
+  _data->info = NULL;
+  _data->user_data = NULL;
+  _data->destroy = NULL;
+  _data->nolock = 0;
+  _data->owner = NULL;
+  _ml_tensors_cache_release (ML_TENSORS_CACHE_DATA, _data);
 
-  G_UNLOCK_UNLESS_NOLOCK (*_data);
-  g_mutex_clear (&_data->lock);
-  g_free (_data);
   return status;
 }
 
@@ -745,7 +1219,9 @@ _ml_tensors_data_create_no_alloc (const ml_tensors_info_h info,
 {
   ml_tensors_data_s *_data;
   ml_tensors_info_s *_info;
+  gboolean reused;
   gint i;
+  int status;
 
   check_feature_state (ML_FEATURE);
 
@@ -756,29 +1232,33 @@ _ml_tensors_data_create_no_alloc (const ml_tensors_info_h info,
   /* init null */
   *data = NULL;
 
-  _data = g_new0 (ml_tensors_data_s, 1);
+  _data = (ml_tensors_data_s *) _ml_tensors_cache_acquire
+      (ML_TENSORS_CACHE_DATA, sizeof (ml_tensors_data_s), &reused);
   if (!_data)
     _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
-        "Failed to allocate memory for tensors data with g_new0(). Probably the system is out of memory.");
-
-  g_mutex_init (&_data->lock);
-
-  _info = (ml_tensors_info_s *) info;
-  if (_info != NULL) {
-    if (_info->is_extended)
-      ml_tensors_info_create_extended (&_data->info);
-    else
-      ml_tensors_info_create (&_data->info);
-    ml_tensors_info_clone (_data->info, info);
+        "Failed to allocate memory for tensors data. Probably the system is out of memory.");
+
+  if (!reused)
+    g_mutex_init (&_data->lock);
+
+  if (info != NULL) {
+    /* The data handles created with the same information share it. */
+    status = _ml_tensors_info_share (info, &_data->info);
+    if (status != ML_ERROR_NONE) {
+      _ml_tensors_data_destroy_internal (_data, FALSE);
+      _ml_error_report_return_continue (status,
+          "Failed to get the tensors information for tensors data. Error code: %d",
+          status);
+    }
 
-    G_LOCK_UNLESS_NOLOCK (*_info);
+    /* The shared information is frozen, no need to lock. */
+    _info = (ml_tensors_info_s *) _data->info;
     _data->num_tensors = _info->num_tensors;
     for (i = 0; i < _data->num_tensors; i++) {
       _data->tensors[i].size =
           _ml_tensor_info_get_size (&_info->info[i], _info->is_extended);
       _data->tensors[i].tensor = NULL;
     }
-    G_UNLOCK_UNLESS_NOLOCK (*_info);
   }
 
   *data = _data;
@@ -793,6 +1273,7 @@ int
 _ml_tensors_data_clone_no_alloc (const ml_tensors_data_s * data_src,
     ml_tensors_data_h * data)
 {
+  int nolock;
   int status;
   ml_tensors_data_s *_data;
 
@@ -812,14 +1293,14 @@ _ml_tensors_data_clone_no_alloc (const ml_tensors_data_s * data_src,
         "The call to _ml_tensors_data_create_no_alloc has failed with %d.",
         status);
 
-  G_LOCK_UNLESS_NOLOCK (*_data);
+  G_LOCK_UNLESS_NOLOCK (*_data, nolock);
 
   _data->num_tensors = data_src->num_tensors;
   memcpy (_data->tensors, data_src->tensors,
       sizeof (ml_tensor_data_s) * data_src->num_tensors);
 
   *data = _data;
-  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  G_UNLOCK_UNLESS_NOLOCK (*_data, nolock);
   return ML_ERROR_NONE;
 }
 
@@ -829,6 +1310,7 @@ _ml_tensors_data_clone_no_alloc (const ml_tensors_data_s * data_src,
 int
 ml_tensors_data_clone (const ml_tensors_data_h in, ml_tensors_data_h * out)
 {
+  int nolock;
   int status;
   unsigned int i;
   ml_tensors_data_s *_in, *_out;
@@ -844,7 +1326,7 @@ ml_tensors_data_clone (const ml_tensors_data_h in, ml_tensors_data_h * out)
         "The parameter, out, is NULL. It should be a valid pointer to a space that can hold a ml_tensors_data_h handle. E.g., ml_tensors_data_h out; ml_tensors_data_clone (in, &out);.");
 
   _in = (ml_tensors_data_s *) in;
-  G_LOCK_UNLESS_NOLOCK (*_in);
+  G_LOCK_UNLESS_NOLOCK (*_in, nolock);
 
   status = ml_tensors_data_create (_in->info, out);
   if (status != ML_ERROR_NONE) {
@@ -860,49 +1342,428 @@ ml_tensors_data_clone (const ml_tensors_data_h in, ml_tensors_data_h * out)
   }
 
 error:
-  G_UNLOCK_UNLESS_NOLOCK (*_in);
+  G_UNLOCK_UNLESS_NOLOCK (*_in, nolock);
   return status;
 }
 
 /**
- * @brief Allocates a tensor data frame with the given tensors info. (more info in nnstreamer.h)
+ * @brief All the flags of the policy to allocate the buffers of tensors data.
+ */
+#define ML_TENSORS_ALLOC_POLICY_MASK \
+  (ML_TENSORS_ALLOC_ALIGN_CACHE_LINE | ML_TENSORS_ALLOC_ALIGN_PAGE | \
+   ML_TENSORS_ALLOC_HUGE_PAGE | ML_TENSORS_ALLOC_NO_ZERO_FILL | \
+   ML_TENSORS_ALLOC_CONTIGUOUS)
+
+/**
+ * @brief The size of the cache line to align the buffers.
+ */
+#define ML_TENSORS_CACHE_LINE_SIZE (64U)
+
+/**
+ * @brief The size of the (transparent) huge page. The buffers larger than this are backed by huge pages.
+ */
+#define ML_TENSORS_HUGE_PAGE_SIZE (2U * 1024U * 1024U)
+
+/* The policy to allocate the buffers if the tensors information does not have its own policy. */
+static guint tensors_alloc_policy = ML_TENSORS_ALLOC_DEFAULT;
+
+/**
+ * @brief Sets the policy to allocate the buffers of tensors data. (more info in ml-api-common.h)
  */
 int
-ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h * data)
+ml_tensors_data_set_default_alloc_policy (unsigned int policy)
 {
-  gint status = ML_ERROR_STREAMS_PIPE;
-  ml_tensors_data_s *_data = NULL;
-  gint i;
-  bool valid;
-
   check_feature_state (ML_FEATURE);
 
-  if (info == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, info, is NULL. It should be a valid pointer of ml_tensors_info_h, which is usually created by ml_tensors_info_create().");
-  if (data == NULL)
+  if (policy & ~ML_TENSORS_ALLOC_POLICY_MASK)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, data, is NULL. It should be a valid space to hold a ml_tensors_data_h handle. E.g., ml_tensors_data_h data; ml_tensors_data_create (info, &data);.");
+        "The parameter, policy (0x%x), has unknown flags. It should be the bitwise-or of ml_tensors_alloc_policy_e.",
+        policy);
 
-  status = ml_tensors_info_validate (info, &valid);
-  if (status != ML_ERROR_NONE)
-    _ml_error_report_return_continue (status,
-        "_ml_error_report_return_continue has reported that the parameter, info, is not NULL, but its contents are not valid. The user must provide a valid tensor information with it.");
-  if (!valid)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, info, is not NULL, but its contents are not valid. The user must provide a valid tensor information with it. Probably, there is an entry that is not allocated or dimension/type information not available. The given info should have valid number of tensors, entries of every tensor along with its type and dimension info.");
+  g_atomic_int_set (&tensors_alloc_policy, policy);
+  return ML_ERROR_NONE;
+}
 
-  status =
-      _ml_tensors_data_create_no_alloc (info, (ml_tensors_data_h *) & _data);
+/**
+ * @brief Sets the policy to allocate the buffers of tensors data created with the given tensors information. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_info_set_alloc_policy (ml_tensors_info_h info, unsigned int policy)
+{
+  ml_tensors_info_s *tensors_info;
 
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_return_continue (status,
-        "Failed to allocate tensor data based on the given info with the call to _ml_tensors_data_create_no_alloc (): %d. Check if it's out-of-memory.",
+  check_feature_state (ML_FEATURE);
+
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which is usually created by ml_tensors_info_create().");
+  if (policy & ~ML_TENSORS_ALLOC_POLICY_MASK)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, policy (0x%x), has unknown flags. It should be the bitwise-or of ml_tensors_alloc_policy_e.",
+        policy);
+
+  tensors_info = (ml_tensors_info_s *) info;
+  _ml_tensors_info_return_if_frozen (tensors_info);
+
+  /* This is atomic. No need for locks */
+  tensors_info->alloc_policy = policy;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the policy to allocate the buffers of tensors data created with the given tensors information. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_info_get_alloc_policy (ml_tensors_info_h info, unsigned int *policy)
+{
+  ml_tensors_info_s *tensors_info;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which is usually created by ml_tensors_info_create().");
+  if (!policy)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, policy, is NULL. It should be a valid pointer to store the policy.");
+
+  tensors_info = (ml_tensors_info_s *) info;
+
+  /* This is atomic. No need for locks */
+  *policy = tensors_info->alloc_policy;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to get the allocation policy applied to the given tensors information.
+ */
+static guint
+_ml_tensors_alloc_policy_of (const ml_tensors_info_s * info)
+{
+  guint policy = ML_TENSORS_ALLOC_DEFAULT;
+
+  if (info)
+    policy = info->alloc_policy;
+  if (policy == ML_TENSORS_ALLOC_DEFAULT)
+    policy = g_atomic_int_get (&tensors_alloc_policy);
+
+  return policy;
+}
+
+/**
+ * @brief Internal function to get the alignment of the policy, 0 if the policy has no alignment.
+ */
+static size_t
+_ml_tensors_alloc_alignment (guint policy)
+{
+  long page_size;
+
+  if (policy & ML_TENSORS_ALLOC_ALIGN_PAGE) {
+    page_size = sysconf (_SC_PAGESIZE);
+    return (page_size > 0) ? (size_t) page_size : 4096U;
+  }
+
+  if (policy & ML_TENSORS_ALLOC_ALIGN_CACHE_LINE)
+    return ML_TENSORS_CACHE_LINE_SIZE;
+
+  return 0;
+}
+
+/**
+ * @brief Internal function to allocate a buffer with the given policy.
+ * @note The aligned buffer from posix_memalign() is released with g_free(), which is free() since glib 2.46.
+ */
+static void *
+_ml_tensors_alloc_with_policy (guint policy, size_t size, gboolean zero_fill)
+{
+  size_t align;
+  void *buffer = NULL;
+
+  if (policy & ML_TENSORS_ALLOC_NO_ZERO_FILL)
+    zero_fill = FALSE;
+
+  align = _ml_tensors_alloc_alignment (policy);
+  if ((policy & ML_TENSORS_ALLOC_HUGE_PAGE) &&
+      size >= ML_TENSORS_HUGE_PAGE_SIZE)
+    align = ML_TENSORS_HUGE_PAGE_SIZE;
+
+  if (align == 0)
+    return zero_fill ? g_try_malloc0 (size) : g_try_malloc (size);
+
+  if (posix_memalign (&buffer, align, size) != 0)
+    return NULL;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  /* Ask the kernel to back the buffer with huge pages before touching it. Ignore the error, it is a hint. */
+  if (align == ML_TENSORS_HUGE_PAGE_SIZE)
+    madvise (buffer, size, MADV_HUGEPAGE);
+#endif
+
+  if (zero_fill)
+    memset (buffer, 0, size);
+
+  return buffer;
+}
+
+/**
+ * @brief Allocates a buffer of tensor data with the allocation policy of the given tensors information.
+ */
+void *
+_ml_tensors_data_alloc_buffer (const ml_tensors_info_h info, size_t size,
+    gboolean zero_fill)
+{
+  guint policy = _ml_tensors_alloc_policy_of ((ml_tensors_info_s *) info);
+
+  /* Each tensor has its own buffer. */
+  policy &= ~ML_TENSORS_ALLOC_CONTIGUOUS;
+
+  return _ml_tensors_alloc_with_policy (policy, size, zero_fill);
+}
+
+/**
+ * @brief Internal function to free the single buffer of all the tensors in the data.
+ */
+static int
+_ml_tensors_data_free_block (void *handle, void *user_data)
+{
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) handle;
+  guint i;
+
+  g_free (user_data);
+
+  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++)
+    _data->tensors[i].tensor = NULL;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to allocate a single buffer for all the tensors in the data.
+ * @details The offset of each tensor is aligned to the alignment of the policy, at least to the cache line.
+ */
+static int
+_ml_tensors_data_alloc_block (ml_tensors_data_s * _data, guint policy)
+{
+  size_t offsets[ML_TENSOR_SIZE_LIMIT];
+  size_t align, total = 0;
+  guint8 *block;
+  guint i;
+
+  align = MAX (_ml_tensors_alloc_alignment (policy),
+      ML_TENSORS_CACHE_LINE_SIZE);
+
+  for (i = 0; i < _data->num_tensors; i++) {
+    offsets[i] = total;
+    total += _data->tensors[i].size;
+    if (i + 1 < _data->num_tensors)
+      total = (total + align - 1) / align * align;
+  }
+
+  block = (guint8 *) _ml_tensors_alloc_with_policy (policy |
+      ML_TENSORS_ALLOC_ALIGN_CACHE_LINE, total, TRUE);
+  if (block == NULL)
+    return ML_ERROR_OUT_OF_MEMORY;
+
+  for (i = 0; i < _data->num_tensors; i++)
+    _data->tensors[i].tensor = block + offsets[i];
+
+  _data->destroy = _ml_tensors_data_free_block;
+  _data->user_data = block;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the single buffer of all the tensors if the data is allocated with the contiguous layout.
+ */
+gboolean
+_ml_tensors_data_get_block (const ml_tensors_data_s * data, void **block,
+    size_t *block_size)
+{
+  guint last;
+
+  if (!data || data->destroy != _ml_tensors_data_free_block ||
+      data->num_tensors == 0)
+    return FALSE;
+
+  last = data->num_tensors - 1;
+  *block = data->user_data;
+  *block_size = ((guint8 *) data->tensors[last].tensor -
+      (guint8 *) data->user_data) + data->tensors[last].size;
+  return TRUE;
+}
+
+/**
+ * @brief Gets the single buffer of all the tensors in the data with the contiguous layout. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_get_contiguous_buffer (ml_tensors_data_h data,
+    void **raw_data, size_t *data_size)
+{
+  int nolock;
+  ml_tensors_data_s *_data;
+  gboolean contiguous;
+
+  check_feature_state (ML_FEATURE);
+
+  if (data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (raw_data == NULL || data_size == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, raw_data or data_size, is NULL. It should be a valid pointer to get the buffer and its size.");
+
+  _data = (ml_tensors_data_s *) data;
+  G_LOCK_UNLESS_NOLOCK (*_data, nolock);
+  contiguous = _ml_tensors_data_get_block (_data, raw_data, data_size);
+  G_UNLOCK_UNLESS_NOLOCK (*_data, nolock);
+
+  if (!contiguous)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is not allocated with the contiguous layout. Set ML_TENSORS_ALLOC_CONTIGUOUS to the allocation policy of the tensors information to create the data.");
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Binds the handle to the calling thread and stops locking it, or releases the handle to be shared by the threads.
+ * @note Binding is valid only while no other thread can reach the handle. A call from another thread,
+ *       which has started before binding (e.g., waiting for the lock), unlocks the handle as it has locked,
+ *       but it is not serialized with the owner thread any more.
+ */
+static int
+_ml_tensors_set_single_owner (GMutex * lock, int *nolock, GThread ** owner,
+    bool single_owner)
+{
+  GThread *self = g_thread_self ();
+
+  if (single_owner) {
+    if (*owner == self)
+      return ML_ERROR_NONE;
+
+    g_mutex_lock (lock);
+    if (*owner != NULL) {
+      g_mutex_unlock (lock);
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The handle is owned by another thread. The owner thread should release it first.");
+    }
+
+    *owner = self;
+    g_atomic_int_set (nolock, 1);
+    g_mutex_unlock (lock);
+  } else {
+    if (*owner == NULL)
+      return ML_ERROR_NONE;
+    if (*owner != self)
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The handle is owned by another thread. Only the owner thread can release it.");
+
+    /* Nothing else accesses the handle, set the lock back for the other threads. */
+    *owner = NULL;
+    g_atomic_int_set (nolock, 0);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Sets the tensors information to be used only in the calling thread. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_info_set_single_owner (ml_tensors_info_h info, bool single_owner)
+{
+  ml_tensors_info_s *tensors_info;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which is usually created by ml_tensors_info_create().");
+
+  tensors_info = (ml_tensors_info_s *) info;
+  _ml_tensors_info_return_if_frozen (tensors_info);
+
+  return _ml_tensors_set_single_owner (&tensors_info->lock,
+      &tensors_info->nolock, &tensors_info->owner, single_owner);
+}
+
+/**
+ * @brief Sets the tensors data to be used only in the calling thread. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_set_single_owner (ml_tensors_data_h data, bool single_owner)
+{
+  ml_tensors_data_s *_data;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!data)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+
+  _data = (ml_tensors_data_s *) data;
+
+  return _ml_tensors_set_single_owner (&_data->lock, &_data->nolock,
+      &_data->owner, single_owner);
+}
+
+/**
+ * @brief Allocates a tensor data frame with the given tensors info. (more info in nnstreamer.h)
+ */
+int
+ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h * data)
+{
+  gint status = ML_ERROR_STREAMS_PIPE;
+  ml_tensors_data_s *_data = NULL;
+  guint policy;
+  gint i;
+  bool valid;
+
+  check_feature_state (ML_FEATURE);
+
+  if (info == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid pointer of ml_tensors_info_h, which is usually created by ml_tensors_info_create().");
+  if (data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid space to hold a ml_tensors_data_h handle. E.g., ml_tensors_data_h data; ml_tensors_data_create (info, &data);.");
+
+  status = ml_tensors_info_validate (info, &valid);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "_ml_error_report_return_continue has reported that the parameter, info, is not NULL, but its contents are not valid. The user must provide a valid tensor information with it.");
+  if (!valid)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is not NULL, but its contents are not valid. The user must provide a valid tensor information with it. Probably, there is an entry that is not allocated or dimension/type information not available. The given info should have valid number of tensors, entries of every tensor along with its type and dimension info.");
+
+  status =
+      _ml_tensors_data_create_no_alloc (info, (ml_tensors_data_h *) & _data);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_return_continue (status,
+        "Failed to allocate tensor data based on the given info with the call to _ml_tensors_data_create_no_alloc (): %d. Check if it's out-of-memory.",
         status);
   }
 
+  /* The data created with the single-owner information in its owner thread is also confined to the thread. */
+  if (((ml_tensors_info_s *) info)->owner == g_thread_self ()) {
+    _data->owner = g_thread_self ();
+    _data->nolock = 1;
+  }
+
+  policy = _ml_tensors_alloc_policy_of ((ml_tensors_info_s *) _data->info);
+  if (policy & ML_TENSORS_ALLOC_CONTIGUOUS) {
+    if (_ml_tensors_data_alloc_block (_data, policy) != ML_ERROR_NONE)
+      goto failed_oom;
+
+    *data = _data;
+    return ML_ERROR_NONE;
+  }
+
   for (i = 0; i < _data->num_tensors; i++) {
-    _data->tensors[i].tensor = g_malloc0 (_data->tensors[i].size);
+    _data->tensors[i].tensor = _ml_tensors_data_alloc_buffer (_data->info,
+        _data->tensors[i].size, TRUE);
     if (_data->tensors[i].tensor == NULL) {
       goto failed_oom;
     }
@@ -925,6 +1786,7 @@ int
 ml_tensors_data_get_tensor_data (ml_tensors_data_h data, unsigned int index,
     void **raw_data, size_t *data_size)
 {
+  int nolock;
   ml_tensors_data_s *_data;
   int status = ML_ERROR_NONE;
 
@@ -941,7 +1803,7 @@ ml_tensors_data_get_tensor_data (ml_tensors_data_h data, unsigned int index,
         "The parameter, data_size, is NULL. It should be a valid, non-NULL, size_t * pointer, which is supposed to point to the size of returning raw_data after the call.");
 
   _data = (ml_tensors_data_s *) data;
-  G_LOCK_UNLESS_NOLOCK (*_data);
+  G_LOCK_UNLESS_NOLOCK (*_data, nolock);
 
   if (_data->num_tensors <= index) {
     _ml_error_report
@@ -955,7 +1817,7 @@ ml_tensors_data_get_tensor_data (ml_tensors_data_h data, unsigned int index,
   *data_size = _data->tensors[index].size;
 
 report:
-  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  G_UNLOCK_UNLESS_NOLOCK (*_data, nolock);
   return status;
 }
 
@@ -966,6 +1828,7 @@ int
 ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index,
     const void *raw_data, const size_t data_size)
 {
+  int nolock;
   ml_tensors_data_s *_data;
   int status = ML_ERROR_NONE;
 
@@ -980,7 +1843,7 @@ ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index,
         index);
 
   _data = (ml_tensors_data_s *) data;
-  G_LOCK_UNLESS_NOLOCK (*_data);
+  G_LOCK_UNLESS_NOLOCK (*_data, nolock);
 
   if (_data->num_tensors <= index) {
     _ml_error_report
@@ -1002,7 +1865,7 @@ ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index,
     memcpy (_data->tensors[index].tensor, raw_data, data_size);
 
 report:
-  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  G_UNLOCK_UNLESS_NOLOCK (*_data, nolock);
   return status;
 }
 
@@ -1012,6 +1875,7 @@ report:
 int
 ml_tensors_info_clone (ml_tensors_info_h dest, const ml_tensors_info_h src)
 {
+  int dest_info_nolock, src_info_nolock;
   ml_tensors_info_s *dest_info, *src_info;
   guint i, j;
   bool valid;
@@ -1028,9 +1892,10 @@ ml_tensors_info_clone (ml_tensors_info_h dest, const ml_tensors_info_h src)
   if (!src_info)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, src, is NULL. It should be a handle (ml_tensors_info_h) with valid data.");
+  _ml_tensors_info_return_if_frozen (dest_info);
 
-  G_LOCK_UNLESS_NOLOCK (*dest_info);
-  G_LOCK_UNLESS_NOLOCK (*src_info);
+  G_LOCK_UNLESS_NOLOCK (*dest_info, dest_info_nolock);
+  G_LOCK_UNLESS_NOLOCK (*src_info, src_info_nolock);
 
   status = _ml_tensors_info_validate_nolock (src_info, &valid);
   if (status != ML_ERROR_NONE) {
@@ -1045,15 +1910,19 @@ ml_tensors_info_clone (ml_tensors_info_h dest, const ml_tensors_info_h src)
     goto done;
   }
 
+  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++)
+    g_free (dest_info->info[i].quant);
   _ml_tensors_info_initialize (dest_info);
 
   dest_info->num_tensors = src_info->num_tensors;
   dest_info->is_extended = src_info->is_extended;
+  dest_info->alloc_policy = src_info->alloc_policy;
 
   for (i = 0; i < dest_info->num_tensors; i++) {
     dest_info->info[i].name =
         (src_info->info[i].name) ? g_strdup (src_info->info[i].name) : NULL;
     dest_info->info[i].type = src_info->info[i].type;
+    dest_info->info[i].quant = _ml_tensor_quant_dup (src_info->info[i].quant);
 
     for (j = 0; j < ML_TENSOR_RANK_LIMIT; j++) {
       dest_info->info[i].dimension[j] = src_info->info[i].dimension[j];
@@ -1061,12 +1930,2508 @@ ml_tensors_info_clone (ml_tensors_info_h dest, const ml_tensors_info_h src)
   }
 
 done:
-  G_UNLOCK_UNLESS_NOLOCK (*src_info);
-  G_UNLOCK_UNLESS_NOLOCK (*dest_info);
+  G_UNLOCK_UNLESS_NOLOCK (*src_info, src_info_nolock);
+  G_UNLOCK_UNLESS_NOLOCK (*dest_info, dest_info_nolock);
 
   return status;
 }
 
+/**
+ * @brief The kernel to convert the elements of a tensor, dest[i] = src[i] * scale + offset.
+ * @details The quantization kernels compute dest[i] = round (src[i] / scale) + offset, where offset is the integer zero point.
+ */
+typedef void (*ml_tensors_convert_kernel) (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset);
+
+/**
+ * @brief The kernel to split the packed 3-channel uint8 elements into the planes, d[c][i] = src[i * 3 + c].
+ */
+typedef void (*ml_tensors_deinterleave_kernel) (const guint8 * src,
+    guint8 * const *d, gsize count);
+
+/**
+ * @brief The kernel to pack the 3 planes of uint8 elements, dest[i * 3 + c] = s[c][i].
+ */
+typedef void (*ml_tensors_interleave_kernel) (const guint8 * const *s,
+    guint8 * dest, gsize count);
+
+/**
+ * @brief The kernels for the common conversions, implemented with an instruction set.
+ */
+typedef struct
+{
+  const gchar *isa; /**< The name of the instruction set */
+  ml_tensors_convert_kernel u8_to_f32;
+  ml_tensors_convert_kernel f16_to_f32;
+  ml_tensors_convert_kernel f32_to_f32;
+  ml_tensors_convert_kernel f32_to_u8;
+  ml_tensors_convert_kernel i8_to_f32;
+  ml_tensors_convert_kernel f32_to_i8;
+  ml_tensors_convert_kernel f32_to_u8_quant;
+  ml_tensors_convert_kernel f32_to_i8_quant;
+  ml_tensors_deinterleave_kernel u8x3_to_planar;
+  ml_tensors_interleave_kernel planar_to_u8x3;
+} ml_tensors_convert_kernels_s;
+
+/**
+ * @brief Internal function to get the byte size of an element of the given type.
+ */
+static gsize
+_ml_tensors_convert_element_size (ml_tensor_type_e type)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_INT8:
+    case ML_TENSOR_TYPE_UINT8:
+      return 1;
+    case ML_TENSOR_TYPE_INT16:
+    case ML_TENSOR_TYPE_UINT16:
+    case ML_TENSOR_TYPE_FLOAT16:
+      return 2;
+    case ML_TENSOR_TYPE_INT32:
+    case ML_TENSOR_TYPE_UINT32:
+    case ML_TENSOR_TYPE_FLOAT32:
+      return 4;
+    case ML_TENSOR_TYPE_FLOAT64:
+    case ML_TENSOR_TYPE_INT64:
+    case ML_TENSOR_TYPE_UINT64:
+      return 8;
+    default:
+      break;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Internal function to convert IEEE 754 half precision to single precision.
+ */
+static gfloat
+_ml_tensors_convert_half_to_float (guint16 h)
+{
+  union
+  {
+    guint32 u;
+    gfloat f;
+  } v;
+  guint32 sign = (guint32) (h & 0x8000U) << 16;
+  guint32 exp = (h >> 10) & 0x1fU;
+  guint32 mant = h & 0x3ffU;
+
+  if (exp == 0x1fU) {
+    /* infinity or nan */
+    v.u = sign | 0x7f800000U | (mant << 13);
+  } else if (exp != 0) {
+    v.u = sign | ((exp + 112U) << 23) | (mant << 13);
+  } else {
+    /* zero or subnormal, mant * 2^-24 */
+    v.f = (gfloat) mant * (1.0f / 16777216.0f);
+    v.u |= sign;
+  }
+
+  return v.f;
+}
+
+/**
+ * @brief Internal function to convert single precision to IEEE 754 half precision, rounding to the nearest even.
+ */
+static guint16
+_ml_tensors_convert_float_to_half (gfloat f)
+{
+  union
+  {
+    guint32 u;
+    gfloat f;
+  } v;
+  guint32 sign, exp, mant, h, rem, half, shift;
+
+  v.f = f;
+  sign = (v.u >> 16) & 0x8000U;
+  exp = (v.u >> 23) & 0xffU;
+  mant = v.u & 0x7fffffU;
+
+  if (exp == 0xffU)
+    return (guint16) (sign | 0x7c00U | (mant ? 0x200U : 0));
+  if (exp > 142U)
+    return (guint16) (sign | 0x7c00U);
+
+  if (exp < 113U) {
+    /* subnormal in half precision */
+    if (exp < 102U)
+      return (guint16) sign;
+
+    mant |= 0x800000U;
+    shift = 126U - exp;
+    h = mant >> shift;
+    rem = mant & ((1U << shift) - 1U);
+    half = 1U << (shift - 1U);
+  } else {
+    h = ((exp - 112U) << 10) | (mant >> 13);
+    rem = mant & 0x1fffU;
+    half = 0x1000U;
+  }
+
+  /* the carry may overflow to the exponent, which is the expected result. */
+  if (rem > half || (rem == half && (h & 1U)))
+    h++;
+
+  return (guint16) (sign | h);
+}
+
+/**
+ * @brief Internal function to round the value to the nearest integer (ties to even), saturating to the range of 64-bit integer.
+ */
+static gint64
+_ml_tensors_convert_round (gdouble v)
+{
+  gint64 i;
+  gdouble frac;
+
+  if (v != v)
+    return 0;
+  if (v <= (gdouble) G_MININT64)
+    return G_MININT64;
+  if (v >= (gdouble) G_MAXINT64)
+    return G_MAXINT64;
+
+  i = (gint64) v;
+  frac = v - (gdouble) i;
+  if (frac > 0.5 || (frac == 0.5 && (i & 1)))
+    i++;
+  else if (frac < -0.5 || (frac == -0.5 && (i & 1)))
+    i--;
+
+  return i;
+}
+
+/**
+ * @brief Internal function to round the value to the nearest unsigned 64-bit integer (ties to even), with saturation.
+ */
+static guint64
+_ml_tensors_convert_round_unsigned (gdouble v)
+{
+  if (!(v > 0.0))
+    return 0;
+  if (v >= 18446744073709551616.0)
+    return G_MAXUINT64;
+  if (v >= 9223372036854775808.0)
+    return (guint64) v;
+
+  return (guint64) _ml_tensors_convert_round (v);
+}
+
+/**
+ * @brief Internal function to round the value to uint8 (ties to even), with saturation.
+ */
+static guint8
+_ml_tensors_convert_round_u8 (gfloat v)
+{
+  guint n;
+  gfloat frac;
+
+  if (!(v > 0.0f))
+    return 0;
+  if (v >= 255.0f)
+    return 255;
+
+  n = (guint) v;
+  frac = v - (gfloat) n;
+  if (frac > 0.5f || (frac == 0.5f && (n & 1U)))
+    n++;
+
+  return (guint8) n;
+}
+
+/**
+ * @brief Internal function to round the value to int8 (ties to even), with saturation.
+ */
+static gint8
+_ml_tensors_convert_round_i8 (gfloat v)
+{
+  gint n;
+  gfloat frac;
+
+  if (v != v)
+    return 0;
+  if (v <= -128.0f)
+    return G_MININT8;
+  if (v >= 127.0f)
+    return G_MAXINT8;
+
+  n = (gint) v;
+  frac = v - (gfloat) n;
+  if (frac > 0.5f || (frac == 0.5f && (n & 1)))
+    n++;
+  else if (frac < -0.5f || (frac == -0.5f && (n & 1)))
+    n--;
+
+  return (gint8) n;
+}
+
+/**
+ * @brief Internal function to get an element of the integer type.
+ * @note The element of uint64 larger than the max of int64 is saturated.
+ */
+static gint64
+_ml_tensors_convert_get_int (ml_tensor_type_e type, const void *buf, gsize i)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_INT8:
+      return ((const gint8 *) buf)[i];
+    case ML_TENSOR_TYPE_UINT8:
+      return ((const guint8 *) buf)[i];
+    case ML_TENSOR_TYPE_INT16:
+      return ((const gint16 *) buf)[i];
+    case ML_TENSOR_TYPE_UINT16:
+      return ((const guint16 *) buf)[i];
+    case ML_TENSOR_TYPE_INT32:
+      return ((const gint32 *) buf)[i];
+    case ML_TENSOR_TYPE_UINT32:
+      return ((const guint32 *) buf)[i];
+    case ML_TENSOR_TYPE_INT64:
+      return ((const gint64 *) buf)[i];
+    case ML_TENSOR_TYPE_UINT64:
+      return (gint64) MIN (((const guint64 *) buf)[i], (guint64) G_MAXINT64);
+    default:
+      break;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Internal function to set an element of the integer type, with saturation.
+ */
+static void
+_ml_tensors_convert_set_int (ml_tensor_type_e type, void *buf, gsize i,
+    gint64 v)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_INT8:
+      ((gint8 *) buf)[i] = (gint8) CLAMP (v, G_MININT8, G_MAXINT8);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      ((guint8 *) buf)[i] = (guint8) CLAMP (v, 0, G_MAXUINT8);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      ((gint16 *) buf)[i] = (gint16) CLAMP (v, G_MININT16, G_MAXINT16);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      ((guint16 *) buf)[i] = (guint16) CLAMP (v, 0, G_MAXUINT16);
+      break;
+    case ML_TENSOR_TYPE_INT32:
+      ((gint32 *) buf)[i] = (gint32) CLAMP (v, G_MININT32, G_MAXINT32);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      ((guint32 *) buf)[i] = (guint32) CLAMP (v, 0, (gint64) G_MAXUINT32);
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      ((gint64 *) buf)[i] = v;
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      ((guint64 *) buf)[i] = (guint64) MAX (v, 0);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to get an element as double precision.
+ */
+static gdouble
+_ml_tensors_convert_get (ml_tensor_type_e type, const void *buf, gsize i)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_FLOAT64:
+      return ((const gdouble *) buf)[i];
+    case ML_TENSOR_TYPE_FLOAT32:
+      return ((const gfloat *) buf)[i];
+    case ML_TENSOR_TYPE_FLOAT16:
+      return _ml_tensors_convert_half_to_float (((const guint16 *) buf)[i]);
+    case ML_TENSOR_TYPE_UINT64:
+      return (gdouble) ((const guint64 *) buf)[i];
+    default:
+      break;
+  }
+
+  return (gdouble) _ml_tensors_convert_get_int (type, buf, i);
+}
+
+/**
+ * @brief Internal function to set an element from double precision, with rounding and saturation for the integer types.
+ */
+static void
+_ml_tensors_convert_set (ml_tensor_type_e type, void *buf, gsize i,
+    gdouble v)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_FLOAT64:
+      ((gdouble *) buf)[i] = v;
+      break;
+    case ML_TENSOR_TYPE_FLOAT32:
+      ((gfloat *) buf)[i] = (gfloat) v;
+      break;
+    case ML_TENSOR_TYPE_FLOAT16:
+      ((guint16 *) buf)[i] = _ml_tensors_convert_float_to_half ((gfloat) v);
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      ((guint64 *) buf)[i] = _ml_tensors_convert_round_unsigned (v);
+      break;
+    default:
+      _ml_tensors_convert_set_int (type, buf, i, _ml_tensors_convert_round (v));
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to check the type is an integer type.
+ */
+static gboolean
+_ml_tensors_convert_is_integer (ml_tensor_type_e type)
+{
+  return (type != ML_TENSOR_TYPE_FLOAT64 && type != ML_TENSOR_TYPE_FLOAT32 &&
+      type != ML_TENSOR_TYPE_FLOAT16);
+}
+
+/**
+ * @brief Internal function to convert the integers, without the loss of 64-bit values.
+ */
+static void
+_ml_tensors_convert_integer (ml_tensor_type_e src_type, const void *src,
+    ml_tensor_type_e dest_type, void *dest, gsize count)
+{
+  gsize i;
+  guint64 u;
+
+  if (src_type == ML_TENSOR_TYPE_UINT64 && dest_type == ML_TENSOR_TYPE_UINT64) {
+    memmove (dest, src, count * sizeof (guint64));
+    return;
+  }
+
+  for (i = 0; i < count; i++) {
+    if (src_type == ML_TENSOR_TYPE_UINT64 && dest_type == ML_TENSOR_TYPE_INT64) {
+      u = ((const guint64 *) src)[i];
+      ((gint64 *) dest)[i] = (gint64) MIN (u, (guint64) G_MAXINT64);
+    } else {
+      _ml_tensors_convert_set_int (dest_type, dest, i,
+          _ml_tensors_convert_get_int (src_type, src, i));
+    }
+  }
+}
+
+/**
+ * @brief Scalar kernel, uint8 to float32.
+ */
+static void
+_ml_tensors_convert_u8_to_f32_scalar (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const guint8 *s = (const guint8 *) src;
+  gfloat *d = (gfloat *) dest;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = (gfloat) s[i] * scale + offset;
+}
+
+/**
+ * @brief Scalar kernel, float16 to float32.
+ */
+static void
+_ml_tensors_convert_f16_to_f32_scalar (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dest;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = _ml_tensors_convert_half_to_float (s[i]) * scale + offset;
+}
+
+/**
+ * @brief Scalar kernel, float32 to float32.
+ */
+static void
+_ml_tensors_convert_f32_to_f32_scalar (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gfloat *d = (gfloat *) dest;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = s[i] * scale + offset;
+}
+
+/**
+ * @brief Scalar kernel, float32 to uint8.
+ */
+static void
+_ml_tensors_convert_f32_to_u8_scalar (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dest;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = _ml_tensors_convert_round_u8 (s[i] * scale + offset);
+}
+
+/**
+ * @brief Scalar kernel, int8 to float32.
+ */
+static void
+_ml_tensors_convert_i8_to_f32_scalar (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gint8 *s = (const gint8 *) src;
+  gfloat *d = (gfloat *) dest;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = (gfloat) s[i] * scale + offset;
+}
+
+/**
+ * @brief Scalar kernel, float32 to int8.
+ */
+static void
+_ml_tensors_convert_f32_to_i8_scalar (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dest;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = _ml_tensors_convert_round_i8 (s[i] * scale + offset);
+}
+
+/**
+ * @brief The limit of the quotient to quantize with the SIMD kernels.
+ * @details The quotient is clamped not to overflow the 32-bit integer, which saturates uint8 and int8 anyway with the zero point.
+ */
+#define ML_TENSORS_QUANT_LIMIT (16777216.0f)
+
+/**
+ * @brief Internal function to quantize the value, round (v / scale) + zero_point (ties to even).
+ * @details The value is divided in single precision, as the SIMD kernels do, unless it is float64. nan is quantized to the zero point.
+ */
+static gint64
+_ml_tensors_convert_quantize_value (gdouble v, gboolean single, gfloat scale,
+    gint32 zero_point)
+{
+  gdouble q;
+
+  q = single ? (gdouble) ((gfloat) v / scale) : v / (gdouble) scale;
+  if (q != q)
+    q = 0.0;
+
+  /* not to overflow with the zero point */
+  q = CLAMP (q, -4611686018427387904.0, 4611686018427387904.0);
+
+  return _ml_tensors_convert_round (q) + zero_point;
+}
+
+/**
+ * @brief Scalar kernel, quantize float32 to uint8.
+ */
+static void
+_ml_tensors_convert_f32_to_u8_quant_scalar (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dest;
+  gint32 zero_point = (gint32) offset;
+  gint64 q;
+  gsize i;
+
+  for (i = 0; i < count; i++) {
+    q = _ml_tensors_convert_quantize_value (s[i], TRUE, scale, zero_point);
+    d[i] = (guint8) CLAMP (q, 0, G_MAXUINT8);
+  }
+}
+
+/**
+ * @brief Scalar kernel, quantize float32 to int8.
+ */
+static void
+_ml_tensors_convert_f32_to_i8_quant_scalar (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dest;
+  gint32 zero_point = (gint32) offset;
+  gint64 q;
+  gsize i;
+
+  for (i = 0; i < count; i++) {
+    q = _ml_tensors_convert_quantize_value (s[i], TRUE, scale, zero_point);
+    d[i] = (gint8) CLAMP (q, G_MININT8, G_MAXINT8);
+  }
+}
+
+/**
+ * @brief Scalar kernel, packed 3-channel uint8 to planes.
+ */
+static void
+_ml_tensors_deinterleave_u8x3_scalar (const guint8 * src, guint8 * const *d,
+    gsize count)
+{
+  gsize i;
+
+  for (i = 0; i < count; i++) {
+    d[0][i] = src[i * 3];
+    d[1][i] = src[i * 3 + 1];
+    d[2][i] = src[i * 3 + 2];
+  }
+}
+
+/**
+ * @brief Scalar kernel, 3 planes of uint8 to packed 3-channel.
+ */
+static void
+_ml_tensors_interleave_u8x3_scalar (const guint8 * const *s, guint8 * dest,
+    gsize count)
+{
+  gsize i;
+
+  for (i = 0; i < count; i++) {
+    dest[i * 3] = s[0][i];
+    dest[i * 3 + 1] = s[1][i];
+    dest[i * 3 + 2] = s[2][i];
+  }
+}
+
+static const ml_tensors_convert_kernels_s tensors_convert_scalar = {
+  "scalar",
+  _ml_tensors_convert_u8_to_f32_scalar,
+  _ml_tensors_convert_f16_to_f32_scalar,
+  _ml_tensors_convert_f32_to_f32_scalar,
+  _ml_tensors_convert_f32_to_u8_scalar,
+  _ml_tensors_convert_i8_to_f32_scalar,
+  _ml_tensors_convert_f32_to_i8_scalar,
+  _ml_tensors_convert_f32_to_u8_quant_scalar,
+  _ml_tensors_convert_f32_to_i8_quant_scalar,
+  _ml_tensors_deinterleave_u8x3_scalar,
+  _ml_tensors_interleave_u8x3_scalar
+};
+
+#if defined(ML_TENSORS_CONVERT_X86)
+/**
+ * @brief SSE2 kernel, uint8 to float32.
+ */
+static void
+_ml_tensors_convert_u8_to_f32_sse2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const guint8 *s = (const guint8 *) src;
+  gfloat *d = (gfloat *) dest;
+  __m128 vscale = _mm_set1_ps (scale);
+  __m128 voffset = _mm_set1_ps (offset);
+  __m128i zero = _mm_setzero_si128 ();
+  __m128i v8, v16;
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v8 = _mm_loadu_si128 ((const __m128i *) (s + i));
+
+    v16 = _mm_unpacklo_epi8 (v8, zero);
+    _mm_storeu_ps (d + i, _mm_add_ps (_mm_mul_ps (_mm_cvtepi32_ps
+                (_mm_unpacklo_epi16 (v16, zero)), vscale), voffset));
+    _mm_storeu_ps (d + i + 4, _mm_add_ps (_mm_mul_ps (_mm_cvtepi32_ps
+                (_mm_unpackhi_epi16 (v16, zero)), vscale), voffset));
+
+    v16 = _mm_unpackhi_epi8 (v8, zero);
+    _mm_storeu_ps (d + i + 8, _mm_add_ps (_mm_mul_ps (_mm_cvtepi32_ps
+                (_mm_unpacklo_epi16 (v16, zero)), vscale), voffset));
+    _mm_storeu_ps (d + i + 12, _mm_add_ps (_mm_mul_ps (_mm_cvtepi32_ps
+                (_mm_unpackhi_epi16 (v16, zero)), vscale), voffset));
+  }
+
+  _ml_tensors_convert_u8_to_f32_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief SSE2 kernel, float32 to float32.
+ */
+static void
+_ml_tensors_convert_f32_to_f32_sse2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gfloat *d = (gfloat *) dest;
+  __m128 vscale = _mm_set1_ps (scale);
+  __m128 voffset = _mm_set1_ps (offset);
+  gsize i;
+
+  for (i = 0; i + 8 <= count; i += 8) {
+    _mm_storeu_ps (d + i, _mm_add_ps (_mm_mul_ps (_mm_loadu_ps (s + i),
+                vscale), voffset));
+    _mm_storeu_ps (d + i + 4, _mm_add_ps (_mm_mul_ps (_mm_loadu_ps (s + i +
+                    4), vscale), voffset));
+  }
+
+  _ml_tensors_convert_f32_to_f32_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief SSE2 kernel, float32 to uint8.
+ * @note The values are clamped before the conversion, max(nan, 0) is 0.
+ */
+static void
+_ml_tensors_convert_f32_to_u8_sse2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dest;
+  __m128 vscale = _mm_set1_ps (scale);
+  __m128 voffset = _mm_set1_ps (offset);
+  __m128 vmin = _mm_setzero_ps ();
+  __m128 vmax = _mm_set1_ps (255.0f);
+  __m128i v[4];
+  gsize i, j;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (j = 0; j < 4; j++) {
+      v[j] = _mm_cvtps_epi32 (_mm_min_ps (_mm_max_ps (_mm_add_ps (_mm_mul_ps
+                      (_mm_loadu_ps (s + i + j * 4), vscale), voffset), vmin),
+              vmax));
+    }
+
+    _mm_storeu_si128 ((__m128i *) (d + i),
+        _mm_packus_epi16 (_mm_packs_epi32 (v[0], v[1]),
+            _mm_packs_epi32 (v[2], v[3])));
+  }
+
+  _ml_tensors_convert_f32_to_u8_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief SSE2 kernel, int8 to float32.
+ * @note The bytes are sign-extended by unpacking each to the high byte and shifting right arithmetically.
+ */
+static void
+_ml_tensors_convert_i8_to_f32_sse2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gint8 *s = (const gint8 *) src;
+  gfloat *d = (gfloat *) dest;
+  __m128 vscale = _mm_set1_ps (scale);
+  __m128 voffset = _mm_set1_ps (offset);
+  __m128i v8, v16[2], v32;
+  gsize i, j;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v8 = _mm_loadu_si128 ((const __m128i *) (s + i));
+    v16[0] = _mm_srai_epi16 (_mm_unpacklo_epi8 (v8, v8), 8);
+    v16[1] = _mm_srai_epi16 (_mm_unpackhi_epi8 (v8, v8), 8);
+
+    for (j = 0; j < 2; j++) {
+      v32 = _mm_srai_epi32 (_mm_unpacklo_epi16 (v16[j], v16[j]), 16);
+      _mm_storeu_ps (d + i + j * 8, _mm_add_ps (_mm_mul_ps (_mm_cvtepi32_ps
+                  (v32), vscale), voffset));
+      v32 = _mm_srai_epi32 (_mm_unpackhi_epi16 (v16[j], v16[j]), 16);
+      _mm_storeu_ps (d + i + j * 8 + 4, _mm_add_ps (_mm_mul_ps
+              (_mm_cvtepi32_ps (v32), vscale), voffset));
+    }
+  }
+
+  _ml_tensors_convert_i8_to_f32_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief SSE2 kernel, float32 to int8.
+ * @note nan is masked to 0 before the values are clamped.
+ */
+static void
+_ml_tensors_convert_f32_to_i8_sse2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dest;
+  __m128 vscale = _mm_set1_ps (scale);
+  __m128 voffset = _mm_set1_ps (offset);
+  __m128 vmin = _mm_set1_ps (-128.0f);
+  __m128 vmax = _mm_set1_ps (127.0f);
+  __m128 f;
+  __m128i v[4];
+  gsize i, j;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (j = 0; j < 4; j++) {
+      f = _mm_add_ps (_mm_mul_ps (_mm_loadu_ps (s + i + j * 4), vscale),
+          voffset);
+      f = _mm_and_ps (f, _mm_cmpord_ps (f, f));
+      v[j] = _mm_cvtps_epi32 (_mm_min_ps (_mm_max_ps (f, vmin), vmax));
+    }
+
+    _mm_storeu_si128 ((__m128i *) (d + i),
+        _mm_packs_epi16 (_mm_packs_epi32 (v[0], v[1]),
+            _mm_packs_epi32 (v[2], v[3])));
+  }
+
+  _ml_tensors_convert_f32_to_i8_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief SSE2 kernel, quantize float32 to uint8.
+ * @note nan is masked to 0, and the zero point is added after rounding, then packed with saturation.
+ */
+static void
+_ml_tensors_convert_f32_to_u8_quant_sse2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dest;
+  __m128 vscale = _mm_set1_ps (scale);
+  __m128 vmin = _mm_set1_ps (-ML_TENSORS_QUANT_LIMIT);
+  __m128 vmax = _mm_set1_ps (ML_TENSORS_QUANT_LIMIT);
+  __m128i vzero = _mm_set1_epi32 ((gint32) offset);
+  __m128 f;
+  __m128i v[4];
+  gsize i, j;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (j = 0; j < 4; j++) {
+      f = _mm_div_ps (_mm_loadu_ps (s + i + j * 4), vscale);
+      f = _mm_and_ps (f, _mm_cmpord_ps (f, f));
+      v[j] = _mm_add_epi32 (_mm_cvtps_epi32 (_mm_min_ps (_mm_max_ps (f,
+                      vmin), vmax)), vzero);
+    }
+
+    _mm_storeu_si128 ((__m128i *) (d + i),
+        _mm_packus_epi16 (_mm_packs_epi32 (v[0], v[1]),
+            _mm_packs_epi32 (v[2], v[3])));
+  }
+
+  _ml_tensors_convert_f32_to_u8_quant_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief SSE2 kernel, quantize float32 to int8.
+ * @note nan is masked to 0, and the zero point is added after rounding, then packed with saturation.
+ */
+static void
+_ml_tensors_convert_f32_to_i8_quant_sse2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dest;
+  __m128 vscale = _mm_set1_ps (scale);
+  __m128 vmin = _mm_set1_ps (-ML_TENSORS_QUANT_LIMIT);
+  __m128 vmax = _mm_set1_ps (ML_TENSORS_QUANT_LIMIT);
+  __m128i vzero = _mm_set1_epi32 ((gint32) offset);
+  __m128 f;
+  __m128i v[4];
+  gsize i, j;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (j = 0; j < 4; j++) {
+      f = _mm_div_ps (_mm_loadu_ps (s + i + j * 4), vscale);
+      f = _mm_and_ps (f, _mm_cmpord_ps (f, f));
+      v[j] = _mm_add_epi32 (_mm_cvtps_epi32 (_mm_min_ps (_mm_max_ps (f,
+                      vmin), vmax)), vzero);
+    }
+
+    _mm_storeu_si128 ((__m128i *) (d + i),
+        _mm_packs_epi16 (_mm_packs_epi32 (v[0], v[1]),
+            _mm_packs_epi32 (v[2], v[3])));
+  }
+
+  _ml_tensors_convert_f32_to_i8_quant_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief AVX2 kernel, uint8 to float32.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_convert_u8_to_f32_avx2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const guint8 *s = (const guint8 *) src;
+  gfloat *d = (gfloat *) dest;
+  __m256 vscale = _mm256_set1_ps (scale);
+  __m256 voffset = _mm256_set1_ps (offset);
+  __m256i v0, v1;
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v0 = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 ((const __m128i *) (s + i)));
+    v1 = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 ((const __m128i *) (s + i +
+                8)));
+
+    _mm256_storeu_ps (d + i, _mm256_add_ps (_mm256_mul_ps (_mm256_cvtepi32_ps
+                (v0), vscale), voffset));
+    _mm256_storeu_ps (d + i + 8, _mm256_add_ps (_mm256_mul_ps
+            (_mm256_cvtepi32_ps (v1), vscale), voffset));
+  }
+
+  _ml_tensors_convert_u8_to_f32_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief AVX2 kernel, float16 to float32 (F16C).
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_convert_f16_to_f32_avx2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dest;
+  __m256 vscale = _mm256_set1_ps (scale);
+  __m256 voffset = _mm256_set1_ps (offset);
+  gsize i;
+
+  for (i = 0; i + 8 <= count; i += 8) {
+    _mm256_storeu_ps (d + i, _mm256_add_ps (_mm256_mul_ps (_mm256_cvtph_ps
+                (_mm_loadu_si128 ((const __m128i *) (s + i))), vscale),
+            voffset));
+  }
+
+  _ml_tensors_convert_f16_to_f32_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief AVX2 kernel, float32 to float32.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_convert_f32_to_f32_avx2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gfloat *d = (gfloat *) dest;
+  __m256 vscale = _mm256_set1_ps (scale);
+  __m256 voffset = _mm256_set1_ps (offset);
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    _mm256_storeu_ps (d + i, _mm256_add_ps (_mm256_mul_ps (_mm256_loadu_ps
+                (s + i), vscale), voffset));
+    _mm256_storeu_ps (d + i + 8, _mm256_add_ps (_mm256_mul_ps
+            (_mm256_loadu_ps (s + i + 8), vscale), voffset));
+  }
+
+  _ml_tensors_convert_f32_to_f32_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief AVX2 kernel, float32 to uint8.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_convert_f32_to_u8_avx2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dest;
+  __m256 vscale = _mm256_set1_ps (scale);
+  __m256 voffset = _mm256_set1_ps (offset);
+  __m256 vmin = _mm256_setzero_ps ();
+  __m256 vmax = _mm256_set1_ps (255.0f);
+  __m256i v0, v1;
+  __m128i p0, p1;
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v0 = _mm256_cvtps_epi32 (_mm256_min_ps (_mm256_max_ps (_mm256_add_ps
+                (_mm256_mul_ps (_mm256_loadu_ps (s + i), vscale), voffset),
+                vmin), vmax));
+    v1 = _mm256_cvtps_epi32 (_mm256_min_ps (_mm256_max_ps (_mm256_add_ps
+                (_mm256_mul_ps (_mm256_loadu_ps (s + i + 8), vscale),
+                    voffset), vmin), vmax));
+
+    /* pack in 128-bit lanes to keep the order of the elements */
+    p0 = _mm_packs_epi32 (_mm256_castsi256_si128 (v0),
+        _mm256_extracti128_si256 (v0, 1));
+    p1 = _mm_packs_epi32 (_mm256_castsi256_si128 (v1),
+        _mm256_extracti128_si256 (v1, 1));
+    _mm_storeu_si128 ((__m128i *) (d + i), _mm_packus_epi16 (p0, p1));
+  }
+
+  _ml_tensors_convert_f32_to_u8_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief AVX2 kernel, int8 to float32.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_convert_i8_to_f32_avx2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gint8 *s = (const gint8 *) src;
+  gfloat *d = (gfloat *) dest;
+  __m256 vscale = _mm256_set1_ps (scale);
+  __m256 voffset = _mm256_set1_ps (offset);
+  __m256i v0, v1;
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v0 = _mm256_cvtepi8_epi32 (_mm_loadl_epi64 ((const __m128i *) (s + i)));
+    v1 = _mm256_cvtepi8_epi32 (_mm_loadl_epi64 ((const __m128i *) (s + i +
+                8)));
+
+    _mm256_storeu_ps (d + i, _mm256_add_ps (_mm256_mul_ps (_mm256_cvtepi32_ps
+                (v0), vscale), voffset));
+    _mm256_storeu_ps (d + i + 8, _mm256_add_ps (_mm256_mul_ps
+            (_mm256_cvtepi32_ps (v1), vscale), voffset));
+  }
+
+  _ml_tensors_convert_i8_to_f32_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief AVX2 kernel, float32 to int8.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_convert_f32_to_i8_avx2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dest;
+  __m256 vscale = _mm256_set1_ps (scale);
+  __m256 voffset = _mm256_set1_ps (offset);
+  __m256 vmin = _mm256_set1_ps (-128.0f);
+  __m256 vmax = _mm256_set1_ps (127.0f);
+  __m256 f;
+  __m256i v[2];
+  __m128i p[2];
+  gsize i, j;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (j = 0; j < 2; j++) {
+      f = _mm256_add_ps (_mm256_mul_ps (_mm256_loadu_ps (s + i + j * 8),
+              vscale), voffset);
+      f = _mm256_and_ps (f, _mm256_cmp_ps (f, f, _CMP_ORD_Q));
+      v[j] = _mm256_cvtps_epi32 (_mm256_min_ps (_mm256_max_ps (f, vmin),
+              vmax));
+
+      /* pack in 128-bit lanes to keep the order of the elements */
+      p[j] = _mm_packs_epi32 (_mm256_castsi256_si128 (v[j]),
+          _mm256_extracti128_si256 (v[j], 1));
+    }
+
+    _mm_storeu_si128 ((__m128i *) (d + i), _mm_packs_epi16 (p[0], p[1]));
+  }
+
+  _ml_tensors_convert_f32_to_i8_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief AVX2 kernel, quantize float32 to uint8.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_convert_f32_to_u8_quant_avx2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dest;
+  __m256 vscale = _mm256_set1_ps (scale);
+  __m256 vmin = _mm256_set1_ps (-ML_TENSORS_QUANT_LIMIT);
+  __m256 vmax = _mm256_set1_ps (ML_TENSORS_QUANT_LIMIT);
+  __m256i vzero = _mm256_set1_epi32 ((gint32) offset);
+  __m256 f;
+  __m256i v[2];
+  __m128i p[2];
+  gsize i, j;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (j = 0; j < 2; j++) {
+      f = _mm256_div_ps (_mm256_loadu_ps (s + i + j * 8), vscale);
+      f = _mm256_and_ps (f, _mm256_cmp_ps (f, f, _CMP_ORD_Q));
+      v[j] = _mm256_add_epi32 (_mm256_cvtps_epi32 (_mm256_min_ps
+              (_mm256_max_ps (f, vmin), vmax)), vzero);
+
+      /* pack in 128-bit lanes to keep the order of the elements */
+      p[j] = _mm_packs_epi32 (_mm256_castsi256_si128 (v[j]),
+          _mm256_extracti128_si256 (v[j], 1));
+    }
+
+    _mm_storeu_si128 ((__m128i *) (d + i), _mm_packus_epi16 (p[0], p[1]));
+  }
+
+  _ml_tensors_convert_f32_to_u8_quant_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief AVX2 kernel, quantize float32 to int8.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_convert_f32_to_i8_quant_avx2 (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dest;
+  __m256 vscale = _mm256_set1_ps (scale);
+  __m256 vmin = _mm256_set1_ps (-ML_TENSORS_QUANT_LIMIT);
+  __m256 vmax = _mm256_set1_ps (ML_TENSORS_QUANT_LIMIT);
+  __m256i vzero = _mm256_set1_epi32 ((gint32) offset);
+  __m256 f;
+  __m256i v[2];
+  __m128i p[2];
+  gsize i, j;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (j = 0; j < 2; j++) {
+      f = _mm256_div_ps (_mm256_loadu_ps (s + i + j * 8), vscale);
+      f = _mm256_and_ps (f, _mm256_cmp_ps (f, f, _CMP_ORD_Q));
+      v[j] = _mm256_add_epi32 (_mm256_cvtps_epi32 (_mm256_min_ps
+              (_mm256_max_ps (f, vmin), vmax)), vzero);
+
+      /* pack in 128-bit lanes to keep the order of the elements */
+      p[j] = _mm_packs_epi32 (_mm256_castsi256_si128 (v[j]),
+          _mm256_extracti128_si256 (v[j], 1));
+    }
+
+    _mm_storeu_si128 ((__m128i *) (d + i), _mm_packs_epi16 (p[0], p[1]));
+  }
+
+  _ml_tensors_convert_f32_to_i8_quant_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief The shuffle masks to gather a channel from the 3 vectors of the packed 3-channel uint8 elements, [channel][vector].
+ */
+static const guint8 tensors_deinterleave_u8x3_mask[3][3][16] = {
+  {{0, 3, 6, 9, 12, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+   {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 2, 5, 8, 11, 14, 0x80, 0x80, 0x80, 0x80, 0x80},
+   {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 1, 4, 7, 10, 13}},
+  {{1, 4, 7, 10, 13, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+   {0x80, 0x80, 0x80, 0x80, 0x80, 0, 3, 6, 9, 12, 15, 0x80, 0x80, 0x80, 0x80, 0x80},
+   {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 2, 5, 8, 11, 14}},
+  {{2, 5, 8, 11, 14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+   {0x80, 0x80, 0x80, 0x80, 0x80, 1, 4, 7, 10, 13, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+   {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 3, 6, 9, 12, 15}}
+};
+
+/**
+ * @brief The shuffle masks to scatter the 3 planes of uint8 elements to a vector of the packed elements, [vector][channel].
+ */
+static const guint8 tensors_interleave_u8x3_mask[3][3][16] = {
+  {{0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80, 0x80, 5},
+   {0x80, 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80, 0x80},
+   {0x80, 0x80, 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80}},
+  {{0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80, 10, 0x80},
+   {5, 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80, 10},
+   {0x80, 5, 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80}},
+  {{0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15, 0x80, 0x80},
+   {0x80, 0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15, 0x80},
+   {10, 0x80, 0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15}}
+};
+
+/**
+ * @brief SSSE3 kernel (with AVX2), packed 3-channel uint8 to planes.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_deinterleave_u8x3_avx2 (const guint8 * src, guint8 * const *d,
+    gsize count)
+{
+  __m128i v[3], mask[3][3];
+  gsize i;
+  guint c, r;
+
+  for (c = 0; c < 3; c++) {
+    for (r = 0; r < 3; r++)
+      mask[c][r] = _mm_loadu_si128 ((const __m128i *)
+          tensors_deinterleave_u8x3_mask[c][r]);
+  }
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (r = 0; r < 3; r++)
+      v[r] = _mm_loadu_si128 ((const __m128i *) (src + i * 3 + r * 16));
+
+    for (c = 0; c < 3; c++) {
+      _mm_storeu_si128 ((__m128i *) (d[c] + i),
+          _mm_or_si128 (_mm_or_si128 (_mm_shuffle_epi8 (v[0], mask[c][0]),
+                  _mm_shuffle_epi8 (v[1], mask[c][1])),
+              _mm_shuffle_epi8 (v[2], mask[c][2])));
+    }
+  }
+
+  if (i < count) {
+    guint8 *rest[3] = { d[0] + i, d[1] + i, d[2] + i };
+    _ml_tensors_deinterleave_u8x3_scalar (src + i * 3, rest, count - i);
+  }
+}
+
+/**
+ * @brief SSSE3 kernel (with AVX2), 3 planes of uint8 to packed 3-channel.
+ */
+__attribute__ ((target ("avx2,f16c")))
+static void
+_ml_tensors_interleave_u8x3_avx2 (const guint8 * const *s, guint8 * dest,
+    gsize count)
+{
+  __m128i v[3], mask[3][3];
+  gsize i;
+  guint c, r;
+
+  for (r = 0; r < 3; r++) {
+    for (c = 0; c < 3; c++)
+      mask[r][c] = _mm_loadu_si128 ((const __m128i *)
+          tensors_interleave_u8x3_mask[r][c]);
+  }
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    for (c = 0; c < 3; c++)
+      v[c] = _mm_loadu_si128 ((const __m128i *) (s[c] + i));
+
+    for (r = 0; r < 3; r++) {
+      _mm_storeu_si128 ((__m128i *) (dest + i * 3 + r * 16),
+          _mm_or_si128 (_mm_or_si128 (_mm_shuffle_epi8 (v[0], mask[r][0]),
+                  _mm_shuffle_epi8 (v[1], mask[r][1])),
+              _mm_shuffle_epi8 (v[2], mask[r][2])));
+    }
+  }
+
+  if (i < count) {
+    const guint8 *rest[3] = { s[0] + i, s[1] + i, s[2] + i };
+    _ml_tensors_interleave_u8x3_scalar (rest, dest + i * 3, count - i);
+  }
+}
+
+static const ml_tensors_convert_kernels_s tensors_convert_sse2 = {
+  "sse2",
+  _ml_tensors_convert_u8_to_f32_sse2,
+  _ml_tensors_convert_f16_to_f32_scalar,
+  _ml_tensors_convert_f32_to_f32_sse2,
+  _ml_tensors_convert_f32_to_u8_sse2,
+  _ml_tensors_convert_i8_to_f32_sse2,
+  _ml_tensors_convert_f32_to_i8_sse2,
+  _ml_tensors_convert_f32_to_u8_quant_sse2,
+  _ml_tensors_convert_f32_to_i8_quant_sse2,
+  _ml_tensors_deinterleave_u8x3_scalar,
+  _ml_tensors_interleave_u8x3_scalar
+};
+
+static const ml_tensors_convert_kernels_s tensors_convert_avx2 = {
+  "avx2",
+  _ml_tensors_convert_u8_to_f32_avx2,
+  _ml_tensors_convert_f16_to_f32_avx2,
+  _ml_tensors_convert_f32_to_f32_avx2,
+  _ml_tensors_convert_f32_to_u8_avx2,
+  _ml_tensors_convert_i8_to_f32_avx2,
+  _ml_tensors_convert_f32_to_i8_avx2,
+  _ml_tensors_convert_f32_to_u8_quant_avx2,
+  _ml_tensors_convert_f32_to_i8_quant_avx2,
+  _ml_tensors_deinterleave_u8x3_avx2,
+  _ml_tensors_interleave_u8x3_avx2
+};
+#elif defined(ML_TENSORS_CONVERT_NEON)
+/**
+ * @brief NEON kernel, uint8 to float32.
+ */
+static void
+_ml_tensors_convert_u8_to_f32_neon (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const guint8 *s = (const guint8 *) src;
+  gfloat *d = (gfloat *) dest;
+  float32x4_t vscale = vdupq_n_f32 (scale);
+  float32x4_t voffset = vdupq_n_f32 (offset);
+  uint8x16_t v8;
+  uint16x8_t v16;
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v8 = vld1q_u8 (s + i);
+
+    v16 = vmovl_u8 (vget_low_u8 (v8));
+    vst1q_f32 (d + i, vaddq_f32 (vmulq_f32 (vcvtq_f32_u32 (vmovl_u16
+                    (vget_low_u16 (v16))), vscale), voffset));
+    vst1q_f32 (d + i + 4, vaddq_f32 (vmulq_f32 (vcvtq_f32_u32 (vmovl_u16
+                    (vget_high_u16 (v16))), vscale), voffset));
+
+    v16 = vmovl_u8 (vget_high_u8 (v8));
+    vst1q_f32 (d + i + 8, vaddq_f32 (vmulq_f32 (vcvtq_f32_u32 (vmovl_u16
+                    (vget_low_u16 (v16))), vscale), voffset));
+    vst1q_f32 (d + i + 12, vaddq_f32 (vmulq_f32 (vcvtq_f32_u32 (vmovl_u16
+                    (vget_high_u16 (v16))), vscale), voffset));
+  }
+
+  _ml_tensors_convert_u8_to_f32_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief NEON kernel, float16 to float32.
+ */
+static void
+_ml_tensors_convert_f16_to_f32_neon (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dest;
+  float32x4_t vscale = vdupq_n_f32 (scale);
+  float32x4_t voffset = vdupq_n_f32 (offset);
+  gsize i;
+
+  for (i = 0; i + 8 <= count; i += 8) {
+    vst1q_f32 (d + i, vaddq_f32 (vmulq_f32 (vcvt_f32_f16 (vreinterpret_f16_u16
+                    (vld1_u16 (s + i))), vscale), voffset));
+    vst1q_f32 (d + i + 4, vaddq_f32 (vmulq_f32 (vcvt_f32_f16
+                (vreinterpret_f16_u16 (vld1_u16 (s + i + 4))), vscale),
+            voffset));
+  }
+
+  _ml_tensors_convert_f16_to_f32_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief NEON kernel, float32 to float32.
+ */
+static void
+_ml_tensors_convert_f32_to_f32_neon (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gfloat *d = (gfloat *) dest;
+  float32x4_t vscale = vdupq_n_f32 (scale);
+  float32x4_t voffset = vdupq_n_f32 (offset);
+  gsize i;
+
+  for (i = 0; i + 8 <= count; i += 8) {
+    vst1q_f32 (d + i, vaddq_f32 (vmulq_f32 (vld1q_f32 (s + i), vscale),
+            voffset));
+    vst1q_f32 (d + i + 4, vaddq_f32 (vmulq_f32 (vld1q_f32 (s + i + 4),
+                vscale), voffset));
+  }
+
+  _ml_tensors_convert_f32_to_f32_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief NEON kernel, float32 to uint8.
+ * @note vcvtnq rounds to the nearest even and saturates, nan is converted to 0.
+ */
+static void
+_ml_tensors_convert_f32_to_u8_neon (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dest;
+  float32x4_t vscale = vdupq_n_f32 (scale);
+  float32x4_t voffset = vdupq_n_f32 (offset);
+  uint32x4_t v0, v1;
+  gsize i;
+
+  for (i = 0; i + 8 <= count; i += 8) {
+    v0 = vcvtnq_u32_f32 (vaddq_f32 (vmulq_f32 (vld1q_f32 (s + i), vscale),
+            voffset));
+    v1 = vcvtnq_u32_f32 (vaddq_f32 (vmulq_f32 (vld1q_f32 (s + i + 4),
+                vscale), voffset));
+    vst1_u8 (d + i, vqmovn_u16 (vcombine_u16 (vqmovn_u32 (v0),
+                vqmovn_u32 (v1))));
+  }
+
+  _ml_tensors_convert_f32_to_u8_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief NEON kernel, int8 to float32.
+ */
+static void
+_ml_tensors_convert_i8_to_f32_neon (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gint8 *s = (const gint8 *) src;
+  gfloat *d = (gfloat *) dest;
+  float32x4_t vscale = vdupq_n_f32 (scale);
+  float32x4_t voffset = vdupq_n_f32 (offset);
+  int8x16_t v8;
+  int16x8_t v16;
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v8 = vld1q_s8 (s + i);
+
+    v16 = vmovl_s8 (vget_low_s8 (v8));
+    vst1q_f32 (d + i, vaddq_f32 (vmulq_f32 (vcvtq_f32_s32 (vmovl_s16
+                    (vget_low_s16 (v16))), vscale), voffset));
+    vst1q_f32 (d + i + 4, vaddq_f32 (vmulq_f32 (vcvtq_f32_s32 (vmovl_s16
+                    (vget_high_s16 (v16))), vscale), voffset));
+
+    v16 = vmovl_s8 (vget_high_s8 (v8));
+    vst1q_f32 (d + i + 8, vaddq_f32 (vmulq_f32 (vcvtq_f32_s32 (vmovl_s16
+                    (vget_low_s16 (v16))), vscale), voffset));
+    vst1q_f32 (d + i + 12, vaddq_f32 (vmulq_f32 (vcvtq_f32_s32 (vmovl_s16
+                    (vget_high_s16 (v16))), vscale), voffset));
+  }
+
+  _ml_tensors_convert_i8_to_f32_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief NEON kernel, float32 to int8.
+ * @note vcvtnq rounds to the nearest even and saturates, nan is converted to 0.
+ */
+static void
+_ml_tensors_convert_f32_to_i8_neon (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dest;
+  float32x4_t vscale = vdupq_n_f32 (scale);
+  float32x4_t voffset = vdupq_n_f32 (offset);
+  int32x4_t v0, v1;
+  gsize i;
+
+  for (i = 0; i + 8 <= count; i += 8) {
+    v0 = vcvtnq_s32_f32 (vaddq_f32 (vmulq_f32 (vld1q_f32 (s + i), vscale),
+            voffset));
+    v1 = vcvtnq_s32_f32 (vaddq_f32 (vmulq_f32 (vld1q_f32 (s + i + 4),
+                vscale), voffset));
+    vst1_s8 (d + i, vqmovn_s16 (vcombine_s16 (vqmovn_s32 (v0),
+                vqmovn_s32 (v1))));
+  }
+
+  _ml_tensors_convert_f32_to_i8_scalar (s + i, d + i, count - i, scale, offset);
+}
+
+/**
+ * @brief NEON kernel, quantize float32 to uint8.
+ * @note vcvtnq rounds to the nearest even and saturates, nan is converted to 0. The zero point is added with saturation.
+ */
+static void
+_ml_tensors_convert_f32_to_u8_quant_neon (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dest;
+  float32x4_t vscale = vdupq_n_f32 (scale);
+  int32x4_t vzero = vdupq_n_s32 ((gint32) offset);
+  int32x4_t v0, v1;
+  gsize i;
+
+  for (i = 0; i + 8 <= count; i += 8) {
+    v0 = vqaddq_s32 (vcvtnq_s32_f32 (vdivq_f32 (vld1q_f32 (s + i), vscale)),
+        vzero);
+    v1 = vqaddq_s32 (vcvtnq_s32_f32 (vdivq_f32 (vld1q_f32 (s + i + 4),
+                vscale)), vzero);
+    vst1_u8 (d + i, vqmovun_s16 (vcombine_s16 (vqmovn_s32 (v0),
+                vqmovn_s32 (v1))));
+  }
+
+  _ml_tensors_convert_f32_to_u8_quant_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief NEON kernel, quantize float32 to int8.
+ * @note vcvtnq rounds to the nearest even and saturates, nan is converted to 0. The zero point is added with saturation.
+ */
+static void
+_ml_tensors_convert_f32_to_i8_quant_neon (const void *src, void *dest,
+    gsize count, gfloat scale, gfloat offset)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dest;
+  float32x4_t vscale = vdupq_n_f32 (scale);
+  int32x4_t vzero = vdupq_n_s32 ((gint32) offset);
+  int32x4_t v0, v1;
+  gsize i;
+
+  for (i = 0; i + 8 <= count; i += 8) {
+    v0 = vqaddq_s32 (vcvtnq_s32_f32 (vdivq_f32 (vld1q_f32 (s + i), vscale)),
+        vzero);
+    v1 = vqaddq_s32 (vcvtnq_s32_f32 (vdivq_f32 (vld1q_f32 (s + i + 4),
+                vscale)), vzero);
+    vst1_s8 (d + i, vqmovn_s16 (vcombine_s16 (vqmovn_s32 (v0),
+                vqmovn_s32 (v1))));
+  }
+
+  _ml_tensors_convert_f32_to_i8_quant_scalar (s + i, d + i, count - i, scale,
+      offset);
+}
+
+/**
+ * @brief NEON kernel, packed 3-channel uint8 to planes.
+ */
+static void
+_ml_tensors_deinterleave_u8x3_neon (const guint8 * src, guint8 * const *d,
+    gsize count)
+{
+  uint8x16x3_t v;
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v = vld3q_u8 (src + i * 3);
+    vst1q_u8 (d[0] + i, v.val[0]);
+    vst1q_u8 (d[1] + i, v.val[1]);
+    vst1q_u8 (d[2] + i, v.val[2]);
+  }
+
+  if (i < count) {
+    guint8 *rest[3] = { d[0] + i, d[1] + i, d[2] + i };
+    _ml_tensors_deinterleave_u8x3_scalar (src + i * 3, rest, count - i);
+  }
+}
+
+/**
+ * @brief NEON kernel, 3 planes of uint8 to packed 3-channel.
+ */
+static void
+_ml_tensors_interleave_u8x3_neon (const guint8 * const *s, guint8 * dest,
+    gsize count)
+{
+  uint8x16x3_t v;
+  gsize i;
+
+  for (i = 0; i + 16 <= count; i += 16) {
+    v.val[0] = vld1q_u8 (s[0] + i);
+    v.val[1] = vld1q_u8 (s[1] + i);
+    v.val[2] = vld1q_u8 (s[2] + i);
+    vst3q_u8 (dest + i * 3, v);
+  }
+
+  if (i < count) {
+    const guint8 *rest[3] = { s[0] + i, s[1] + i, s[2] + i };
+    _ml_tensors_interleave_u8x3_scalar (rest, dest + i * 3, count - i);
+  }
+}
+
+static const ml_tensors_convert_kernels_s tensors_convert_neon = {
+  "neon",
+  _ml_tensors_convert_u8_to_f32_neon,
+  _ml_tensors_convert_f16_to_f32_neon,
+  _ml_tensors_convert_f32_to_f32_neon,
+  _ml_tensors_convert_f32_to_u8_neon,
+  _ml_tensors_convert_i8_to_f32_neon,
+  _ml_tensors_convert_f32_to_i8_neon,
+  _ml_tensors_convert_f32_to_u8_quant_neon,
+  _ml_tensors_convert_f32_to_i8_quant_neon,
+  _ml_tensors_deinterleave_u8x3_neon,
+  _ml_tensors_interleave_u8x3_neon
+};
+#endif
+
+/**
+ * The kernels in the order of the preference. The best one supported by the CPU is selected at runtime.
+ */
+static const ml_tensors_convert_kernels_s *const tensors_convert_isa[] = {
+#if defined(ML_TENSORS_CONVERT_X86)
+  &tensors_convert_avx2,
+  &tensors_convert_sse2,
+#elif defined(ML_TENSORS_CONVERT_NEON)
+  &tensors_convert_neon,
+#endif
+  &tensors_convert_scalar
+};
+
+/* the selected kernels, NULL until the first conversion */
+static gpointer tensors_convert_kernels = NULL;
+
+/**
+ * @brief Internal function to check the CPU supports the instruction set of the kernels.
+ */
+static gboolean
+_ml_tensors_convert_isa_supported (const ml_tensors_convert_kernels_s * kernels)
+{
+#if defined(ML_TENSORS_CONVERT_X86)
+  guint eax, ebx, ecx, edx;
+
+  if (kernels == &tensors_convert_avx2) {
+    if (!__builtin_cpu_supports ("avx2"))
+      return FALSE;
+    if (!__get_cpuid (1, &eax, &ebx, &ecx, &edx))
+      return FALSE;
+    return (ecx & bit_F16C) != 0;
+  }
+#endif
+
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to get the kernels to convert the tensors data.
+ */
+static const ml_tensors_convert_kernels_s *
+_ml_tensors_convert_get_kernels (void)
+{
+  const ml_tensors_convert_kernels_s *kernels;
+  guint i;
+
+  kernels = g_atomic_pointer_get (&tensors_convert_kernels);
+  if (kernels)
+    return kernels;
+
+  for (i = 0; i < G_N_ELEMENTS (tensors_convert_isa); i++) {
+    kernels = tensors_convert_isa[i];
+    if (_ml_tensors_convert_isa_supported (kernels))
+      break;
+  }
+
+  /* the threads select the same kernels, no need to serialize it. */
+  g_atomic_pointer_set (&tensors_convert_kernels, (gpointer) kernels);
+  return kernels;
+}
+
+/**
+ * @brief Selects the instruction set of the kernels to convert the tensors data.
+ */
+int
+_ml_tensors_convert_set_isa (const char *isa)
+{
+  guint i;
+
+  if (isa == NULL) {
+    g_atomic_pointer_set (&tensors_convert_kernels, NULL);
+    return ML_ERROR_NONE;
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (tensors_convert_isa); i++) {
+    if (g_ascii_strcasecmp (isa, tensors_convert_isa[i]->isa) == 0) {
+      if (!_ml_tensors_convert_isa_supported (tensors_convert_isa[i]))
+        break;
+
+      g_atomic_pointer_set (&tensors_convert_kernels,
+          (gpointer) tensors_convert_isa[i]);
+      return ML_ERROR_NONE;
+    }
+  }
+
+  _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+      "The instruction set, %s, is not supported in this build or CPU.", isa);
+}
+
+/**
+ * @brief Gets the name of the instruction set of the kernels to convert the tensors data.
+ */
+const char *
+_ml_tensors_convert_get_isa (void)
+{
+  return _ml_tensors_convert_get_kernels ()->isa;
+}
+
+/**
+ * @brief The minimum number of elements for each thread to run a kernel. The smaller tensors are converted in the caller.
+ */
+#define ML_TENSORS_CONVERT_PARALLEL_MIN (256U * 1024U)
+
+/**
+ * @brief The maximum number of parts to split a tensor into.
+ */
+#define ML_TENSORS_CONVERT_MAX_PARTS (16U)
+
+/**
+ * @brief The part of the elements converted by a thread of the pool.
+ */
+typedef struct
+{
+  ml_tensors_convert_kernel kernel;
+  const guint8 *src;
+  guint8 *dest;
+  gsize count;
+  gfloat scale;
+  gfloat offset;
+  GMutex *lock; /**< The lock of the caller to count the remaining parts */
+  GCond *cond;
+  guint *pending;
+} ml_tensors_convert_part_s;
+
+/* The threads to convert the large tensors, created with the first large tensor. */
+static GThreadPool *tensors_convert_pool = NULL;
+
+/**
+ * @brief Internal function to convert a part of the elements in the thread pool.
+ */
+static void
+_ml_tensors_convert_part (gpointer data, gpointer user_data)
+{
+  ml_tensors_convert_part_s *part = (ml_tensors_convert_part_s *) data;
+
+  part->kernel (part->src, part->dest, part->count, part->scale, part->offset);
+
+  g_mutex_lock (part->lock);
+  if (--(*part->pending) == 0)
+    g_cond_signal (part->cond);
+  g_mutex_unlock (part->lock);
+}
+
+/**
+ * @brief Internal function to get the thread pool to convert the large tensors.
+ */
+static GThreadPool *
+_ml_tensors_convert_get_pool (void)
+{
+  static gsize initialized = 0;
+  gint max_threads;
+
+  if (g_once_init_enter (&initialized)) {
+    max_threads = (gint) g_get_num_processors () - 1;
+
+    /* The caller converts a part too. No thread if there is a processor only. */
+    if (max_threads > 0) {
+      tensors_convert_pool = g_thread_pool_new (_ml_tensors_convert_part,
+          NULL, max_threads, FALSE, NULL);
+    }
+
+    g_once_init_leave (&initialized, 1);
+  }
+
+  return tensors_convert_pool;
+}
+
+/**
+ * @brief Internal function to run the kernel, splitting the large tensor into the parts for the threads.
+ */
+static void
+_ml_tensors_convert_run (ml_tensors_convert_kernel kernel, const void *src,
+    gsize src_esize, void *dest, gsize dest_esize, gsize count, gfloat scale,
+    gfloat offset)
+{
+  ml_tensors_convert_part_s parts[ML_TENSORS_CONVERT_MAX_PARTS];
+  GThreadPool *pool;
+  GMutex lock;
+  GCond cond;
+  guint pending = 0;
+  gsize num_parts, part_size, start = 0;
+  guint i;
+
+  num_parts = MIN (count / ML_TENSORS_CONVERT_PARALLEL_MIN,
+      (gsize) g_get_num_processors ());
+  num_parts = MIN (num_parts, G_N_ELEMENTS (parts));
+
+  /**
+   * The kernel does not run in parallel if it converts in place with the different element sizes,
+   * because a part may overwrite the source of the other parts.
+   */
+  if (num_parts < 2 || (src == dest && src_esize != dest_esize) ||
+      (pool = _ml_tensors_convert_get_pool ()) == NULL) {
+    kernel (src, dest, count, scale, offset);
+    return;
+  }
+
+  g_mutex_init (&lock);
+  g_cond_init (&cond);
+
+  /* the size of the parts is a multiple of 64 to keep the vector loops aligned */
+  part_size = ((count / num_parts) + 63U) & ~((gsize) 63U);
+
+  for (i = 0; i < num_parts && start < count; i++) {
+    parts[i].kernel = kernel;
+    parts[i].src = (const guint8 *) src + start * src_esize;
+    parts[i].dest = (guint8 *) dest + start * dest_esize;
+    parts[i].count = MIN (part_size, count - start);
+    parts[i].scale = scale;
+    parts[i].offset = offset;
+    parts[i].lock = &lock;
+    parts[i].cond = &cond;
+    parts[i].pending = &pending;
+
+    start += parts[i].count;
+  }
+  num_parts = i;
+
+  pending = num_parts - 1;
+
+  /* the caller converts the first part, and the part failed to push */
+  for (i = 1; i < num_parts; i++) {
+    if (!g_thread_pool_push (pool, &parts[i], NULL))
+      _ml_tensors_convert_part (&parts[i], NULL);
+  }
+
+  kernel (parts[0].src, parts[0].dest, parts[0].count, scale, offset);
+
+  g_mutex_lock (&lock);
+  while (pending > 0)
+    g_cond_wait (&cond, &lock);
+  g_mutex_unlock (&lock);
+
+  g_cond_clear (&cond);
+  g_mutex_clear (&lock);
+}
+
+/**
+ * @brief Internal function to convert the elements of a tensor.
+ */
+static void
+_ml_tensors_convert_tensor (ml_tensor_type_e src_type, const void *src,
+    ml_tensor_type_e dest_type, void *dest, gsize count, gboolean normalize,
+    gfloat scale, gfloat offset)
+{
+  const ml_tensors_convert_kernels_s *kernels;
+  ml_tensors_convert_kernel kernel = NULL;
+  gdouble v;
+  gsize i;
+
+  if (!normalize) {
+    if (src_type == dest_type) {
+      if (src != dest)
+        memcpy (dest, src, count * _ml_tensors_convert_element_size (src_type));
+      return;
+    }
+
+    scale = 1.0f;
+    offset = 0.0f;
+  }
+
+  kernels = _ml_tensors_convert_get_kernels ();
+  if (dest_type == ML_TENSOR_TYPE_FLOAT32) {
+    if (src_type == ML_TENSOR_TYPE_UINT8)
+      kernel = kernels->u8_to_f32;
+    else if (src_type == ML_TENSOR_TYPE_FLOAT16)
+      kernel = kernels->f16_to_f32;
+    else if (src_type == ML_TENSOR_TYPE_FLOAT32)
+      kernel = kernels->f32_to_f32;
+    else if (src_type == ML_TENSOR_TYPE_INT8)
+      kernel = kernels->i8_to_f32;
+  } else if (src_type == ML_TENSOR_TYPE_FLOAT32) {
+    if (dest_type == ML_TENSOR_TYPE_UINT8)
+      kernel = kernels->f32_to_u8;
+    else if (dest_type == ML_TENSOR_TYPE_INT8)
+      kernel = kernels->f32_to_i8;
+  }
+
+  if (kernel) {
+    _ml_tensors_convert_run (kernel, src,
+        _ml_tensors_convert_element_size (src_type), dest,
+        _ml_tensors_convert_element_size (dest_type), count, scale, offset);
+    return;
+  }
+
+  if (!normalize && _ml_tensors_convert_is_integer (src_type) &&
+      _ml_tensors_convert_is_integer (dest_type)) {
+    _ml_tensors_convert_integer (src_type, src, dest_type, dest, count);
+    return;
+  }
+
+  for (i = 0; i < count; i++) {
+    v = _ml_tensors_convert_get (src_type, src, i);
+    if (normalize)
+      v = v * scale + offset;
+    _ml_tensors_convert_set (dest_type, dest, i, v);
+  }
+}
+
+/**
+ * @brief Internal function to quantize the elements of a tensor, round (src / scale) + zero_point.
+ */
+static void
+_ml_tensors_quantize_tensor (ml_tensor_type_e src_type, const void *src,
+    ml_tensor_type_e dest_type, void *dest, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const ml_tensors_convert_kernels_s *kernels;
+  ml_tensors_convert_kernel kernel = NULL;
+  gboolean single = (src_type != ML_TENSOR_TYPE_FLOAT64);
+  gsize i;
+
+  kernels = _ml_tensors_convert_get_kernels ();
+  if (src_type == ML_TENSOR_TYPE_FLOAT32) {
+    if (dest_type == ML_TENSOR_TYPE_UINT8)
+      kernel = kernels->f32_to_u8_quant;
+    else if (dest_type == ML_TENSOR_TYPE_INT8)
+      kernel = kernels->f32_to_i8_quant;
+  }
+
+  if (kernel) {
+    /* the zero point of uint8 or int8 is exact in float */
+    _ml_tensors_convert_run (kernel, src,
+        _ml_tensors_convert_element_size (src_type), dest,
+        _ml_tensors_convert_element_size (dest_type), count, scale,
+        (gfloat) zero_point);
+    return;
+  }
+
+  for (i = 0; i < count; i++) {
+    _ml_tensors_convert_set (dest_type, dest, i,
+        (gdouble) _ml_tensors_convert_quantize_value (_ml_tensors_convert_get
+            (src_type, src, i), single, scale, zero_point));
+  }
+}
+
+/**
+ * @brief The minimum number of the elements in a channel to convert the channels one by one with the kernels.
+ */
+#define ML_TENSORS_CONVERT_CHANNEL_MIN (16U)
+
+/**
+ * @brief The modes to convert the tensors data.
+ */
+typedef enum
+{
+  ML_TENSORS_CONVERT_CAST = 0,
+  ML_TENSORS_CONVERT_NORMALIZE,
+  ML_TENSORS_CONVERT_QUANTIZE,
+  ML_TENSORS_CONVERT_DEQUANTIZE
+} ml_tensors_convert_mode_e;
+
+/**
+ * @brief Internal function to get the number of elements in a channel of the per-channel quantization parameters.
+ * @return The number of elements, 0 if the parameters do not match the dimension.
+ */
+static gsize
+_ml_tensors_convert_channel_size (const ml_tensor_info_s * info, gsize count)
+{
+  const ml_tensor_quant_s *quant = info->quant;
+  gsize inner = 1;
+  guint i;
+
+  if (quant->num_channels == 1)
+    return count;
+  if (info->dimension[quant->axis] != quant->num_channels)
+    return 0;
+
+  for (i = 0; i < quant->axis; i++)
+    inner *= MAX (info->dimension[i], 1U);
+
+  if (count % (inner * quant->num_channels) != 0)
+    return 0;
+
+  return inner;
+}
+
+/**
+ * @brief Internal function to get the tensor information of the quantization parameters to quantize or dequantize the tensor.
+ * @details The parameters of the quantized tensor are used first.
+ *          The parameters of the other tensor are used if the quantized one does not have them, e.g., the output of a model.
+ * @return The tensor information, NULL if the tensor is not quantized or dequantized.
+ */
+static ml_tensor_info_s *
+_ml_tensors_convert_get_quant_info (ml_tensors_info_s * src_info,
+    ml_tensors_info_s * dest_info, guint index, ml_tensors_convert_mode_e mode)
+{
+  ml_tensor_info_s *quantized, *other;
+
+  if (mode == ML_TENSORS_CONVERT_QUANTIZE) {
+    quantized = &dest_info->info[index];
+    other = &src_info->info[index];
+  } else if (mode == ML_TENSORS_CONVERT_DEQUANTIZE) {
+    quantized = &src_info->info[index];
+    other = &dest_info->info[index];
+  } else {
+    return NULL;
+  }
+
+  if (quantized->quant)
+    return quantized;
+
+  return other->quant ? other : NULL;
+}
+
+/**
+ * @brief Internal function to quantize or dequantize the elements of a tensor.
+ * @details The quantized value q = round (x / scale) + zero_point is computed with the division, not to differ at the ties.
+ *          The real value x = (q - zero_point) * scale is computed as q * scale + (-zero_point * scale).
+ */
+static void
+_ml_tensors_convert_quant (ml_tensor_type_e src_type, const void *src,
+    ml_tensor_type_e dest_type, void *dest, gsize count,
+    const ml_tensor_info_s * info, gboolean quantize)
+{
+  const ml_tensor_quant_s *quant = info->quant;
+  gsize src_esize = _ml_tensors_convert_element_size (src_type);
+  gsize dest_esize = _ml_tensors_convert_element_size (dest_type);
+  gboolean single = (src_type != ML_TENSOR_TYPE_FLOAT64);
+  gsize inner, block, i;
+  gfloat *scales = NULL, *offsets = NULL;
+  guint c;
+
+  inner = _ml_tensors_convert_channel_size (info, count);
+
+  if (!quantize) {
+    scales = g_new (gfloat, quant->num_channels * 2);
+    offsets = scales + quant->num_channels;
+    for (c = 0; c < quant->num_channels; c++) {
+      scales[c] = quant->scales[c];
+      offsets[c] = -(gfloat) quant->zero_points[c] * quant->scales[c];
+    }
+  }
+
+  if (inner >= ML_TENSORS_CONVERT_CHANNEL_MIN) {
+    for (block = 0; block < count / inner; block++) {
+      const void *s = (const guint8 *) src + block * inner * src_esize;
+      void *d = (guint8 *) dest + block * inner * dest_esize;
+
+      c = block % quant->num_channels;
+      if (quantize)
+        _ml_tensors_quantize_tensor (src_type, s, dest_type, d, inner,
+            quant->scales[c], quant->zero_points[c]);
+      else
+        _ml_tensors_convert_tensor (src_type, s, dest_type, d, inner, TRUE,
+            scales[c], offsets[c]);
+    }
+  } else {
+    /* the channels are too small (e.g., the innermost axis), convert the elements one by one */
+    for (i = 0; i < count; i++) {
+      gdouble v = _ml_tensors_convert_get (src_type, src, i);
+
+      c = (i / inner) % quant->num_channels;
+      if (quantize)
+        v = (gdouble) _ml_tensors_convert_quantize_value (v, single,
+            quant->scales[c], quant->zero_points[c]);
+      else
+        v = v * scales[c] + offsets[c];
+      _ml_tensors_convert_set (dest_type, dest, i, v);
+    }
+  }
+
+  g_free (scales);
+}
+
+/**
+ * @brief Internal function to convert, normalize, quantize or dequantize the tensors data.
+ */
+static int
+_ml_tensors_data_convert_internal (ml_tensors_data_s * src,
+    ml_tensors_data_s * dest, ml_tensors_convert_mode_e mode, gfloat scale,
+    gfloat offset)
+{
+  int first_nolock, second_nolock = 0;
+  ml_tensors_data_s *first, *second;
+  ml_tensors_info_s *src_info, *dest_info;
+  ml_tensor_info_s *quant_info;
+  ml_tensor_type_e src_type, dest_type;
+  gsize src_esize, dest_esize, count;
+  int status = ML_ERROR_NONE;
+  guint i;
+
+  /* lock in the order of the address, to avoid the deadlock with the converting in reverse */
+  first = (src < dest) ? src : dest;
+  second = (src < dest) ? dest : src;
+
+  G_LOCK_UNLESS_NOLOCK (*first, first_nolock);
+  if (second != first)
+    G_LOCK_UNLESS_NOLOCK (*second, second_nolock);
+
+  src_info = (ml_tensors_info_s *) src->info;
+  dest_info = (ml_tensors_info_s *) dest->info;
+  if (!src_info || !dest_info) {
+    _ml_error_report
+        ("The parameter, src or dest, does not have the tensors information. It should be created by ml_tensors_data_create ().");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  if (src->num_tensors != dest->num_tensors) {
+    _ml_error_report
+        ("The number of tensors in src (%u) and dest (%u) is different.",
+        src->num_tensors, dest->num_tensors);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  for (i = 0; i < src->num_tensors; i++) {
+    src_esize = _ml_tensors_convert_element_size (src_info->info[i].type);
+    dest_esize = _ml_tensors_convert_element_size (dest_info->info[i].type);
+
+    if (src_esize == 0 || dest_esize == 0 ||
+        src->tensors[i].size / src_esize != dest->tensors[i].size / dest_esize) {
+      _ml_error_report
+          ("The number of elements of the tensor at index %u in src and dest is different, or the tensor type is invalid.",
+          i);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    quant_info = _ml_tensors_convert_get_quant_info (src_info, dest_info, i,
+        mode);
+    if (quant_info && _ml_tensors_convert_channel_size (quant_info,
+            src->tensors[i].size / src_esize) == 0) {
+      _ml_error_report
+          ("The number of channels of the quantization parameters of the tensor at index %u is different from the dimension at axis %u.",
+          i, quant_info->quant->axis);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+  }
+
+  for (i = 0; i < src->num_tensors; i++) {
+    src_type = src_info->info[i].type;
+    dest_type = dest_info->info[i].type;
+    count = src->tensors[i].size / _ml_tensors_convert_element_size (src_type);
+    quant_info = _ml_tensors_convert_get_quant_info (src_info, dest_info, i,
+        mode);
+
+    if (quant_info) {
+      _ml_tensors_convert_quant (src_type, src->tensors[i].tensor, dest_type,
+          dest->tensors[i].tensor, count, quant_info,
+          mode == ML_TENSORS_CONVERT_QUANTIZE);
+    } else {
+      _ml_tensors_convert_tensor (src_type, src->tensors[i].tensor, dest_type,
+          dest->tensors[i].tensor, count, mode == ML_TENSORS_CONVERT_NORMALIZE,
+          scale, offset);
+    }
+  }
+
+done:
+  if (second != first)
+    G_UNLOCK_UNLESS_NOLOCK (*second, second_nolock);
+  G_UNLOCK_UNLESS_NOLOCK (*first, first_nolock);
+
+  return status;
+}
+
+/**
+ * @brief Converts the elements of the tensors data to the types of the destination. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_convert (const ml_tensors_data_h src, ml_tensors_data_h dest)
+{
+  check_feature_state (ML_FEATURE);
+
+  if (src == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (dest == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dest, is NULL. It should be a valid ml_tensors_data_h handle, created with the tensors information of the types to convert to.");
+
+  return _ml_tensors_data_convert_internal ((ml_tensors_data_s *) src,
+      (ml_tensors_data_s *) dest, ML_TENSORS_CONVERT_CAST, 1.0f, 0.0f);
+}
+
+/**
+ * @brief Normalizes the elements of the tensors data, and stores them with the types of the destination. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_normalize (const ml_tensors_data_h src, ml_tensors_data_h dest,
+    float scale, float offset)
+{
+  check_feature_state (ML_FEATURE);
+
+  if (src == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (dest == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dest, is NULL. It should be a valid ml_tensors_data_h handle, created with the tensors information of the types to convert to.");
+
+  return _ml_tensors_data_convert_internal ((ml_tensors_data_s *) src,
+      (ml_tensors_data_s *) dest, ML_TENSORS_CONVERT_NORMALIZE, scale, offset);
+}
+
+/**
+ * @brief Quantizes the elements of the tensors data with the quantization parameters of the destination. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_quantize (const ml_tensors_data_h src, ml_tensors_data_h dest)
+{
+  check_feature_state (ML_FEATURE);
+
+  if (src == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (dest == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dest, is NULL. It should be a valid ml_tensors_data_h handle, created with the tensors information of the quantization parameters.");
+
+  return _ml_tensors_data_convert_internal ((ml_tensors_data_s *) src,
+      (ml_tensors_data_s *) dest, ML_TENSORS_CONVERT_QUANTIZE, 1.0f, 0.0f);
+}
+
+/**
+ * @brief Dequantizes the elements of the tensors data with the quantization parameters of the source. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_dequantize (const ml_tensors_data_h src, ml_tensors_data_h dest)
+{
+  check_feature_state (ML_FEATURE);
+
+  if (src == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle, created with the tensors information of the quantization parameters.");
+  if (dest == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dest, is NULL. It should be a valid ml_tensors_data_h handle, created with the tensors information of the types to convert to.");
+
+  return _ml_tensors_data_convert_internal ((ml_tensors_data_s *) src,
+      (ml_tensors_data_s *) dest, ML_TENSORS_CONVERT_DEQUANTIZE, 1.0f, 0.0f);
+}
+
+/**
+ * @brief The size of the square tile to permute the two axes, to keep the source and destination in the cache.
+ */
+#define ML_TENSORS_PERMUTE_TILE (32U)
+
+/**
+ * @brief An axis of the destination tensor to permute.
+ */
+typedef struct
+{
+  gsize dim; /**< The size of the axis */
+  gsize stride; /**< The stride of the axis in the source tensor, in elements */
+  const guint *map; /**< The order of the channels if the axis is the channel axis, NULL otherwise */
+} ml_tensors_permute_axis_s;
+
+/**
+ * @brief Macro to copy a tile of the elements, from the offsets of the source to the destination.
+ */
+#define ML_TENSORS_PERMUTE_COPY_TILE(type) \
+  do { \
+    const type *s = (const type *) src; \
+    type *d = (type *) dest; \
+    for (j0 = 0; j0 < n1; j0 += ML_TENSORS_PERMUTE_TILE) { \
+      for (i0 = 0; i0 < n0; i0 += ML_TENSORS_PERMUTE_TILE) { \
+        for (j = j0; j < MIN (j0 + ML_TENSORS_PERMUTE_TILE, n1); j++) { \
+          for (i = i0; i < MIN (i0 + ML_TENSORS_PERMUTE_TILE, n0); i++) \
+            d[j * dstride1 + i] = s[off1[j] + off0[i]]; \
+        } \
+      } \
+    } \
+  } while (0)
+
+/**
+ * @brief Internal function to copy the elements of the innermost axis and another axis of the destination.
+ * @details The 3-channel uint8 elements are (de)interleaved with the kernels of the CPU.
+ */
+static void
+_ml_tensors_permute_tile (gsize esize, const guint8 * src, guint8 * dest,
+    const ml_tensors_permute_axis_s * axis0, const gsize * off0,
+    const ml_tensors_permute_axis_s * axis1, const gsize * off1,
+    gsize dstride1)
+{
+  const ml_tensors_convert_kernels_s *kernels;
+  gsize n0 = axis0->dim, n1 = axis1->dim;
+  gsize i, j, i0, j0;
+
+  if (esize == 1 && n1 == 3 && axis1->stride == 1 && !axis0->map &&
+      axis0->stride == 3) {
+    /* packed to planes, e.g., NHWC to NCHW of the RGB image */
+    guint8 *planes[3];
+
+    for (j = 0; j < 3; j++)
+      planes[off1[j]] = dest + j * dstride1;
+
+    kernels = _ml_tensors_convert_get_kernels ();
+    kernels->u8x3_to_planar (src, planes, n0);
+    return;
+  }
+
+  if (esize == 1 && n0 == 3 && !axis1->map && axis1->stride == 1 &&
+      dstride1 == 3) {
+    /* planes to packed, e.g., NCHW to NHWC of the RGB image */
+    const guint8 *planes[3] = { src + off0[0], src + off0[1], src + off0[2] };
+
+    kernels = _ml_tensors_convert_get_kernels ();
+    kernels->planar_to_u8x3 (planes, dest, n1);
+    return;
+  }
+
+  if (!axis0->map && axis0->stride == 1) {
+    /* the rows are contiguous in the source */
+    for (j = 0; j < n1; j++)
+      memcpy (dest + j * dstride1 * esize, src + off1[j] * esize, n0 * esize);
+    return;
+  }
+
+  switch (esize) {
+    case 1:
+      ML_TENSORS_PERMUTE_COPY_TILE (guint8);
+      break;
+    case 2:
+      ML_TENSORS_PERMUTE_COPY_TILE (guint16);
+      break;
+    case 4:
+      ML_TENSORS_PERMUTE_COPY_TILE (guint32);
+      break;
+    default:
+      ML_TENSORS_PERMUTE_COPY_TILE (guint64);
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to permute the elements of a tensor.
+ * @param[in] axes The axes of the destination, from the innermost. This function collapses the axes in place.
+ */
+static void
+_ml_tensors_permute_tensor (gsize esize, const void *src, void *dest,
+    ml_tensors_permute_axis_s * axes, guint rank)
+{
+  gsize dstride[ML_TENSOR_RANK_LIMIT + 1], idx[ML_TENSOR_RANK_LIMIT + 1];
+  gsize *off[ML_TENSOR_RANK_LIMIT + 1];
+  gsize *offsets, total = 0, soff, doff;
+  ml_tensors_permute_axis_s one = { 1, 1, NULL };
+  guint i, k, n = 0, inner = 0;
+
+  /* drop the axes of size 1, and merge the axes contiguous in both tensors */
+  for (i = 0; i < rank; i++) {
+    if (axes[i].dim == 1)
+      continue;
+
+    if (n > 0 && !axes[n - 1].map && !axes[i].map &&
+        axes[i].stride == axes[n - 1].stride * axes[n - 1].dim) {
+      axes[n - 1].dim *= axes[i].dim;
+      continue;
+    }
+
+    axes[n++] = axes[i];
+  }
+
+  if (n == 0)
+    axes[n++] = one;
+
+  if (n == 1 && !axes[0].map && axes[0].stride == 1) {
+    memcpy (dest, src, axes[0].dim * esize);
+    return;
+  }
+
+  /* the tile is the innermost axis and the axis reading the nearest elements of the source */
+  if (n == 1)
+    axes[n++] = one;
+
+  inner = 1;
+  for (i = 2; i < n; i++) {
+    if (axes[i].stride < axes[inner].stride)
+      inner = i;
+  }
+
+  for (i = 0; i < n; i++) {
+    dstride[i] = (i == 0) ? 1 : dstride[i - 1] * axes[i - 1].dim;
+    total += axes[i].dim;
+  }
+
+  offsets = g_new (gsize, total);
+  for (i = 0, total = 0; i < n; i++) {
+    off[i] = offsets + total;
+    for (k = 0; k < axes[i].dim; k++)
+      off[i][k] = (axes[i].map ? axes[i].map[k] : k) * axes[i].stride;
+
+    idx[i] = 0;
+    total += axes[i].dim;
+  }
+
+  /* iterate the other axes, the tile is at the offsets of the indices */
+  do {
+    soff = doff = 0;
+    for (i = 1; i < n; i++) {
+      if (i == inner)
+        continue;
+
+      soff += off[i][idx[i]];
+      doff += idx[i] * dstride[i];
+    }
+
+    _ml_tensors_permute_tile (esize, (const guint8 *) src + soff * esize,
+        (guint8 *) dest + doff * esize, &axes[0], off[0], &axes[inner],
+        off[inner], dstride[inner]);
+
+    for (i = 1; i < n; i++) {
+      if (i == inner)
+        continue;
+      if (++idx[i] < axes[i].dim)
+        break;
+      idx[i] = 0;
+    }
+  } while (i < n);
+
+  g_free (offsets);
+}
+
+/**
+ * @brief Internal function to check the order is a permutation of 0 to (count - 1).
+ */
+static gboolean
+_ml_tensors_permute_is_valid_order (const guint * order, guint count)
+{
+  guint8 seen[ML_TENSOR_RANK_LIMIT] = { 0 };
+  guint8 *found = seen;
+  gboolean valid = TRUE;
+  guint i;
+
+  if (count > ML_TENSOR_RANK_LIMIT)
+    found = g_new0 (guint8, count);
+
+  for (i = 0; i < count; i++) {
+    if (order[i] >= count || found[order[i]]) {
+      valid = FALSE;
+      break;
+    }
+    found[order[i]] = 1;
+  }
+
+  if (found != seen)
+    g_free (found);
+
+  return valid;
+}
+
+/**
+ * @brief Internal function to permute a tensor of the tensors data.
+ */
+static int
+_ml_tensors_data_permute_internal (ml_tensors_data_s * src,
+    ml_tensors_data_s * dest, unsigned int index, const unsigned int *axes,
+    unsigned int rank, unsigned int channel_axis,
+    const unsigned int *channel_order)
+{
+  int first_nolock, second_nolock;
+  ml_tensors_data_s *first, *second;
+  ml_tensors_info_s *src_info, *dest_info;
+  ml_tensor_info_s *sinfo, *dinfo;
+  ml_tensors_permute_axis_s paxes[ML_TENSOR_RANK_LIMIT + 1];
+  gsize src_stride[ML_TENSOR_RANK_LIMIT];
+  gsize esize, dim;
+  int status = ML_ERROR_NONE;
+  guint i;
+
+  if (rank == 0 || rank > ML_TENSOR_RANK_LIMIT)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, rank (%u), is invalid. It should be between 1 and %u.",
+        rank, ML_TENSOR_RANK_LIMIT);
+  if (!_ml_tensors_permute_is_valid_order (axes, rank))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, axes, is not a permutation of the axes from 0 to %u.",
+        rank - 1);
+  if (channel_order && channel_axis >= rank)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, channel_axis (%u), should be smaller than rank (%u).",
+        channel_axis, rank);
+
+  /* lock in the order of the address, to avoid the deadlock with the permuting in reverse */
+  first = (src < dest) ? src : dest;
+  second = (src < dest) ? dest : src;
+
+  G_LOCK_UNLESS_NOLOCK (*first, first_nolock);
+  G_LOCK_UNLESS_NOLOCK (*second, second_nolock);
+
+  src_info = (ml_tensors_info_s *) src->info;
+  dest_info = (ml_tensors_info_s *) dest->info;
+  if (!src_info || !dest_info) {
+    _ml_error_report
+        ("The parameter, src or dest, does not have the tensors information. It should be created by ml_tensors_data_create ().");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  if (index >= src->num_tensors || index >= dest->num_tensors) {
+    _ml_error_report
+        ("The parameter, index (%u), is too large. The number of tensors in src is %u and dest is %u.",
+        index, src->num_tensors, dest->num_tensors);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  sinfo = &src_info->info[index];
+  dinfo = &dest_info->info[index];
+  esize = _ml_tensors_convert_element_size (sinfo->type);
+  if (esize == 0 || sinfo->type != dinfo->type ||
+      src->tensors[index].size != dest->tensors[index].size) {
+    _ml_error_report
+        ("The tensor at index %u in src and dest should have the same type and size.",
+        index);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  if (channel_order &&
+      !_ml_tensors_permute_is_valid_order (channel_order,
+          MAX (sinfo->dimension[channel_axis], 1U))) {
+    _ml_error_report
+        ("The parameter, channel_order, is not a permutation of the %u channels.",
+        MAX (sinfo->dimension[channel_axis], 1U));
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  for (i = 0; i < rank; i++)
+    src_stride[i] = (i == 0) ? 1 :
+        src_stride[i - 1] * MAX (sinfo->dimension[i - 1], 1U);
+
+  for (i = 0; i < rank; i++) {
+    dim = MAX (sinfo->dimension[axes[i]], 1U);
+    if (MAX (dinfo->dimension[i], 1U) != dim) {
+      _ml_error_report
+          ("The dimension of dest at axis %u (%u) is different from the dimension of src at axis %u (%u).",
+          i, dinfo->dimension[i], axes[i], sinfo->dimension[axes[i]]);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    paxes[i].dim = dim;
+    paxes[i].stride = src_stride[axes[i]];
+    paxes[i].map = (channel_order && axes[i] == channel_axis) ?
+        channel_order : NULL;
+  }
+
+  /* the axes out of the rank are kept, as an outer axis */
+  paxes[rank].stride = src_stride[rank - 1] *
+      MAX (sinfo->dimension[rank - 1], 1U);
+  paxes[rank].dim = src->tensors[index].size / esize / paxes[rank].stride;
+  paxes[rank].map = NULL;
+
+  _ml_tensors_permute_tensor (esize, src->tensors[index].tensor,
+      dest->tensors[index].tensor, paxes, rank + 1);
+
+done:
+  G_UNLOCK_UNLESS_NOLOCK (*second, second_nolock);
+  G_UNLOCK_UNLESS_NOLOCK (*first, first_nolock);
+
+  return status;
+}
+
+/**
+ * @brief Permutes the axes of a tensor of the tensors data. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_permute (const ml_tensors_data_h src, ml_tensors_data_h dest,
+    unsigned int index, const unsigned int *axes, unsigned int rank)
+{
+  check_feature_state (ML_FEATURE);
+
+  if (src == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (dest == NULL || dest == src)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dest, is NULL or same as src. It should be a valid ml_tensors_data_h handle, created with the tensors information of the permuted dimension.");
+  if (axes == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, axes, is NULL. It should be an array of the axes of src, for each axis of dest.");
+
+  return _ml_tensors_data_permute_internal ((ml_tensors_data_s *) src,
+      (ml_tensors_data_s *) dest, index, axes, rank, 0, NULL);
+}
+
+/**
+ * @brief Permutes the axes and the channels of a tensor of the tensors data. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_permute_with_channel_order (const ml_tensors_data_h src,
+    ml_tensors_data_h dest, unsigned int index, const unsigned int *axes,
+    unsigned int rank, unsigned int channel_axis,
+    const unsigned int *channel_order)
+{
+  check_feature_state (ML_FEATURE);
+
+  if (src == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (dest == NULL || dest == src)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dest, is NULL or same as src. It should be a valid ml_tensors_data_h handle, created with the tensors information of the permuted dimension.");
+  if (axes == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, axes, is NULL. It should be an array of the axes of src, for each axis of dest.");
+  if (channel_order == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, channel_order, is NULL. It should be an array of the channels of src, for each channel of dest.");
+
+  return _ml_tensors_data_permute_internal ((ml_tensors_data_s *) src,
+      (ml_tensors_data_s *) dest, index, axes, rank, channel_axis,
+      channel_order);
+}
+
 /**
  * @brief Replaces string.
  * This function deallocates the input source string.
@@ -156,6 +156,7 @@ int
 _ml_tensors_info_copy_from_ml (GstTensorsInfo * gst_info,
     const ml_tensors_info_s * ml_info)
 {
+  int nolock;
   guint i, j;
   guint max_dim;
 
@@ -166,7 +167,7 @@ _ml_tensors_info_copy_from_ml (GstTensorsInfo * gst_info,
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parmater, gst_info, is NULL. It should be a valid GstTensorsInfo instance. This is probably an internal bug of ML API.");
 
-  G_LOCK_UNLESS_NOLOCK (*ml_info);
+  G_LOCK_UNLESS_NOLOCK (*ml_info, nolock);
 
   gst_tensors_info_init (gst_info);
   max_dim = MIN (ML_TENSOR_RANK_LIMIT, NNS_TENSOR_RANK_LIMIT);
@@ -196,7 +197,7 @@ _ml_tensors_info_copy_from_ml (GstTensorsInfo * gst_info,
       }
     }
   }
-  G_UNLOCK_UNLESS_NOLOCK (*ml_info);
+  G_UNLOCK_UNLESS_NOLOCK (*ml_info, nolock);
 
   return ML_ERROR_NONE;
 }
@@ -1665,10 +1665,12 @@ int
 ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
     ml_pipeline_buf_policy_e policy)
 {
+  int nolock;
   GstBuffer *buffer;
-  GstMemory *mem, *tmp;
-  gpointer mem_data;
+  GstMemory *mem, *tmp, *block_mem = NULL;
+  gpointer mem_data, block;
   gsize mem_size;
+  size_t block_size;
   GstFlowReturn gret;
   GstTensorsInfo gst_info;
   ml_tensors_data_s *_data;
@@ -1683,7 +1685,7 @@ ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
     ret = ML_ERROR_INVALID_PARAMETER;
     goto unlock_return;
   }
-  G_LOCK_UNLESS_NOLOCK (*_data);
+  G_LOCK_UNLESS_NOLOCK (*_data, nolock);
 
   if (_data->num_tensors < 1 || _data->num_tensors > ML_TENSOR_SIZE_LIMIT) {
     _ml_error_report
@@ -1734,13 +1736,28 @@ ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
   buffer = gst_buffer_new ();
   _ml_tensors_info_copy_from_ml (&gst_info, _data->info);
 
+  /**
+   * The tensors in a single buffer (contiguous layout) are wrapped into a single memory,
+   * and each tensor shares the region of it. The buffer is freed at once.
+   */
+  if (_ml_tensors_data_get_block (_data, &block, &block_size)) {
+    block_mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+        block, block_size, 0, block_size, block,
+        (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) ? g_free : NULL);
+  }
+
   for (i = 0; i < _data->num_tensors; i++) {
     mem_data = _data->tensors[i].tensor;
     mem_size = _data->tensors[i].size;
 
-    mem = tmp = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
-        mem_data, mem_size, 0, mem_size, mem_data,
-        (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) ? g_free : NULL);
+    if (block_mem) {
+      mem = tmp = gst_memory_share (block_mem,
+          (guint8 *) mem_data - (guint8 *) block, mem_size);
+    } else {
+      mem = tmp = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          mem_data, mem_size, 0, mem_size, mem_data,
+          (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) ? g_free : NULL);
+    }
 
     /* flex tensor, append header. */
     if (elem->is_flexible_tensor) {
@@ -1757,17 +1774,19 @@ ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
   }
 
   gst_tensors_info_free (&gst_info);
+  if (block_mem)
+    gst_memory_unref (block_mem);
 
   /* Unlock if it's not auto-free. We do not know when it'll be freed. */
   if (policy != ML_PIPELINE_BUF_POLICY_AUTO_FREE)
-    G_UNLOCK_UNLESS_NOLOCK (*_data);
+    G_UNLOCK_UNLESS_NOLOCK (*_data, nolock);
 
   /* Push the data! */
   gret = gst_app_src_push_buffer (GST_APP_SRC (elem->element), buffer);
 
   /* Free data ptr if buffer policy is auto-free */
   if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
-    G_UNLOCK_UNLESS_NOLOCK (*_data);
+    G_UNLOCK_UNLESS_NOLOCK (*_data, nolock);
     _ml_tensors_data_destroy_internal (_data, FALSE);
     _data = NULL;
   }
@@ -1784,7 +1803,7 @@ ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
   goto unlock_return;
 
 dont_destroy_data:
-  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  G_UNLOCK_UNLESS_NOLOCK (*_data, nolock);
 
   handle_exit (h);
 }
@@ -2839,8 +2858,10 @@ ml_pipeline_custom_invoke (void *data, const GstTensorFilterProperties * prop,
 done:
   g_mutex_unlock (&c->lock);
   /* NOTE: DO NOT free tensor data */
-  g_free (in_data);
-  g_free (out_data);
+  if (in_data)
+    _ml_tensors_data_destroy_internal (in_data, FALSE);
+  if (out_data)
+    _ml_tensors_data_destroy_internal (out_data, FALSE);
 
   return status;
 }
@@ -2911,6 +2932,10 @@ ml_pipeline_custom_easy_filter_register (const char *name,
     goto exit;
   }
 
+  /* The data handles for each invoke share the info. */
+  _ml_tensors_info_freeze (c->in_info);
+  _ml_tensors_info_freeze (c->out_info);
+
   /* register custom filter */
   _ml_tensors_info_copy_from_ml (&in_info, c->in_info);
   _ml_tensors_info_copy_from_ml (&out_info, c->out_info);
@@ -3075,9 +3100,10 @@ ml_pipeline_if_custom (const GstTensorsInfo * info,
         ("The callback function of if-statement has returned error: %d.", ret);
 
 done:
+  if (in_data)
+    _ml_tensors_data_destroy_internal (in_data, FALSE);
   if (ml_info)
     ml_tensors_info_destroy (ml_info);
-  g_free (in_data);
 
   return ret;
 }
@@ -12,7 +12,20 @@
  * @bug No known bugs except for NYI items
  */
 
+#if defined (__linux__) && !defined (_GNU_SOURCE)
+#define _GNU_SOURCE             /* sched_setaffinity () and CPU_SET () */
+#endif
+
 #include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#if defined (__linux__)
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+#include <glib/gstdio.h>
 #include <nnstreamer-single.h>
 #include <nnstreamer-tizen-internal.h>  /* Tizen platform header */
 #include <nnstreamer_internal.h>
@@ -30,6 +43,38 @@
  */
 #define SINGLE_DEFAULT_TIMEOUT 0
 
+/**
+ * @brief Default number of requests waiting for the invoke thread.
+ */
+#define SINGLE_DEFAULT_QUEUE_SIZE 16U
+
+/**
+ * @brief Default number of output buffers kept to be reused.
+ */
+#define SINGLE_DEFAULT_OUTPUT_POOL_SIZE 4U
+
+/**
+ * @brief Number of the buckets of the latency histogram.
+ * @details Each power of two in microseconds is split into 4 buckets, which covers up to 2^32 usec with the error less than 25%.
+ */
+#define SINGLE_LATENCY_BUCKETS 128U
+
+/**
+ * @brief Max time (usec) to spin in the hand-off between the caller and the invoke thread.
+ */
+#define SINGLE_MAX_HANDOFF_SPIN_US 1000000U
+
+/**
+ * @brief Hint to the processor in the busy-wait loop.
+ */
+#if defined (__x86_64__) || defined (__i386__)
+#define SINGLE_CPU_RELAX() __builtin_ia32_pause ()
+#elif defined (__aarch64__)
+#define SINGLE_CPU_RELAX() __asm__ __volatile__ ("yield" ::: "memory")
+#else
+#define SINGLE_CPU_RELAX() do { } while (0)
+#endif
+
 /**
  * @brief Global lock for single shot API
  * @detail This lock ensures that ml_single_close is thread safe. All other API
@@ -40,6 +85,11 @@
  */
 G_LOCK_DEFINE_STATIC (magic);
 
+/**
+ * @brief Global lock for the model cache
+ */
+G_LOCK_DEFINE_STATIC (model_cache);
+
 /**
  * @brief Get valid handle after magic verification
  * @note handle's mutex (single_h->mutex) is acquired after this
@@ -86,6 +136,27 @@ typedef enum
   JOIN_REQUESTED      /**< should join the thread, will exit soon */
 } thread_state;
 
+/**
+ * @brief Policy when the request queue of the handle is full.
+ */
+typedef enum
+{
+  QUEUE_POLICY_BLOCK = 0,     /**< wait until the queue has room */
+  QUEUE_POLICY_FAIL,          /**< return ML_ERROR_TRY_AGAIN immediately */
+  QUEUE_POLICY_DROP_OLDEST,   /**< cancel the oldest request in the queue */
+  QUEUE_POLICY_MAX
+} queue_policy;
+
+/**
+ * @brief The name of queue policy (property 'queue-policy').
+ */
+static const char *queue_policy_name[] = {
+  [QUEUE_POLICY_BLOCK] = "block",
+  [QUEUE_POLICY_FAIL] = "fail",
+  [QUEUE_POLICY_DROP_OLDEST] = "drop-oldest",
+  NULL
+};
+
 /**
  * @brief The name of sub-plugin for defined neural net frameworks.
  * @note The sub-plugin for Android is not declared (e.g., snap)
@@ -111,6 +182,60 @@ static const char *ml_nnfw_subplugin_name[] = {
   NULL
 };
 
+/** Request to be processed by the invoke thread */
+typedef struct
+{
+  ml_tensors_data_h input;            /**< input received from user */
+  ml_tensors_data_h output;           /**< output to be sent back to user */
+  gboolean free_input;                /**< true if input tensors are cloned in single-shot */
+  gboolean free_output;               /**< true if output tensors are allocated in single-shot */
+  ml_single_invoke_cb cb;             /**< callback to notify the result, NULL if the caller waits for the result */
+  void *user_data;                    /**< user data for the callback */
+  gint64 queued_time;                 /**< monotonic time when the request is queued */
+  gint64 deadline;                    /**< monotonic time after which the result is dropped, 0 if there is no deadline */
+  guint id;                           /**< id to cancel the asynchronous request, 0 if not cancellable */
+  int status;                         /**< status of processing */
+  int drop_status;                    /**< error passed to the caller instead of the result, if the request is cancelled or expired */
+  gboolean done;                      /**< true if the request is completed */
+  gboolean abandoned;                 /**< true if the caller has returned back with timeout */
+  gboolean no_latency;                /**< true if the latency is not recorded in the statistics (e.g., warm-up) */
+} ml_single_request;
+
+/** Output buffers to be reused by the single-shot handle */
+typedef struct
+{
+  gint refcount;                      /**< reference count of the handle and the outputs in use */
+  GMutex lock;                        /**< mutex for synchronization */
+  GQueue buffers;                     /**< buffers (array of tensor memory) to be reused */
+  guint num_tensors;                  /**< number of output tensors */
+  size_t sizes[ML_TENSOR_SIZE_LIMIT]; /**< size of each output tensor */
+  guint max_buffers;                  /**< max number of buffers kept (property 'output-pool-size') */
+  guint in_use;                       /**< number of outputs in use */
+  guint high_water;                   /**< max number of outputs in use at once */
+  gboolean closed;                    /**< true if the handle is closed */
+} ml_single_output_pool;
+
+/** Model loaded by the tensor-filter and shared among the single-shot handles */
+typedef struct
+{
+  gchar *key;                 /**< key of the model (framework, accelerator, models, custom option, tensors information and batch) */
+  gchar *filter_key;          /**< key given to the tensor-filter to share the model, unique for each entry */
+  guint refcount;             /**< number of the handles sharing the model, protected by the model_cache lock */
+  gboolean detached;          /**< true if the entry is removed from the cache, because its configuration is changed */
+  GMutex lock;                /**< mutex to serialize invoke of the shared model */
+} ml_single_model_entry;
+
+/** Process-wide cache of the models */
+typedef struct
+{
+  GHashTable *table;          /**< key of the model -> ml_single_model_entry */
+  guint64 hits;               /**< number of the opens sharing the loaded model */
+  guint64 misses;             /**< number of the opens loading the model */
+  guint serial;               /**< number of the entries created, to make the key of the tensor-filter unique */
+} ml_single_model_cache;
+
+static ml_single_model_cache model_cache = { NULL, 0, 0, 0 };
+
 /** ML single api data structure for handle */
 typedef struct
 {
@@ -124,13 +249,11 @@ typedef struct
   GThread *thread;                    /**< thread for invoking */
   GMutex mutex;                       /**< mutex for synchronization */
   GCond cond;                         /**< condition for synchronization */
-  ml_tensors_data_h input;            /**< input received from user */
-  ml_tensors_data_h output;           /**< output to be sent back to user */
   guint timeout;                      /**< timeout for invoking */
   thread_state state;                 /**< current state of the thread */
-  gboolean free_output;               /**< true if output tensors are allocated in single-shot */
-  int status;                         /**< status of processing */
+  gboolean borrow_input;              /**< true if the caller lends input tensors without copying (property 'borrow-input') */
   gboolean invoking;                  /**< invoke running flag */
+  guint waiting;                      /**< number of callers waiting for the requests */
   ml_tensors_data_s in_tensors;    /**< input tensor wrapper for processing */
   ml_tensors_data_s out_tensors;   /**< output tensor wrapper for processing */
 
@@ -139,8 +262,46 @@ typedef struct
   guint output_ranks[ML_TENSOR_SIZE_LIMIT];  /**< the rank list of output tensors, it is calculated based on the dimension string. */
 
   GList *destroy_data_list;         /**< data to be freed by filter */
+  GQueue requests;                  /**< requests waiting for the invoke thread, processed in order */
+  guint queue_size;                 /**< max number of requests in the queue (property 'queue-size') */
+  queue_policy policy;              /**< policy when the queue is full (property 'queue-policy') */
+  guint64 queue_processed;          /**< number of requests taken from the queue */
+  guint64 queue_dropped;            /**< number of requests dropped from the queue */
+  gint64 queue_wait_total;          /**< total time (usec) the requests have waited in the queue */
+  gint64 queue_wait_max;            /**< max time (usec) a request has waited in the queue */
+
+  guint max_batch;                  /**< max number of requests to be invoked at once (ml-option 'max-batch') */
+  guint max_wait_us;                /**< max time (usec) to wait for gathering a batch (ml-option 'max-wait-us') */
+  guint batch_configured;           /**< batch size the tensor-filter is configured with */
+  ml_single_request **batch;        /**< requests gathered for a batch */
+
+  ml_single_output_pool *output_pool; /**< output buffers to be reused */
+  ml_single_model_entry *model;     /**< model shared with other handles, NULL if not shared */
+  int model_fd;                     /**< file descriptor of the model opened from the buffer, -1 if not used */
+
+  GThread *loader;                  /**< thread loading the model (ml_single_open_async) */
+  int load_status;                  /**< ML_ERROR_TRY_AGAIN while loading the model, or the result of loading */
+
+  guint64 latency_hist[SINGLE_LATENCY_BUCKETS]; /**< histogram of the latency from the request to the output */
+  guint64 latency_count;            /**< number of the latencies in the histogram */
+  gint64 latency_max;               /**< max latency in usec */
+
+  guint spin_us;                    /**< time (usec) to spin before sleeping in the hand-off with the invoke thread (property 'handoff-spin-us') */
+  gint push_seq;                    /**< sequence of the requests pushed, polled by the spinning invoke thread */
+  gint thread_tid;                  /**< kernel thread id of the invoke thread, 0 until the thread starts */
+  GHashTable *pending;              /**< id -> cancellable request not completed yet */
+  guint last_request_id;            /**< id of the last cancellable request */
+
 } ml_single;
 
+/** Data to load the model in the background */
+typedef struct
+{
+  ml_single *single_h;              /**< the handle to be loaded */
+  ml_single_preset info;            /**< copy of the information to open the model */
+  ml_nnfw_type_e nnfw;              /**< the framework determined when opening the handle */
+} ml_single_loader;
+
 /**
  * @brief Internal function to get the nnfw type.
  */
@@ -275,6 +436,120 @@ ml_check_nnfw_availability (ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw,
   return ml_check_nnfw_availability_full (nnfw, hw, NULL, available);
 }
 
+/**
+ * @brief Internal function to create the pool of output buffers.
+ */
+static ml_single_output_pool *
+__output_pool_new (void)
+{
+  ml_single_output_pool *pool;
+
+  pool = g_new0 (ml_single_output_pool, 1);
+  if (pool == NULL)
+    return NULL;
+
+  pool->refcount = 1;
+  pool->max_buffers = SINGLE_DEFAULT_OUTPUT_POOL_SIZE;
+  g_mutex_init (&pool->lock);
+  g_queue_init (&pool->buffers);
+
+  return pool;
+}
+
+/**
+ * @brief Internal function to free the buffers in the pool.
+ * @note This is called with the pool locked.
+ */
+static void
+__output_pool_flush (ml_single_output_pool * pool)
+{
+  gpointer *buffers;
+  guint i;
+
+  while ((buffers = (gpointer *) g_queue_pop_head (&pool->buffers)) != NULL) {
+    for (i = 0; i < pool->num_tensors; i++)
+      g_free (buffers[i]);
+    g_free (buffers);
+  }
+}
+
+/**
+ * @brief Internal function to release the reference of the pool.
+ */
+static void
+__output_pool_unref (ml_single_output_pool * pool)
+{
+  if (!g_atomic_int_dec_and_test (&pool->refcount))
+    return;
+
+  __output_pool_flush (pool);
+  g_mutex_clear (&pool->lock);
+  g_free (pool);
+}
+
+/**
+ * @brief Internal function to set the output tensors of the pool, this drops the buffers with old size.
+ */
+static void
+__output_pool_reset (ml_single_output_pool * pool,
+    const ml_tensors_data_s * out_tensors)
+{
+  guint i;
+
+  g_mutex_lock (&pool->lock);
+  __output_pool_flush (pool);
+
+  pool->num_tensors = out_tensors->num_tensors;
+  for (i = 0; i < out_tensors->num_tensors; i++)
+    pool->sizes[i] = out_tensors->tensors[i].size;
+  g_mutex_unlock (&pool->lock);
+}
+
+/**
+ * @brief Callback to return the buffers of the output data to the pool.
+ * @details This is called by ml_tensors_data_destroy(). The tensor memory is freed if the pool is full or the handle is closed.
+ */
+static int
+__output_pool_return_cb (void *handle, void *user_data)
+{
+  ml_tensors_data_s *data = (ml_tensors_data_s *) handle;
+  ml_single_output_pool *pool = (ml_single_output_pool *) user_data;
+  gpointer *buffers = NULL;
+  guint i;
+  gboolean reuse;
+
+  g_mutex_lock (&pool->lock);
+  pool->in_use--;
+
+  reuse = (!pool->closed && data->num_tensors == pool->num_tensors &&
+      g_queue_get_length (&pool->buffers) < pool->max_buffers);
+  for (i = 0; reuse && i < data->num_tensors; i++) {
+    if (data->tensors[i].size != pool->sizes[i] || !data->tensors[i].tensor)
+      reuse = FALSE;
+  }
+
+  if (reuse) {
+    buffers = g_new (gpointer, data->num_tensors);
+    for (i = 0; i < data->num_tensors; i++)
+      buffers[i] = data->tensors[i].tensor;
+    g_queue_push_tail (&pool->buffers, buffers);
+  }
+  g_mutex_unlock (&pool->lock);
+
+  for (i = 0; i < data->num_tensors; i++) {
+    if (!reuse)
+      g_free (data->tensors[i].tensor);
+    data->tensors[i].tensor = NULL;
+  }
+
+  /* reset callback function */
+  data->destroy = NULL;
+  data->user_data = NULL;
+
+  __output_pool_unref (pool);
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief setup input and output tensor memory to pass to the tensor_filter.
  * @note this tensor memory wrapper will be reused for each invoke.
@@ -286,9 +561,14 @@ __setup_in_out_tensors (ml_single * single_h)
   ml_tensors_data_s *in_tensors = &single_h->in_tensors;
   ml_tensors_data_s *out_tensors = &single_h->out_tensors;
 
-  /** Setup input buffer */
-  _ml_tensors_info_free (in_tensors->info);
-  ml_tensors_info_clone (in_tensors->info, &single_h->in_info);
+  /**
+   * Setup input buffer
+   * The data handles created with the old info keep it, and drop it when destroyed.
+   */
+  if (in_tensors->info)
+    ml_tensors_info_destroy (in_tensors->info);
+  in_tensors->info = NULL;
+  _ml_tensors_info_share (&single_h->in_info, &in_tensors->info);
 
   in_tensors->num_tensors = single_h->in_info.num_tensors;
   for (i = 0; i < single_h->in_info.num_tensors; i++) {
@@ -299,9 +579,11 @@ __setup_in_out_tensors (ml_single * single_h)
         single_h->in_info.is_extended);
   }
 
-  /** Setup output buffer */
-  _ml_tensors_info_free (out_tensors->info);
-  ml_tensors_info_clone (out_tensors->info, &single_h->out_info);
+  /** Setup output buffer, of which info is shared by the outputs */
+  if (out_tensors->info)
+    ml_tensors_info_destroy (out_tensors->info);
+  out_tensors->info = NULL;
+  _ml_tensors_info_share (&single_h->out_info, &out_tensors->info);
 
   out_tensors->num_tensors = single_h->out_info.num_tensors;
   for (i = 0; i < single_h->out_info.num_tensors; i++) {
@@ -311,6 +593,9 @@ __setup_in_out_tensors (ml_single * single_h)
         _ml_tensor_info_get_size (&single_h->out_info.info[i],
         single_h->out_info.is_extended);
   }
+
+  /** Drop the output buffers with old size */
+  __output_pool_reset (single_h->output_pool, out_tensors);
 }
 
 /**
@@ -395,11 +680,259 @@ set_destroy_notify (ml_single * single_h, ml_tensors_data_s * data,
   }
 }
 
+/**
+ * @brief Internal function to free the entry of the model cache.
+ */
+static void
+__model_entry_free (gpointer data)
+{
+  ml_single_model_entry *entry = (ml_single_model_entry *) data;
+
+  g_mutex_clear (&entry->lock);
+  g_free (entry->key);
+  g_free (entry->filter_key);
+  g_free (entry);
+}
+
+/**
+ * @brief Internal function to append the string field to the key of the model cache.
+ * @details The field is prefixed with its length, so the fields including the separator cannot make the same key with others.
+ */
+static void
+__model_cache_key_append (GString * key, const gchar * field)
+{
+  if (field == NULL)
+    field = "";
+
+  g_string_append_printf (key, "%" G_GSIZE_FORMAT ":%s", strlen (field), field);
+}
+
+/**
+ * @brief Internal function to append the tensors information to the key of the model cache.
+ */
+static void
+__model_cache_key_append_info (GString * key, const ml_tensors_info_h info)
+{
+  GstTensorsInfo gst_info;
+  gchar *str_dim, *str_type;
+
+  if (info == NULL ||
+      _ml_tensors_info_copy_from_ml (&gst_info,
+          (ml_tensors_info_s *) info) != ML_ERROR_NONE) {
+    __model_cache_key_append (key, NULL);
+    __model_cache_key_append (key, NULL);
+    return;
+  }
+
+  str_dim = gst_tensors_info_get_dimensions_string (&gst_info);
+  str_type = gst_tensors_info_get_types_string (&gst_info);
+  __model_cache_key_append (key, str_dim);
+  __model_cache_key_append (key, str_type);
+
+  g_free (str_dim);
+  g_free (str_type);
+  gst_tensors_info_free (&gst_info);
+}
+
+/**
+ * @brief Internal function to make the key of the model cache.
+ * @details The handles share the model only if the model is loaded with the same configuration.
+ */
+static gchar *
+__model_cache_key (const gchar * fw_name, ml_nnfw_hw_e hw,
+    const ml_single_preset * info)
+{
+  GString *key = g_string_new (NULL);
+
+  __model_cache_key_append (key, fw_name);
+  g_string_append_printf (key, "%d:%u:", (int) hw, info->max_batch);
+  __model_cache_key_append (key, info->models);
+  __model_cache_key_append (key, info->custom_option);
+  __model_cache_key_append_info (key, info->input_info);
+  __model_cache_key_append_info (key, info->output_info);
+
+  return g_string_free (key, FALSE);
+}
+
+/**
+ * @brief Internal function to get the entry of the model cache with given key.
+ * @details The entry is added if the model is not loaded yet. The tensor-filter shares the model with the key of the entry.
+ */
+static ml_single_model_entry *
+__model_cache_acquire (const gchar * key)
+{
+  ml_single_model_entry *entry;
+
+  G_LOCK (model_cache);
+  if (model_cache.table == NULL) {
+    model_cache.table = g_hash_table_new_full (g_str_hash, g_str_equal,
+        NULL, __model_entry_free);
+  }
+
+  entry = (ml_single_model_entry *) g_hash_table_lookup (model_cache.table,
+      key);
+  if (entry) {
+    model_cache.hits++;
+  } else {
+    model_cache.misses++;
+
+    entry = g_new0 (ml_single_model_entry, 1);
+    entry->key = g_strdup (key);
+    entry->filter_key = g_strdup_printf ("%s#%u", key, ++model_cache.serial);
+    g_mutex_init (&entry->lock);
+    g_hash_table_insert (model_cache.table, entry->key, entry);
+  }
+
+  entry->refcount++;
+  G_UNLOCK (model_cache);
+
+  return entry;
+}
+
+/**
+ * @brief Internal function to release the entry of the model cache.
+ * @note This should be called after the tensor-filter releases the model.
+ */
+static void
+__model_cache_release (ml_single_model_entry * entry)
+{
+  G_LOCK (model_cache);
+  if (--entry->refcount == 0) {
+    if (entry->detached)
+      __model_entry_free (entry);
+    else
+      g_hash_table_remove (model_cache.table, entry->key);
+  }
+  G_UNLOCK (model_cache);
+}
+
+/**
+ * @brief Internal function to check the model of the handle is shared with other handles, before changing its configuration.
+ * @details If the model is not shared, the entry is removed from the cache, so the handles opened later do not share the model
+ *          configured differently from the one of the key.
+ * @return TRUE if the model is shared and its configuration cannot be changed.
+ */
+static gboolean
+__model_is_shared (ml_single * single_h)
+{
+  ml_single_model_entry *entry = single_h->model;
+  gboolean shared;
+
+  if (entry == NULL)
+    return FALSE;
+
+  G_LOCK (model_cache);
+  shared = (entry->refcount > 1);
+  if (!shared && !entry->detached) {
+    g_hash_table_steal (model_cache.table, entry->key);
+    entry->detached = TRUE;
+  }
+  G_UNLOCK (model_cache);
+
+  return shared;
+}
+
+/**
+ * @brief Internal function to check the model of the handle is loaded.
+ * @note This is called with the handle locked.
+ */
+static int
+__check_loaded (ml_single * single_h)
+{
+  if (G_LIKELY (single_h->load_status == ML_ERROR_NONE))
+    return ML_ERROR_NONE;
+
+  if (single_h->load_status == ML_ERROR_TRY_AGAIN)
+    _ml_error_report_return (ML_ERROR_TRY_AGAIN,
+        "The model of the given handle is still being loaded. Please try again after the callback of ml_single_open_async() is called.");
+
+  _ml_error_report_return (single_h->load_status,
+      "The given handle has failed to load the model with error code %d. Please close the handle.",
+      single_h->load_status);
+}
+
+/**
+ * @brief Internal function to check the caller is not the invoke thread, which cannot wait for its own requests.
+ * @details The callback of ml_single_invoke_async() is called by the invoke thread, so the synchronous invoke in the callback never returns.
+ * @note This is called with the handle locked.
+ */
+static int
+__check_not_invoke_thread (ml_single * single_h)
+{
+  if (G_UNLIKELY (single_h->thread == g_thread_self ()))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The model of the given handle cannot be invoked synchronously in the callback of ml_single_invoke_async(), because the callback is called by the thread invoking the model. Please call ml_single_invoke_async() in the callback instead.");
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to create the output data, of which buffers are reused from the pool.
+ * @param[out] alloc_in_invoke TRUE if the buffers should be allocated by the framework in invoke.
+ */
+static int
+__alloc_output (ml_single * single_h, ml_tensors_data_h * output,
+    gboolean * alloc_in_invoke)
+{
+  ml_single_output_pool *pool = single_h->output_pool;
+  ml_tensors_data_s *data;
+  gpointer *buffers;
+  guint i;
+  int status;
+
+  status = _ml_tensors_data_clone_no_alloc (&single_h->out_tensors, output);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  /* The framework manages the memory of the output. */
+  *alloc_in_invoke = single_h->klass->allocate_in_invoke (single_h->filter);
+  if (*alloc_in_invoke)
+    return ML_ERROR_NONE;
+
+  data = (ml_tensors_data_s *) (*output);
+
+  g_mutex_lock (&pool->lock);
+  buffers = (gpointer *) g_queue_pop_head (&pool->buffers);
+  pool->in_use++;
+  if (pool->in_use > pool->high_water)
+    pool->high_water = pool->in_use;
+  g_mutex_unlock (&pool->lock);
+
+  for (i = 0; i < data->num_tensors; i++) {
+    if (buffers)
+      data->tensors[i].tensor = buffers[i];
+    else
+      data->tensors[i].tensor = _ml_tensors_data_alloc_buffer (data->info,
+          data->tensors[i].size, FALSE);
+  }
+  g_free (buffers);
+
+  for (i = 0; i < data->num_tensors; i++) {
+    if (data->tensors[i].tensor == NULL) {
+      g_mutex_lock (&pool->lock);
+      pool->in_use--;
+      g_mutex_unlock (&pool->lock);
+
+      ml_tensors_data_destroy (*output);
+      *output = NULL;
+      _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+          "Failed to allocate the buffers of the output. Out of memory?");
+    }
+  }
+
+  g_atomic_int_inc (&pool->refcount);
+  data->destroy = __output_pool_return_cb;
+  data->user_data = pool;
+
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Internal function to call subplugin's invoke
  */
 static inline int
-__invoke (ml_single * single_h, ml_tensors_data_h in, ml_tensors_data_h out)
+__invoke (ml_single * single_h, ml_tensors_data_h in, ml_tensors_data_h out,
+    gboolean alloc_output)
 {
   ml_tensors_data_s *in_data, *out_data;
   int status = ML_ERROR_NONE;
@@ -418,1320 +951,4879 @@ __invoke (ml_single * single_h, ml_tensors_data_h in, ml_tensors_data_h out)
   out_tensors = (GstTensorMemory *) out_data->tensors;
 
   /** invoke the thread */
+  if (single_h->model)
+    g_mutex_lock (&single_h->model->lock);
   if (!single_h->klass->invoke (single_h->filter, in_tensors, out_tensors,
-          single_h->free_output)) {
+          alloc_output))
+    status = ML_ERROR_STREAMS_PIPE;
+  if (single_h->model)
+    g_mutex_unlock (&single_h->model->lock);
+
+  if (status != ML_ERROR_NONE) {
     const char *fw_name = _ml_get_nnfw_subplugin_name (single_h->nnfw);
     _ml_error_report
         ("Failed to invoke the tensors. The invoke callback of the tensor-filter subplugin '%s' has failed. Please contact the author of tensor-filter-%s (nnstreamer-%s) or review its source code. Note that this usually happens when the designated framework does not support the given model (e.g., trying to run tf-lite 2.6 model with tf-lite 1.13).",
         fw_name, fw_name, fw_name);
-    status = ML_ERROR_STREAMS_PIPE;
   }
 
   return status;
 }
 
+/**
+ * @brief Internal function to check the result of the request should be dropped.
+ * @details The result is dropped if the caller has returned back with timeout, or the request is cancelled or its deadline has passed.
+ * @note This is called with the handle locked.
+ */
+static gboolean
+__request_is_dropped (ml_single_request * request)
+{
+  if (request->drop_status == ML_ERROR_NONE && request->deadline > 0 &&
+      g_get_monotonic_time () > request->deadline)
+    request->drop_status = ML_ERROR_TIMED_OUT;
+
+  return (request->abandoned || request->drop_status != ML_ERROR_NONE);
+}
+
 /**
  * @brief Internal function to post-process given output.
  */
 static inline void
-__process_output (ml_single * single_h, ml_tensors_data_h output)
+__process_output (ml_single * single_h, ml_single_request * request)
 {
   ml_tensors_data_s *out_data;
 
-  if (!single_h->free_output) {
+  if (!request->free_output) {
     /* Do nothing. The output handle is not allocated in single-shot process. */
     return;
   }
 
-  if (g_list_find (single_h->destroy_data_list, output)) {
+  out_data = (ml_tensors_data_s *) request->output;
+
+  if (__request_is_dropped (request)) {
     /**
-     * Caller of the invoke thread has returned back with timeout.
+     * Caller of the invoke thread has returned back with timeout, or the
+     * request is cancelled or expired.
      * So, free the memory allocated by the invoke as their is no receiver.
+     * The handle is locked here, thus release the framework memory directly
+     * instead of the destroy callback. Otherwise, return the buffers to the pool.
      */
-    single_h->destroy_data_list =
-        g_list_remove (single_h->destroy_data_list, output);
-    ml_tensors_data_destroy (output);
+    if (single_h->klass->allocate_in_invoke (single_h->filter)) {
+      __destroy_notify (out_data, single_h);
+      _ml_tensors_data_destroy_internal (out_data, FALSE);
+    } else {
+      _ml_tensors_data_destroy_internal (out_data, TRUE);
+    }
+    request->output = NULL;
   } else {
-    out_data = (ml_tensors_data_s *) output;
     set_destroy_notify (single_h, out_data, FALSE);
   }
 }
 
 /**
- * @brief Initializes the rank information with default value.
+ * @brief Internal function to complete the request not processed by the invoke thread.
+ * @note This is called with the handle locked, and the lock is released while calling the callback.
+ *       The caller other than the invoke thread and close should be counted in 'waiting' not to free the handle meanwhile.
  */
-static int
-_ml_tensors_rank_initialize (guint * rank)
+static void
+__cancel_request (ml_single * single_h, ml_single_request * request,
+    int status)
 {
-  guint i;
+  if (request->id != 0)
+    g_hash_table_remove (single_h->pending, GUINT_TO_POINTER (request->id));
 
-  if (!rank)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, rank, is NULL. Provide a valid pointer.");
+  if (request->free_input)
+    ml_tensors_data_destroy (request->input);
+  request->input = NULL;
 
-  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
-    rank[i] = 0;
-  }
+  request->status = status;
+  g_atomic_int_set (&request->done, TRUE);
 
-  return ML_ERROR_NONE;
+  if (request->cb) {
+    g_mutex_unlock (&single_h->mutex);
+    request->cb (status, NULL, request->user_data);
+    g_mutex_lock (&single_h->mutex);
+    g_free (request);
+  } else {
+    /* The caller waiting for the result will free the request. */
+    g_cond_broadcast (&single_h->cond);
+  }
 }
 
 /**
- * @brief Sets the rank information with given value.
+ * @brief Internal function to busy-wait until the value is changed from the given one.
+ * @note This is called with the handle unlocked.
+ * @return TRUE if the value is changed, FALSE if the time is over.
  */
-static int
-_ml_tensors_set_rank (guint * rank, guint val)
+static gboolean
+__spin_until_changed (gint * value, gint old, gint64 end_time)
 {
-  guint i;
+  guint n = 0;
 
-  if (!rank)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, rank, is NULL. Provide a valid pointer.");
+  while (g_atomic_int_get (value) == old) {
+    /* Reading the clock is more expensive than polling the value. */
+    if ((++n & 0x3fU) == 0 && g_get_monotonic_time () >= end_time)
+      return FALSE;
 
-  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
-    rank[i] = val;
+    SINGLE_CPU_RELAX ();
   }
 
-  return ML_ERROR_NONE;
+  return TRUE;
 }
 
 /**
- * @brief thread to execute calls to invoke
- *
- * @details The thread behavior is detailed as below:
- *          - Starting with IDLE state, the thread waits for an input or change
- *          in state externally.
- *          - If state is not RUNNING, exit this thread, else process the
- *          request.
- *          - Process input, call invoke, process output. Any error in this
- *          state sets the status to be used by ml_single_invoke().
- *          - State is set back to IDLE and thread moves back to start.
- *
- *          State changes performed by this function when:
- *          RUNNING -> IDLE - processing is finished.
- *          JOIN_REQUESTED -> IDLE - close is requested.
- *
- * @note Error while processing an input is provided back to requesting
- *       function, and further processing of invoke_thread is not affected.
+ * @brief Internal function for the invoke thread to spin for a new request before sleeping.
+ * @note This is called by the invoke thread with the handle locked, and the lock is released while spinning.
+ * @return TRUE if a request is pushed while spinning.
  */
-static void *
-invoke_thread (void *arg)
+static gboolean
+__spin_for_request (ml_single * single_h)
 {
-  ml_single *single_h;
-  ml_tensors_data_h input, output;
+  gint seq;
+  gint64 end_time;
+  gboolean pushed;
 
-  single_h = (ml_single *) arg;
+  seq = g_atomic_int_get (&single_h->push_seq);
+  end_time = g_get_monotonic_time () + single_h->spin_us;
 
+  g_mutex_unlock (&single_h->mutex);
+  pushed = __spin_until_changed (&single_h->push_seq, seq, end_time);
   g_mutex_lock (&single_h->mutex);
 
-  while (single_h->state <= RUNNING) {
-    int status = ML_ERROR_NONE;
+  /* The request may be pushed after the last poll and before the lock. */
+  if (!pushed)
+    pushed = (g_atomic_int_get (&single_h->push_seq) != seq);
 
-    /** wait for data */
-    while (single_h->state != RUNNING) {
-      g_cond_wait (&single_h->cond, &single_h->mutex);
-      if (single_h->state >= JOIN_REQUESTED)
-        goto exit;
-    }
+  return pushed;
+}
 
-    input = single_h->input;
-    output = single_h->output;
-    /* Set null to prevent double-free. */
-    single_h->input = NULL;
+/**
+ * @brief Internal function for the caller to spin for the result of the request before sleeping.
+ * @note This is called with the handle locked, and the lock is released while spinning.
+ * @param[in] end_time The monotonic time to give up waiting for the result, 0 to wait infinitely.
+ */
+static void
+__spin_for_done (ml_single * single_h, ml_single_request * request,
+    gint64 end_time)
+{
+  gint64 spin_end;
 
-    single_h->invoking = TRUE;
-    g_mutex_unlock (&single_h->mutex);
-    status = __invoke (single_h, input, output);
-    g_mutex_lock (&single_h->mutex);
-    /* Clear input data after invoke is done. */
-    ml_tensors_data_destroy (input);
-    single_h->invoking = FALSE;
+  spin_end = g_get_monotonic_time () + single_h->spin_us;
+  if (end_time > 0 && end_time < spin_end)
+    spin_end = end_time;
 
-    if (status != ML_ERROR_NONE) {
-      if (single_h->free_output) {
-        single_h->destroy_data_list =
-            g_list_remove (single_h->destroy_data_list, output);
-        ml_tensors_data_destroy (output);
-      }
+  g_mutex_unlock (&single_h->mutex);
+  __spin_until_changed (&request->done, FALSE, spin_end);
+  g_mutex_lock (&single_h->mutex);
+}
+
+/**
+ * @brief Internal function to push the request into the queue of the invoke thread.
+ * @details If the queue is full, this waits for the room, returns an error, or drops the oldest request in the queue according to the property 'queue-policy'.
+ * @note This is called with the handle locked.
+ * @param[in] end_time The monotonic time to give up waiting for the room, 0 to wait infinitely.
+ */
+static int
+__push_request (ml_single * single_h, ml_single_request * request,
+    gint64 end_time)
+{
+  ml_single_request *oldest;
+
+  while (TRUE) {
+    /* The handle may be closed while waiting for the room. */
+    if (G_UNLIKELY (single_h->state == JOIN_REQUESTED))
+      _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+          "The handle (single_h single) is closed or being closed. Invoking with such a handle is not allowed. Please open another single_h handle to invoke.");
 
-      goto wait_for_next;
+    if (g_queue_get_length (&single_h->requests) < single_h->queue_size)
+      break;
+
+    switch (single_h->policy) {
+      case QUEUE_POLICY_FAIL:
+        _ml_error_report_return (ML_ERROR_TRY_AGAIN,
+            "The handle (single_h single) is busy. The request queue is full (%u requests). Please retry invoking again later when the handle becomes idle, or set the property 'queue-policy' to 'block'.",
+            single_h->queue_size);
+      case QUEUE_POLICY_DROP_OLDEST:
+        oldest = (ml_single_request *) g_queue_pop_head (&single_h->requests);
+        single_h->queue_dropped++;
+        _ml_logw ("The request queue is full. Drop the oldest request.");
+        __cancel_request (single_h, oldest, ML_ERROR_TRY_AGAIN);
+        break;
+      case QUEUE_POLICY_BLOCK:
+      default:
+        if (end_time > 0) {
+          if (!g_cond_wait_until (&single_h->cond, &single_h->mutex, end_time)
+              && g_queue_get_length (&single_h->requests) >=
+              single_h->queue_size) {
+            _ml_logw ("Wait for the room of the request queue has timed out");
+            return ML_ERROR_TIMED_OUT;
+          }
+        } else {
+          g_cond_wait (&single_h->cond, &single_h->mutex);
+        }
+        break;
     }
+  }
 
-    __process_output (single_h, output);
+  request->queued_time = g_get_monotonic_time ();
+  g_queue_push_tail (&single_h->requests, request);
+  g_atomic_int_inc (&single_h->push_seq);
 
-    /** loop over to wait for the next element */
-  wait_for_next:
-    single_h->status = status;
-    if (single_h->state == RUNNING)
-      single_h->state = IDLE;
-    g_cond_broadcast (&single_h->cond);
+  /* Wake up "invoke_thread" */
+  g_cond_broadcast (&single_h->cond);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to take the oldest request from the queue.
+ * @details The requests of which deadline has passed in the queue are dropped without invoking the model.
+ * @note This is called by the invoke thread with the handle locked, and the lock is released while calling the callback of the dropped request.
+ */
+static ml_single_request *
+__pop_request (ml_single * single_h)
+{
+  ml_single_request *request;
+
+  while ((request = (ml_single_request *)
+          g_queue_pop_head (&single_h->requests)) != NULL) {
+    if (request->deadline == 0 || !__request_is_dropped (request))
+      break;
+
+    single_h->queue_dropped++;
+    _ml_logw ("The deadline of the request has passed in the queue. Drop the request.");
+    __cancel_request (single_h, request, request->drop_status);
   }
 
-exit:
-  /* Do not set IDLE if JOIN_REQUESTED */
-  if (single_h->state == RUNNING)
-    single_h->state = IDLE;
-  g_mutex_unlock (&single_h->mutex);
-  return NULL;
+  return request;
 }
 
 /**
- * @brief Sets the information (tensor dimension, type, name and so on) of required input data for the given model, and get updated output data information.
- * @details Note that a model/framework may not support setting such information.
- * @since_tizen 6.0
- * @param[in] single The model handle.
- * @param[in] in_info The handle of input tensors information.
- * @param[out] out_info The handle of output tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
- * @return @c 0 on success. Otherwise a negative error value.
- * @retval #ML_ERROR_NONE Successful
- * @retval #ML_ERROR_NOT_SUPPORTED This implies that the given framework does not support dynamic dimensions.
- *         Use ml_single_get_input_info() and ml_single_get_output_info() instead for this framework.
- * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @brief Initializes the rank information with default value.
  */
 static int
-ml_single_update_info (ml_single_h single,
-    const ml_tensors_info_h in_info, ml_tensors_info_h * out_info)
+_ml_tensors_rank_initialize (guint * rank)
 {
-  if (!single)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, single (ml_single_h), is NULL. It should be a valid ml_single_h instance, usually created by ml_single_open().");
-  if (!in_info)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, in_info (const ml_tensors_info_h), is NULL. It should be a valid instance of ml_tensors_info_h, usually created by ml_tensors_info_create() and configured by the application.");
-  if (!out_info)
+  guint i;
+
+  if (!rank)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, out_info (ml_tensors_info_h *), is NULL. It should be a valid pointer to an instance ml_tensors_info_h, usually created by ml_tensors_info_h(). Note that out_info is supposed to be overwritten by this API call.");
+        "The parameter, rank, is NULL. Provide a valid pointer.");
 
-  /* init null */
-  *out_info = NULL;
+  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
+    rank[i] = 0;
+  }
 
-  _ml_error_report_return_continue_iferr (ml_single_set_input_info (single,
-          in_info),
-      "Configuring the neural network model with the given input information has failed with %d error code. The given input information ('in_info' parameter) might be invalid or the given neural network cannot accept it as its input data.",
-      _ERRNO);
+  return ML_ERROR_NONE;
+}
 
-  __setup_in_out_tensors (single);
-  _ml_error_report_return_continue_iferr (ml_single_get_output_info (single,
-          out_info),
-      "Fetching output info after configuring input information has failed with %d error code.",
-      _ERRNO);
+/**
+ * @brief Sets the rank information with given value.
+ */
+static int
+_ml_tensors_set_rank (guint * rank, guint val)
+{
+  guint i;
+
+  if (!rank)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, rank, is NULL. Provide a valid pointer.");
+
+  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
+    rank[i] = val;
+  }
 
   return ML_ERROR_NONE;
 }
 
 /**
- * @brief Internal function to get the gst info from tensor-filter.
+ * @brief Internal function to get the bucket of the latency histogram.
+ */
+static guint
+__latency_bucket (gint64 usec)
+{
+  guint msb, sub, idx;
+
+  if (usec < 1)
+    return 0;
+
+  msb = g_bit_storage ((gulong) usec) - 1;
+  if (msb >= 2)
+    sub = (guint) (usec >> (msb - 2)) & 3U;
+  else
+    sub = (guint) (usec << (2 - msb)) & 3U;
+
+  idx = msb * 4 + sub;
+  return MIN (idx, SINGLE_LATENCY_BUCKETS - 1);
+}
+
+/**
+ * @brief Internal function to get the lower bound of the bucket in usec.
+ */
+static gint64
+__latency_bucket_value (guint idx)
+{
+  guint msb = idx / 4, sub = idx % 4;
+
+  if (msb >= 2)
+    return ((gint64) (4 + sub)) << (msb - 2);
+  return ((gint64) (4 + sub)) >> (2 - msb);
+}
+
+/**
+ * @brief Internal function to add the latency (from the request to the output) to the histogram.
+ * @note This is called with the handle locked.
  */
 static void
-ml_single_get_gst_info (ml_single * single_h, gboolean is_input,
-    GstTensorsInfo * gst_info)
+__record_latency (ml_single * single_h, gint64 start_time)
 {
-  const gchar *prop_prefix, *prop_name, *prop_type;
-  gchar *val;
-  guint num;
+  gint64 latency = g_get_monotonic_time () - start_time;
 
-  if (is_input) {
-    prop_prefix = INPUT_STR;
-    prop_type = CONCAT_MACRO_STR (INPUT_STR, TYPE_STR);
-    prop_name = CONCAT_MACRO_STR (INPUT_STR, NAME_STR);
-  } else {
-    prop_prefix = OUTPUT_STR;
-    prop_type = CONCAT_MACRO_STR (OUTPUT_STR, TYPE_STR);
-    prop_name = CONCAT_MACRO_STR (OUTPUT_STR, NAME_STR);
-  }
+  single_h->latency_hist[__latency_bucket (latency)]++;
+  single_h->latency_count++;
+  if (latency > single_h->latency_max)
+    single_h->latency_max = latency;
+}
 
-  gst_tensors_info_init (gst_info);
+/**
+ * @brief Internal function to get the latency of the given percentile from the histogram.
+ * @details The latency is interpolated linearly in the bucket, supposing the latencies in the bucket are evenly spread.
+ * @note This is called with the handle locked.
+ */
+static gint64
+__latency_percentile (ml_single * single_h, guint percent)
+{
+  guint64 rank, count, sum = 0;
+  gint64 lower, upper;
+  guint i;
 
-  /* get dimensions */
-  g_object_get (single_h->filter, prop_prefix, &val, NULL);
-  num = gst_tensors_info_parse_dimensions_string (gst_info, val);
-  g_free (val);
+  if (single_h->latency_count == 0)
+    return 0;
 
-  /* set the number of tensors */
-  gst_info->num_tensors = num;
+  rank = (single_h->latency_count * percent + 99) / 100;
+  for (i = 0; i < SINGLE_LATENCY_BUCKETS; i++) {
+    count = single_h->latency_hist[i];
+    if (sum + count < rank) {
+      sum += count;
+      continue;
+    }
 
-  /* get types */
-  g_object_get (single_h->filter, prop_type, &val, NULL);
-  num = gst_tensors_info_parse_types_string (gst_info, val);
-  g_free (val);
+    /* The last latency in the bucket, the last bucket has no upper bound. */
+    lower = __latency_bucket_value (i);
+    if (i + 1 < SINGLE_LATENCY_BUCKETS)
+      upper = __latency_bucket_value (i + 1) - 1;
+    else
+      upper = single_h->latency_max;
+    upper = MIN (upper, single_h->latency_max);
 
-  if (gst_info->num_tensors != num) {
-    _ml_logw ("The number of tensor type is mismatched in filter.");
+    if (upper <= lower)
+      return MIN (lower, single_h->latency_max);
+
+    return lower + (gint64) ((gdouble) (upper - lower) * (rank - sum) / count);
   }
 
-  /* get names */
-  g_object_get (single_h->filter, prop_name, &val, NULL);
-  num = gst_tensors_info_parse_names_string (gst_info, val);
-  g_free (val);
+  return single_h->latency_max;
+}
 
-  if (gst_info->num_tensors != num) {
-    _ml_logw ("The number of tensor name is mismatched in filter.");
+/**
+ * @brief Internal function to get the latency statistics as a string.
+ * @details The average latency of the framework is from the statistics of the tensor-filter sub-plugin, which is shared in the process.
+ * @note This is called with the handle locked.
+ */
+static gchar *
+__latency_stats_string (ml_single * single_h)
+{
+  const GstTensorFilterFramework *fw;
+  const gchar *fw_name;
+  gint64 fw_avg = 0;
+
+  fw_name = _ml_get_nnfw_subplugin_name (single_h->nnfw);
+  fw = fw_name ? nnstreamer_filter_find (fw_name) : NULL;
+  if (fw && fw->statistics && fw->statistics->total_invoke_num > 0) {
+    fw_avg = fw->statistics->total_invoke_latency /
+        fw->statistics->total_invoke_num;
   }
+
+  return g_strdup_printf ("count=%" G_GUINT64_FORMAT ",p50=%" G_GINT64_FORMAT
+      ",p90=%" G_GINT64_FORMAT ",p99=%" G_GINT64_FORMAT ",max=%"
+      G_GINT64_FORMAT ",framework-avg=%" G_GINT64_FORMAT,
+      single_h->latency_count, __latency_percentile (single_h, 50),
+      __latency_percentile (single_h, 90), __latency_percentile (single_h,
+          99), single_h->latency_max, fw_avg);
 }
 
 /**
- * @brief Internal function to set the gst info in tensor-filter.
+ * @brief Internal function to update the statistics of the request queue.
+ * @note This is called by the invoke thread with the handle locked.
+ */
+static void
+__update_queue_stats (ml_single * single_h, ml_single_request * request)
+{
+  gint64 wait_time;
+
+  wait_time = g_get_monotonic_time () - request->queued_time;
+  single_h->queue_processed++;
+  single_h->queue_wait_total += wait_time;
+  if (wait_time > single_h->queue_wait_max)
+    single_h->queue_wait_max = wait_time;
+}
+
+/**
+ * @brief Internal function to configure the tensor-filter with the batch of the given size.
+ * @details The input tensors are stacked along the outermost dimension, and the batch size 1 restores the original input of the model.
+ * @note This is called by the invoke thread with the handle locked.
  */
 static int
-ml_single_set_gst_info (ml_single * single_h, const ml_tensors_info_h info)
+__set_batch_size (ml_single * single_h, guint num)
 {
   GstTensorsInfo gst_in_info, gst_out_info;
-  int status = ML_ERROR_NONE;
-  int ret = -EINVAL;
+  guint i, rank;
+  int ret, status = ML_ERROR_NONE;
+
+  if (single_h->batch_configured == num)
+    return ML_ERROR_NONE;
+
+  /* The model is shared, other handles use the same input info. */
+  if (__model_is_shared (single_h))
+    return ML_ERROR_NOT_SUPPORTED;
 
   _ml_error_report_return_continue_iferr
-      (_ml_tensors_info_copy_from_ml (&gst_in_info, info),
-      "Cannot fetch tensor-info from the given info parameter. Error code: %d",
+      (_ml_tensors_info_copy_from_ml (&gst_in_info, &single_h->in_info),
+      "Cannot fetch tensor-info from the single_h handle. Error code: %d",
       _ERRNO);
 
+  for (i = 0; i < gst_in_info.num_tensors; i++) {
+    rank = single_h->input_ranks[i];
+    if (rank == 0 || rank > NNS_TENSOR_RANK_LIMIT)
+      rank = ML_TENSOR_RANK_LIMIT_PREV;
+
+    gst_in_info.info[i].dimension[rank - 1] *= num;
+  }
+
+  gst_tensors_info_init (&gst_out_info);
   ret = single_h->klass->set_input_info (single_h->filter, &gst_in_info,
       &gst_out_info);
-  if (ret == 0) {
-    _ml_error_report_return_continue_iferr
-        (_ml_tensors_info_copy_from_gst (&single_h->in_info, &gst_in_info),
-        "Fetching input information from the given single_h instance has failed with %d",
-        _ERRNO);
-    _ml_error_report_return_continue_iferr (_ml_tensors_info_copy_from_gst
-        (&single_h->out_info, &gst_out_info),
-        "Fetching output information from the given single_h instance has failed with %d",
-        _ERRNO);
-    __setup_in_out_tensors (single_h);
-  } else if (ret == -ENOENT) {
+  if (ret != 0) {
     status = ML_ERROR_NOT_SUPPORTED;
-  } else {
-    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  single_h->batch_configured = num;
+
+  /* The output of a batch should be the stacked outputs of the model. */
+  if (gst_out_info.num_tensors != single_h->out_tensors.num_tensors) {
+    status = ML_ERROR_NOT_SUPPORTED;
+    goto done;
+  }
+
+  for (i = 0; i < gst_out_info.num_tensors; i++) {
+    if (gst_tensor_info_get_size (&gst_out_info.info[i]) !=
+        single_h->out_tensors.tensors[i].size * num) {
+      status = ML_ERROR_NOT_SUPPORTED;
+      goto done;
+    }
   }
 
+done:
+  gst_tensors_info_free (&gst_in_info);
+  gst_tensors_info_free (&gst_out_info);
   return status;
 }
 
 /**
- * @brief Set the info for input/output tensors
+ * @brief Internal function to gather the requests in the queue for a batch.
+ * @details This waits for the requests up to 'max-wait-us' until the number of requests reaches 'max-batch'.
+ * @note This is called by the invoke thread with the handle locked. The first request should be set in the batch.
+ * @return The number of requests in the batch.
  */
-static int
-ml_single_set_inout_tensors_info (GObject * object,
-    const gboolean is_input, ml_tensors_info_s * tensors_info)
+static guint
+__gather_batch (ml_single * single_h)
 {
-  int status = ML_ERROR_NONE;
-  GstTensorsInfo info;
-  gchar *str_dim, *str_type, *str_name;
-  const gchar *str_type_name, *str_name_name;
-  const gchar *prefix;
+  ml_single_request *request;
+  gint64 end_time;
+  guint num = 1;
 
-  if (is_input) {
-    prefix = INPUT_STR;
-    str_type_name = CONCAT_MACRO_STR (INPUT_STR, TYPE_STR);
-    str_name_name = CONCAT_MACRO_STR (INPUT_STR, NAME_STR);
-  } else {
-    prefix = OUTPUT_STR;
-    str_type_name = CONCAT_MACRO_STR (OUTPUT_STR, TYPE_STR);
-    str_name_name = CONCAT_MACRO_STR (OUTPUT_STR, NAME_STR);
-  }
+  end_time = g_get_monotonic_time () + single_h->max_wait_us;
 
-  _ml_error_report_return_continue_iferr
-      (_ml_tensors_info_copy_from_ml (&info, tensors_info),
-      "Cannot fetch tensor-info from the given information. Error code: %d",
-      _ERRNO);
-
-  /* Set input option */
-  str_dim = gst_tensors_info_get_dimensions_string (&info);
-  str_type = gst_tensors_info_get_types_string (&info);
-  str_name = gst_tensors_info_get_names_string (&info);
+  while (num < single_h->max_batch) {
+    request = __pop_request (single_h);
+    if (request) {
+      __update_queue_stats (single_h, request);
+      single_h->batch[num++] = request;
+      continue;
+    }
 
-  if (!str_dim || !str_type || !str_name) {
-    if (!str_dim)
-      _ml_error_report
-          ("Cannot fetch specific tensor-info from the given information: cannot fetch tensor dimension information.");
-    if (!str_type)
-      _ml_error_report
-          ("Cannot fetch specific tensor-info from the given information: cannot fetch tensor type information.");
-    if (!str_name)
-      _ml_error_report
-          ("Cannot fetch specific tensor-info from the given information: cannot fetch tensor name information. Even if tensor names are not defined, this should be able to fetch a list of empty strings.");
+    if (single_h->state >= JOIN_REQUESTED)
+      break;
 
-    status = ML_ERROR_INVALID_PARAMETER;
-  } else {
-    g_object_set (object, prefix, str_dim, str_type_name, str_type,
-        str_name_name, str_name, NULL);
+    if (!g_cond_wait_until (&single_h->cond, &single_h->mutex, end_time)
+        && g_queue_is_empty (&single_h->requests))
+      break;
   }
 
-  g_free (str_dim);
-  g_free (str_type);
-  g_free (str_name);
-
-  gst_tensors_info_free (&info);
-
-  return status;
+  return num;
 }
 
 /**
- * @brief Internal static function to set tensors info in the handle.
+ * @brief Internal function to invoke the model once with the requests gathered for a batch.
+ * @details The inputs are stacked along the outermost dimension, and the output is split back to each request.
+ * @note This is called by the invoke thread with the handle locked.
  */
-static gboolean
-ml_single_set_info_in_handle (ml_single_h single, gboolean is_input,
-    ml_tensors_info_s * tensors_info)
+static int
+__invoke_batch (ml_single * single_h, guint num)
 {
+  ml_tensors_data_s in_batch, out_batch;
+  ml_tensors_data_s *data;
+  ml_single_request *request;
+  size_t size;
+  guint i, j;
+  gboolean alloc_in_invoke;
   int status;
-  ml_single *single_h;
-  ml_tensors_info_s *dest;
-  gboolean configured = FALSE;
-  gboolean is_valid = FALSE;
-  GObject *filter_obj;
 
-  single_h = (ml_single *) single;
-  filter_obj = G_OBJECT (single_h->filter);
+  status = __set_batch_size (single_h, num);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-  if (is_input) {
-    dest = &single_h->in_info;
-    configured = single_h->klass->input_configured (single_h->filter);
-  } else {
-    dest = &single_h->out_info;
-    configured = single_h->klass->output_configured (single_h->filter);
+  memset (&in_batch, 0, sizeof (ml_tensors_data_s));
+  memset (&out_batch, 0, sizeof (ml_tensors_data_s));
+
+  in_batch.num_tensors = single_h->in_tensors.num_tensors;
+  out_batch.num_tensors = single_h->out_tensors.num_tensors;
+
+  single_h->invoking = TRUE;
+  g_mutex_unlock (&single_h->mutex);
+
+  for (i = 0; i < in_batch.num_tensors; i++) {
+    size = single_h->in_tensors.tensors[i].size;
+
+    in_batch.tensors[i].size = size * num;
+    in_batch.tensors[i].tensor = g_malloc (in_batch.tensors[i].size);
+
+    for (j = 0; j < num; j++) {
+      data = (ml_tensors_data_s *) single_h->batch[j]->input;
+      memcpy ((guint8 *) in_batch.tensors[i].tensor + size * j,
+          data->tensors[i].tensor, size);
+    }
   }
 
-  if (configured) {
-    /* get configured info and compare with input info */
-    GstTensorsInfo gst_info;
-    ml_tensors_info_h info = NULL;
+  for (i = 0; i < out_batch.num_tensors; i++) {
+    out_batch.tensors[i].size = single_h->out_tensors.tensors[i].size * num;
+    out_batch.tensors[i].tensor = g_malloc (out_batch.tensors[i].size);
+  }
 
-    ml_single_get_gst_info (single_h, is_input, &gst_info);
-    _ml_tensors_info_create_from_gst (&info, &gst_info);
+  status = __invoke (single_h, &in_batch, &out_batch, FALSE);
 
-    gst_tensors_info_free (&gst_info);
+  g_mutex_lock (&single_h->mutex);
+  single_h->invoking = FALSE;
 
-    if (tensors_info && !ml_tensors_info_is_equal (tensors_info, info)) {
-      /* given input info is not matched with configured */
-      ml_tensors_info_destroy (info);
-      if (is_input) {
-        /* try to update tensors info */
-        status = ml_single_update_info (single, tensors_info, &info);
-        if (status != ML_ERROR_NONE)
-          goto done;
-      } else {
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  /* Split the output of the batch. */
+  for (j = 0; j < num; j++) {
+    request = single_h->batch[j];
+
+    if (__request_is_dropped (request))
+      continue;
+
+    alloc_in_invoke = FALSE;
+    if (request->free_output) {
+      status = __alloc_output (single_h, &request->output, &alloc_in_invoke);
+      if (status != ML_ERROR_NONE)
         goto done;
+    }
+
+    data = (ml_tensors_data_s *) request->output;
+    for (i = 0; i < out_batch.num_tensors; i++) {
+      size = single_h->out_tensors.tensors[i].size;
+
+      if (alloc_in_invoke) {
+        data->tensors[i].tensor =
+            _ml_tensors_data_alloc_buffer (data->info, size, FALSE);
+        if (!data->tensors[i].tensor) {
+          _ml_error_report
+              ("Failed to allocate the buffers of the output. Out of memory?");
+          status = ML_ERROR_OUT_OF_MEMORY;
+          goto done;
+        }
       }
+      memcpy (data->tensors[i].tensor,
+          (guint8 *) out_batch.tensors[i].tensor + size * j, size);
     }
+  }
 
-    ml_tensors_info_clone (dest, info);
-    ml_tensors_info_destroy (info);
-  } else if (tensors_info) {
-    status =
-        ml_single_set_inout_tensors_info (filter_obj, is_input, tensors_info);
-    if (status != ML_ERROR_NONE)
-      goto done;
-    ml_tensors_info_clone (dest, tensors_info);
+done:
+  if (status != ML_ERROR_NONE) {
+    for (j = 0; j < num; j++) {
+      request = single_h->batch[j];
+
+      if (request->free_output && request->output) {
+        ml_tensors_data_destroy (request->output);
+        request->output = NULL;
+      }
+    }
   }
 
-  is_valid = ml_tensors_info_is_valid (dest);
+  for (i = 0; i < in_batch.num_tensors; i++)
+    g_free (in_batch.tensors[i].tensor);
+  for (i = 0; i < out_batch.num_tensors; i++)
+    g_free (out_batch.tensors[i].tensor);
 
-done:
-  return is_valid;
+  return status;
 }
 
 /**
- * @brief Internal function to create and initialize the single handle.
+ * @brief Internal function to invoke the model with the request.
+ * @note This is called by the invoke thread with the handle locked.
  */
-static ml_single *
-ml_single_create_handle (ml_nnfw_type_e nnfw)
+static int
+__invoke_request (ml_single * single_h, ml_single_request * request)
 {
-  ml_single *single_h;
-  GError *error;
+  gboolean alloc_in_invoke = FALSE;
+  int status;
 
-  single_h = g_new0 (ml_single, 1);
-  if (single_h == NULL)
-    _ml_error_report_return (NULL,
-        "Failed to allocate memory for the single_h handle. Out of memory?");
+  /* Restore the input of the model if it is configured for a batch. */
+  status = __set_batch_size (single_h, 1);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-  single_h->filter = g_object_new (G_TYPE_TENSOR_FILTER_SINGLE, NULL);
-  if (single_h->filter == NULL) {
-    _ml_error_report
-        ("Failed to create a new instance for filter. Out of memory?");
-    g_free (single_h);
-    return NULL;
+  if (request->free_output) {
+    status = __alloc_output (single_h, &request->output, &alloc_in_invoke);
+    if (status != ML_ERROR_NONE)
+      return status;
   }
 
-  single_h->magic = ML_SINGLE_MAGIC;
-  single_h->timeout = SINGLE_DEFAULT_TIMEOUT;
-  single_h->nnfw = nnfw;
-  single_h->state = IDLE;
-  single_h->thread = NULL;
-  single_h->input = NULL;
-  single_h->output = NULL;
-  single_h->destroy_data_list = NULL;
+  single_h->invoking = TRUE;
+  g_mutex_unlock (&single_h->mutex);
+  status = __invoke (single_h, request->input, request->output,
+      alloc_in_invoke);
+  g_mutex_lock (&single_h->mutex);
   single_h->invoking = FALSE;
 
-  _ml_tensors_info_initialize (&single_h->in_info);
-  _ml_tensors_info_initialize (&single_h->out_info);
-  _ml_tensors_rank_initialize (single_h->input_ranks);
-  _ml_tensors_rank_initialize (single_h->output_ranks);
-  g_mutex_init (&single_h->mutex);
-  g_cond_init (&single_h->cond);
-
-  single_h->klass = g_type_class_ref (G_TYPE_TENSOR_FILTER_SINGLE);
-  if (single_h->klass == NULL) {
-    _ml_error_report
-        ("Failed to get class of the tensor-filter of single API. This binary is not compiled properly or required libraries are not loaded.");
-    ml_single_close (single_h);
-    return NULL;
-  }
+  if (status != ML_ERROR_NONE) {
+    if (request->free_output) {
+      ml_tensors_data_destroy (request->output);
+      request->output = NULL;
+    }
 
-  single_h->thread =
-      g_thread_try_new (NULL, invoke_thread, (gpointer) single_h, &error);
-  if (single_h->thread == NULL) {
-    _ml_error_report
-        ("Failed to create the invoke thread of single API, g_thread_try_new has reported an error: %s.",
-        error->message);
-    g_clear_error (&error);
-    ml_single_close (single_h);
-    return NULL;
+    return status;
   }
 
-  return single_h;
+  __process_output (single_h, request);
+  return ML_ERROR_NONE;
 }
 
 /**
- * @brief Validate arguments for open
+ * @brief Internal function to pass the result to the caller of the request.
+ * @note This is called by the invoke thread with the handle locked, and the lock is released while calling the callback.
  */
-static int
-_ml_single_open_custom_validate_arguments (ml_single_h * single,
-    ml_single_preset * info)
+static void
+__complete_request (ml_single * single_h, ml_single_request * request,
+    int status)
 {
-  if (!single)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'single' (ml_single_h *), is NULL. It should be a valid pointer to an instance of ml_single_h.");
-  if (!info)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'info' (ml_single_preset *), is NULL. It should be a valid pointer to a valid instance of ml_single_preset.");
-
-  /* Validate input tensor info. */
-  if (info->input_info && !ml_tensors_info_is_valid (info->input_info))
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'info' (ml_single_preset *), is not valid. It has 'input_info' entry that cannot be validated. ml_tensors_info_is_valid(info->input_info) has failed while info->input_info exists.");
+  /* Clear input data after invoke is done. */
+  if (request->free_input)
+    ml_tensors_data_destroy (request->input);
+  request->input = NULL;
 
-  /* Validate output tensor info. */
-  if (info->output_info && !ml_tensors_info_is_valid (info->output_info))
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'info' (ml_single_preset *), is not valid. It has 'output_info' entry that cannot be validated. ml_tensors_info_is_valid(info->output_info) has failed while info->output_info exists.");
+  if (request->id != 0)
+    g_hash_table_remove (single_h->pending, GUINT_TO_POINTER (request->id));
 
-  if (!info->models)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'info' (ml_single_preset *), is not valid. Its models entry if NULL (info->models is NULL).");
+  /* The result has been dropped, pass the reason to the caller. */
+  if (request->drop_status != ML_ERROR_NONE) {
+    status = request->drop_status;
 
-  return ML_ERROR_NONE;
-}
+    if (request->output && request->free_output) {
+      ml_tensors_data_destroy (request->output);
+      request->output = NULL;
+    }
+  }
 
-/**
- * @brief Internal function to convert accelerator as tensor_filter property format.
- * @note returned value must be freed by the caller
- * @note More details on format can be found in gst_tensor_filter_install_properties() in tensor_filter_common.c.
- */
-char *
-_ml_nnfw_to_str_prop (const ml_nnfw_hw_e hw)
-{
-  const gchar *hw_name;
-  const gchar *use_accl = "true:";
-  gchar *str_prop = NULL;
+  request->status = status;
+  g_atomic_int_set (&request->done, TRUE);
 
-  hw_name = get_accl_hw_str (_ml_nnfw_to_accl_hw (hw));
-  str_prop = g_strdup_printf ("%s%s", use_accl, hw_name);
+  /* The latency covers queue wait, invoke and post-process. */
+  if (status == ML_ERROR_NONE && !request->no_latency)
+    __record_latency (single_h, request->queued_time);
 
-  return str_prop;
+  if (request->cb) {
+    /* The application owns the output from the callback. */
+    g_mutex_unlock (&single_h->mutex);
+    request->cb (status, request->output, request->user_data);
+    g_mutex_lock (&single_h->mutex);
+    g_free (request);
+  } else if (request->abandoned) {
+    /* The caller has returned back with timeout. */
+    if (request->output && request->free_output)
+      ml_tensors_data_destroy (request->output);
+    g_free (request);
+  }
 }
 
 /**
- * @brief Opens an ML model with the custom options and returns the instance as a handle.
+ * @brief thread to execute calls to invoke
+ *
+ * @details The thread behavior is detailed as below:
+ *          - Starting with IDLE state, the thread waits for a request in the
+ *          queue or change in state externally. If 'handoff-spin-us' is set,
+ *          the thread spins for a request before sleeping.
+ *          - If state is JOIN_REQUESTED, exit this thread, else take the
+ *          oldest request and set RUNNING.
+ *          - If 'max-batch' is set, gather more requests in the queue and
+ *          invoke the model once with the batch.
+ *          - Process input, call invoke, process output. Any error in this
+ *          state is set to the request, which is provided back to the waiting
+ *          caller, or passed to the callback of the asynchronous request.
+ *          - State is set back to IDLE and thread moves back to start.
+ *
+ *          State changes performed by this function when:
+ *          IDLE -> RUNNING - a request is taken from the queue.
+ *          RUNNING -> IDLE - processing is finished.
+ *          JOIN_REQUESTED -> IDLE - close is requested.
+ *
+ * @note Error while processing an input is provided back to requesting
+ *       function, and further processing of invoke_thread is not affected.
  */
-int
-ml_single_open_custom (ml_single_h * single, ml_single_preset * info)
+static void *
+invoke_thread (void *arg)
 {
   ml_single *single_h;
-  GObject *filter_obj;
-  int status = ML_ERROR_NONE;
-  ml_tensors_info_s *in_tensors_info, *out_tensors_info;
-  ml_nnfw_type_e nnfw;
-  ml_nnfw_hw_e hw;
-  const gchar *fw_name;
-  gchar **list_models;
-  guint num_models;
-  char *hw_name;
-
-  check_feature_state (ML_FEATURE_INFERENCE);
+  ml_single_request *request;
+  guint i, num;
 
-  /* Validate the params */
-  _ml_error_report_return_continue_iferr
-      (_ml_single_open_custom_validate_arguments (single, info),
-      "The parameter, 'info' (ml_single_preset *), cannot be validated. Please provide valid information for this object.");
+  single_h = (ml_single *) arg;
 
-  /* init null */
-  *single = NULL;
+  g_mutex_lock (&single_h->mutex);
 
-  in_tensors_info = (ml_tensors_info_s *) info->input_info;
-  out_tensors_info = (ml_tensors_info_s *) info->output_info;
-  nnfw = info->nnfw;
-  hw = info->hw;
-  fw_name = _ml_get_nnfw_subplugin_name (nnfw);
+  /* The scheduling of the thread is set with its kernel thread id. */
+#if defined (__linux__)
+  single_h->thread_tid = (gint) syscall (SYS_gettid);
+#else
+  single_h->thread_tid = -1;
+#endif
+  g_cond_broadcast (&single_h->cond);
 
-  /**
-   * 1. Determine nnfw and validate model file
-   */
-  list_models = g_strsplit (info->models, ",", -1);
-  num_models = g_strv_length (list_models);
+  while (single_h->state <= RUNNING) {
+    int status = ML_ERROR_NONE;
+    gboolean spun = FALSE;
 
-  status = _ml_validate_model_file ((const char **) list_models, num_models,
-      &nnfw);
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue
-        ("Cannot validate the model (1st model: %s. # models: %d). Error code: %d",
-        list_models[0], num_models, status);
-    g_strfreev (list_models);
-    return status;
-  }
+    /** wait for data */
+    while ((request = __pop_request (single_h)) == NULL) {
+      if (single_h->state >= JOIN_REQUESTED)
+        goto exit;
 
-  g_strfreev (list_models);
+      /**
+       * Spin for a while not to sleep between the requests in a row.
+       * The lock is released while spinning, so the queue and the state
+       * are checked again before sleeping not to miss the wakeup.
+       */
+      if (single_h->spin_us > 0 && !spun) {
+        spun = !__spin_for_request (single_h);
+        continue;
+      }
 
-  /**
-   * 2. Determine hw
-   * (Supposed CPU only) Support others later.
-   */
-  if (!_ml_nnfw_is_available (nnfw, hw)) {
-    _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
-        "The given nnfw, '%s', is not supported. There is no corresponding tensor-filter subplugin available or the given hardware requirement is not supported for the given nnfw.",
-        fw_name);
-  }
+      g_cond_wait (&single_h->cond, &single_h->mutex);
+      spun = FALSE;
+    }
 
-                                        /** Create ml_single object */
-  if ((single_h = ml_single_create_handle (nnfw)) == NULL) {
-    _ml_error_report_return_continue (ML_ERROR_OUT_OF_MEMORY,
-        "Cannot create handle for the given nnfw, %s", fw_name);
-  }
+    single_h->state = RUNNING;
+    __update_queue_stats (single_h, request);
 
-  filter_obj = G_OBJECT (single_h->filter);
+    num = 1;
+    if (single_h->max_batch > 1) {
+      single_h->batch[0] = request;
+      num = __gather_batch (single_h);
+    }
 
-  /**
-   * 3. Construct a direct connection with the nnfw.
-   * Note that we do not construct a pipeline since 2019.12.
-   */
-  if (nnfw == ML_NNFW_TYPE_TENSORFLOW || nnfw == ML_NNFW_TYPE_SNAP ||
-      nnfw == ML_NNFW_TYPE_PYTORCH || nnfw == ML_NNFW_TYPE_TRIX_ENGINE) {
-    /* set input and output tensors information */
-    if (in_tensors_info && out_tensors_info) {
-      status =
-          ml_single_set_inout_tensors_info (filter_obj, TRUE, in_tensors_info);
-      if (status != ML_ERROR_NONE) {
-        _ml_error_report_continue
-            ("Input tensors info is given; however, failed to set input tensors info. Error code: %d",
-            status);
-        goto error;
-      }
+    if (num > 1) {
+      status = __invoke_batch (single_h, num);
 
-      status =
-          ml_single_set_inout_tensors_info (filter_obj, FALSE,
-          out_tensors_info);
-      if (status != ML_ERROR_NONE) {
-        _ml_error_report_continue
-            ("Output tensors info is given; however, failed to set output tensors info. Error code: %d",
-            status);
-        goto error;
+      if (status == ML_ERROR_NOT_SUPPORTED) {
+        /* The model cannot be configured with the batch. Invoke each request. */
+        _ml_logw ("The model does not accept the batched input, disable batching.");
+        single_h->max_batch = 1;
+
+        for (i = 0; i < num; i++) {
+          request = single_h->batch[i];
+          status = __invoke_request (single_h, request);
+          __complete_request (single_h, request, status);
+        }
+      } else {
+        for (i = 0; i < num; i++)
+          __complete_request (single_h, single_h->batch[i], status);
       }
     } else {
-      _ml_error_report
-          ("To run the given nnfw, '%s', with a neural network model, both input and output information should be provided.",
-          fw_name);
-      status = ML_ERROR_INVALID_PARAMETER;
-      goto error;
-    }
-  } else if (nnfw == ML_NNFW_TYPE_ARMNN) {
-    /* set input and output tensors information, if available */
-    if (in_tensors_info) {
-      status =
-          ml_single_set_inout_tensors_info (filter_obj, TRUE, in_tensors_info);
-      if (status != ML_ERROR_NONE) {
-        _ml_error_report_continue
-            ("With nnfw '%s', input tensors info is optional. However, the user has provided an invalid input tensors info. Error code: %d",
-            fw_name, status);
-        goto error;
-      }
-    }
-    if (out_tensors_info) {
-      status =
-          ml_single_set_inout_tensors_info (filter_obj, FALSE,
-          out_tensors_info);
-      if (status != ML_ERROR_NONE) {
-        _ml_error_report_continue
-            ("With nnfw '%s', output tensors info is optional. However, the user has provided an invalid output tensors info. Error code: %d",
-            fw_name, status);
-        goto error;
-      }
+      status = __invoke_request (single_h, request);
+      __complete_request (single_h, request, status);
     }
+
+    /** loop over to wait for the next element */
+    if (single_h->state == RUNNING)
+      single_h->state = IDLE;
+    g_cond_broadcast (&single_h->cond);
   }
 
-  /* set accelerator, framework, model files and custom option */
-  if (info->fw_name) {
-    fw_name = (const char *) info->fw_name;
+exit:
+  /* Do not set IDLE if JOIN_REQUESTED */
+  if (single_h->state == RUNNING)
+    single_h->state = IDLE;
+  g_mutex_unlock (&single_h->mutex);
+  return NULL;
+}
+
+/**
+ * @brief Internal function to get the gst info from tensor-filter.
+ */
+static void
+ml_single_get_gst_info (ml_single * single_h, gboolean is_input,
+    GstTensorsInfo * gst_info)
+{
+  const gchar *prop_prefix, *prop_name, *prop_type;
+  gchar *val;
+  guint num;
+
+  if (is_input) {
+    prop_prefix = INPUT_STR;
+    prop_type = CONCAT_MACRO_STR (INPUT_STR, TYPE_STR);
+    prop_name = CONCAT_MACRO_STR (INPUT_STR, NAME_STR);
   } else {
-    fw_name = _ml_get_nnfw_subplugin_name (nnfw);       /* retry for "auto" */
+    prop_prefix = OUTPUT_STR;
+    prop_type = CONCAT_MACRO_STR (OUTPUT_STR, TYPE_STR);
+    prop_name = CONCAT_MACRO_STR (OUTPUT_STR, NAME_STR);
   }
-  hw_name = _ml_nnfw_to_str_prop (hw);
-  g_object_set (filter_obj, "framework", fw_name, "accelerator", hw_name,
-      "model", info->models, NULL);
-  g_free (hw_name);
 
-  if (info->custom_option) {
-    g_object_set (filter_obj, "custom", info->custom_option, NULL);
-  }
+  gst_tensors_info_init (gst_info);
 
-  /* 4. Start the nnfw to get inout configurations if needed */
-  if (!single_h->klass->start (single_h->filter)) {
-    _ml_error_report
-        ("Failed to start NNFW, '%s', to get inout configurations. Subplugin class method has failed to start.",
-        fw_name);
-    status = ML_ERROR_STREAMS_PIPE;
-    goto error;
+  /* get dimensions */
+  g_object_get (single_h->filter, prop_prefix, &val, NULL);
+  num = gst_tensors_info_parse_dimensions_string (gst_info, val);
+  g_free (val);
+
+  /* set the number of tensors */
+  gst_info->num_tensors = num;
+
+  /* get types */
+  g_object_get (single_h->filter, prop_type, &val, NULL);
+  num = gst_tensors_info_parse_types_string (gst_info, val);
+  g_free (val);
+
+  if (gst_info->num_tensors != num) {
+    _ml_logw ("The number of tensor type is mismatched in filter.");
   }
 
-  if (nnfw == ML_NNFW_TYPE_NNTR_INF) {
-    if (!in_tensors_info || !out_tensors_info) {
-      if (!in_tensors_info) {
-        ml_tensors_info_h in_info;
-        status = ml_tensors_info_create (&in_info);
-        if (status != ML_ERROR_NONE) {
-          _ml_error_report_continue
-              ("NNTrainer-inference-single cannot create tensors-info handle (ml_tensors_info_h) with ml_tensors_info_create. Error Code: %d",
-              status);
-          goto error;
-        }
+  /* get names */
+  g_object_get (single_h->filter, prop_name, &val, NULL);
+  num = gst_tensors_info_parse_names_string (gst_info, val);
+  g_free (val);
 
-        /* ml_single_set_input_info() can't be done as it checks num_tensors */
-        status = ml_single_set_gst_info (single_h, in_info);
-        ml_tensors_info_destroy (in_info);
-        if (status != ML_ERROR_NONE) {
-          _ml_error_report_continue
-              ("NNTrainer-inference-single cannot configure single_h handle instance with the given in_info. This might be an ML-API / NNTrainer internal error. Error Code: %d",
-              status);
-          goto error;
-        }
-      } else {
-        status = ml_single_set_input_info (single_h, in_tensors_info);
-        if (status != ML_ERROR_NONE) {
-          _ml_error_report_continue
-              ("NNTrainer-inference-single cannot configure single_h handle instance with the given in_info from the user. Error code: %d",
-              status);
-          goto error;
-        }
-      }
-    }
+  if (gst_info->num_tensors != num) {
+    _ml_logw ("The number of tensor name is mismatched in filter.");
   }
+}
 
-  /* 5. Set in/out configs and metadata */
-  if (!ml_single_set_info_in_handle (single_h, TRUE, in_tensors_info)) {
-    _ml_error_report
-        ("The input tensors info is invalid. Cannot configure single_h handle with the given input tensors info.");
+/**
+ * @brief Internal function to set the gst info in tensor-filter, without checking the model is shared.
+ * @note This is called directly only while loading the model, with the configuration given in the key of the model cache.
+ */
+static int
+__set_gst_info (ml_single * single_h, const ml_tensors_info_h info)
+{
+  GstTensorsInfo gst_in_info, gst_out_info;
+  int status = ML_ERROR_NONE;
+  int ret = -EINVAL;
+
+  _ml_error_report_return_continue_iferr
+      (_ml_tensors_info_copy_from_ml (&gst_in_info, info),
+      "Cannot fetch tensor-info from the given info parameter. Error code: %d",
+      _ERRNO);
+
+  ret = single_h->klass->set_input_info (single_h->filter, &gst_in_info,
+      &gst_out_info);
+  if (ret == 0) {
+    single_h->batch_configured = 1;
+    _ml_error_report_return_continue_iferr
+        (_ml_tensors_info_copy_from_gst (&single_h->in_info, &gst_in_info),
+        "Fetching input information from the given single_h instance has failed with %d",
+        _ERRNO);
+    _ml_error_report_return_continue_iferr (_ml_tensors_info_copy_from_gst
+        (&single_h->out_info, &gst_out_info),
+        "Fetching output information from the given single_h instance has failed with %d",
+        _ERRNO);
+    __setup_in_out_tensors (single_h);
+  } else if (ret == -ENOENT) {
+    status = ML_ERROR_NOT_SUPPORTED;
+  } else {
     status = ML_ERROR_INVALID_PARAMETER;
-    goto error;
   }
 
-  if (!ml_single_set_info_in_handle (single_h, FALSE, out_tensors_info)) {
-    _ml_error_report
-        ("The output tensors info is invalid. Cannot configure single_h handle with the given output tensors info.");
-    status = ML_ERROR_INVALID_PARAMETER;
-    goto error;
+  return status;
+}
+
+/**
+ * @brief Internal function to set the gst info in tensor-filter.
+ */
+static int
+ml_single_set_gst_info (ml_single * single_h, const ml_tensors_info_h info)
+{
+  if (__model_is_shared (single_h))
+    _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+        "The model of the given single_h handle is shared with other handles (opened with 'shared-model'). Cannot change the input information of the shared model.");
+
+  return __set_gst_info (single_h, info);
+}
+
+/**
+ * @brief Internal function to clone the tensors information.
+ */
+static int
+__clone_tensors_info (ml_tensors_info_h * dest, const ml_tensors_info_h src)
+{
+  int status;
+
+  if (((ml_tensors_info_s *) src)->is_extended)
+    status = ml_tensors_info_create_extended (dest);
+  else
+    status = ml_tensors_info_create (dest);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  status = ml_tensors_info_clone (*dest, src);
+  if (status != ML_ERROR_NONE) {
+    ml_tensors_info_destroy (*dest);
+    *dest = NULL;
   }
 
-  /* Setup input and output memory buffers for invoke */
-  if (in_tensors_info && in_tensors_info->is_extended) {
-    ml_tensors_info_create_extended (&single_h->in_tensors.info);
-    _ml_tensors_set_rank (single_h->input_ranks, ML_TENSOR_RANK_LIMIT);
-  } else {
-    ml_tensors_info_create (&single_h->in_tensors.info);
-    _ml_tensors_set_rank (single_h->input_ranks, ML_TENSOR_RANK_LIMIT_PREV);
+  return status;
+}
+
+/**
+ * @brief Sets the information (tensor dimension, type, name and so on) of required input data for the given model, and get updated output data information.
+ * @details Note that a model/framework may not support setting such information.
+ *          This does not call the public functions, because the handle is locked or the model is still being loaded.
+ * @since_tizen 6.0
+ * @param[in] single_h The model handle.
+ * @param[in] in_info The handle of input tensors information.
+ * @param[out] out_info The handle of output tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED This implies that the given framework does not support dynamic dimensions.
+ *         Use ml_single_get_input_info() and ml_single_get_output_info() instead for this framework.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+static int
+ml_single_update_info (ml_single * single_h,
+    const ml_tensors_info_h in_info, ml_tensors_info_h * out_info)
+{
+  if (!single_h)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid ml_single_h instance, usually created by ml_single_open().");
+  if (!in_info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, in_info (const ml_tensors_info_h), is NULL. It should be a valid instance of ml_tensors_info_h, usually created by ml_tensors_info_create() and configured by the application.");
+  if (!out_info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, out_info (ml_tensors_info_h *), is NULL. It should be a valid pointer to an instance ml_tensors_info_h, usually created by ml_tensors_info_h(). Note that out_info is supposed to be overwritten by this API call.");
+
+  /* init null */
+  *out_info = NULL;
+
+  _ml_error_report_return_continue_iferr (ml_single_set_gst_info (single_h,
+          in_info),
+      "Configuring the neural network model with the given input information has failed with %d error code. The given input information ('in_info' parameter) might be invalid or the given neural network cannot accept it as its input data.",
+      _ERRNO);
+
+  _ml_error_report_return_continue_iferr (__clone_tensors_info (out_info,
+          &single_h->out_info),
+      "Fetching output info after configuring input information has failed with %d error code.",
+      _ERRNO);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to configure the model with the input shape of invoke_dynamic.
+ * @details If the model is already configured with the shape, this skips configuring the model.
+ *          The filter holds one configuration and returns the output information only when configuring it,
+ *          so the model is configured again with the other shape.
+ * @param[out] reconfigured TRUE if the model is configured with the new shape.
+ * @note This is called with the handle locked.
+ */
+static int
+__configure_shape (ml_single * single_h, const ml_tensors_info_h in_info,
+    ml_tensors_info_h * out_info, gboolean * reconfigured)
+{
+  int status;
+
+  *reconfigured = FALSE;
+
+  if (!ml_tensors_info_is_equal (in_info, &single_h->in_info)) {
+    status = ml_single_set_gst_info (single_h, in_info);
+    if (status != ML_ERROR_NONE)
+      _ml_error_report_return (status,
+          "Configuring the neural network model with the given input information has failed with %d error code. The given input information ('in_info' parameter) might be invalid or the given neural network cannot accept it as its input data.",
+          status);
+
+    *reconfigured = TRUE;
+  }
+
+  return __clone_tensors_info (out_info, &single_h->out_info);
+}
+
+/**
+ * @brief Set the info for input/output tensors
+ */
+static int
+ml_single_set_inout_tensors_info (GObject * object,
+    const gboolean is_input, ml_tensors_info_s * tensors_info)
+{
+  int status = ML_ERROR_NONE;
+  GstTensorsInfo info;
+  gchar *str_dim, *str_type, *str_name;
+  const gchar *str_type_name, *str_name_name;
+  const gchar *prefix;
+
+  if (is_input) {
+    prefix = INPUT_STR;
+    str_type_name = CONCAT_MACRO_STR (INPUT_STR, TYPE_STR);
+    str_name_name = CONCAT_MACRO_STR (INPUT_STR, NAME_STR);
+  } else {
+    prefix = OUTPUT_STR;
+    str_type_name = CONCAT_MACRO_STR (OUTPUT_STR, TYPE_STR);
+    str_name_name = CONCAT_MACRO_STR (OUTPUT_STR, NAME_STR);
+  }
+
+  _ml_error_report_return_continue_iferr
+      (_ml_tensors_info_copy_from_ml (&info, tensors_info),
+      "Cannot fetch tensor-info from the given information. Error code: %d",
+      _ERRNO);
+
+  /* Set input option */
+  str_dim = gst_tensors_info_get_dimensions_string (&info);
+  str_type = gst_tensors_info_get_types_string (&info);
+  str_name = gst_tensors_info_get_names_string (&info);
+
+  if (!str_dim || !str_type || !str_name) {
+    if (!str_dim)
+      _ml_error_report
+          ("Cannot fetch specific tensor-info from the given information: cannot fetch tensor dimension information.");
+    if (!str_type)
+      _ml_error_report
+          ("Cannot fetch specific tensor-info from the given information: cannot fetch tensor type information.");
+    if (!str_name)
+      _ml_error_report
+          ("Cannot fetch specific tensor-info from the given information: cannot fetch tensor name information. Even if tensor names are not defined, this should be able to fetch a list of empty strings.");
+
+    status = ML_ERROR_INVALID_PARAMETER;
+  } else {
+    g_object_set (object, prefix, str_dim, str_type_name, str_type,
+        str_name_name, str_name, NULL);
+  }
+
+  g_free (str_dim);
+  g_free (str_type);
+  g_free (str_name);
+
+  gst_tensors_info_free (&info);
+
+  return status;
+}
+
+/**
+ * @brief Internal static function to set tensors info in the handle.
+ */
+static gboolean
+ml_single_set_info_in_handle (ml_single_h single, gboolean is_input,
+    ml_tensors_info_s * tensors_info)
+{
+  int status;
+  ml_single *single_h;
+  ml_tensors_info_s *dest;
+  gboolean configured = FALSE;
+  gboolean is_valid = FALSE;
+  GObject *filter_obj;
+
+  single_h = (ml_single *) single;
+  filter_obj = G_OBJECT (single_h->filter);
+
+  if (is_input) {
+    dest = &single_h->in_info;
+    configured = single_h->klass->input_configured (single_h->filter);
+  } else {
+    dest = &single_h->out_info;
+    configured = single_h->klass->output_configured (single_h->filter);
+  }
+
+  if (configured) {
+    /* get configured info and compare with input info */
+    GstTensorsInfo gst_info;
+    ml_tensors_info_h info = NULL;
+
+    ml_single_get_gst_info (single_h, is_input, &gst_info);
+    _ml_tensors_info_create_from_gst (&info, &gst_info);
+
+    gst_tensors_info_free (&gst_info);
+
+    if (tensors_info && !ml_tensors_info_is_equal (tensors_info, info)) {
+      /* given input info is not matched with configured */
+      ml_tensors_info_destroy (info);
+      if (is_input) {
+        /* try to update tensors info */
+        status = ml_single_update_info (single_h, tensors_info, &info);
+        if (status != ML_ERROR_NONE)
+          goto done;
+      } else {
+        goto done;
+      }
+    }
+
+    ml_tensors_info_clone (dest, info);
+    ml_tensors_info_destroy (info);
+  } else if (tensors_info) {
+    status =
+        ml_single_set_inout_tensors_info (filter_obj, is_input, tensors_info);
+    if (status != ML_ERROR_NONE)
+      goto done;
+    ml_tensors_info_clone (dest, tensors_info);
+  }
+
+  is_valid = ml_tensors_info_is_valid (dest);
+
+done:
+  return is_valid;
+}
+
+/**
+ * @brief Internal function to create and initialize the single handle.
+ */
+static ml_single *
+ml_single_create_handle (ml_nnfw_type_e nnfw)
+{
+  ml_single *single_h;
+  GError *error;
+
+  single_h = g_new0 (ml_single, 1);
+  if (single_h == NULL)
+    _ml_error_report_return (NULL,
+        "Failed to allocate memory for the single_h handle. Out of memory?");
+
+  single_h->filter = g_object_new (G_TYPE_TENSOR_FILTER_SINGLE, NULL);
+  if (single_h->filter == NULL) {
+    _ml_error_report
+        ("Failed to create a new instance for filter. Out of memory?");
+    g_free (single_h);
+    return NULL;
+  }
+
+  single_h->magic = ML_SINGLE_MAGIC;
+  single_h->timeout = SINGLE_DEFAULT_TIMEOUT;
+  single_h->nnfw = nnfw;
+  single_h->state = IDLE;
+  single_h->thread = NULL;
+  single_h->destroy_data_list = NULL;
+  single_h->invoking = FALSE;
+  single_h->waiting = 0;
+  single_h->borrow_input = FALSE;
+  g_queue_init (&single_h->requests);
+  single_h->queue_size = SINGLE_DEFAULT_QUEUE_SIZE;
+  single_h->policy = QUEUE_POLICY_BLOCK;
+  single_h->queue_processed = 0;
+  single_h->queue_dropped = 0;
+  single_h->queue_wait_total = 0;
+  single_h->queue_wait_max = 0;
+  single_h->spin_us = 0;
+  single_h->push_seq = 0;
+  single_h->thread_tid = 0;
+  single_h->pending = g_hash_table_new (g_direct_hash, g_direct_equal);
+  single_h->last_request_id = 0;
+  single_h->max_batch = 1;
+  single_h->max_wait_us = 0;
+  single_h->batch_configured = 1;
+  single_h->batch = NULL;
+  single_h->model = NULL;
+  single_h->model_fd = -1;
+  single_h->loader = NULL;
+  single_h->load_status = ML_ERROR_NONE;
+
+  single_h->output_pool = __output_pool_new ();
+  if (single_h->output_pool == NULL) {
+    _ml_error_report
+        ("Failed to allocate memory for the output buffers of single_h handle. Out of memory?");
+    g_object_unref (single_h->filter);
+    g_free (single_h);
+    return NULL;
+  }
+
+  _ml_tensors_info_initialize (&single_h->in_info);
+  _ml_tensors_info_initialize (&single_h->out_info);
+  _ml_tensors_rank_initialize (single_h->input_ranks);
+  _ml_tensors_rank_initialize (single_h->output_ranks);
+  g_mutex_init (&single_h->mutex);
+  g_cond_init (&single_h->cond);
+
+  single_h->klass = g_type_class_ref (G_TYPE_TENSOR_FILTER_SINGLE);
+  if (single_h->klass == NULL) {
+    _ml_error_report
+        ("Failed to get class of the tensor-filter of single API. This binary is not compiled properly or required libraries are not loaded.");
+    ml_single_close (single_h);
+    return NULL;
+  }
+
+  single_h->thread =
+      g_thread_try_new (NULL, invoke_thread, (gpointer) single_h, &error);
+  if (single_h->thread == NULL) {
+    _ml_error_report
+        ("Failed to create the invoke thread of single API, g_thread_try_new has reported an error: %s.",
+        error->message);
+    g_clear_error (&error);
+    ml_single_close (single_h);
+    return NULL;
+  }
+
+  return single_h;
+}
+
+/**
+ * @brief Validate arguments for open
+ */
+static int
+_ml_single_open_custom_validate_arguments (ml_single_h * single,
+    ml_single_preset * info)
+{
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'single' (ml_single_h *), is NULL. It should be a valid pointer to an instance of ml_single_h.");
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'info' (ml_single_preset *), is NULL. It should be a valid pointer to a valid instance of ml_single_preset.");
+
+  /* Validate input tensor info. */
+  if (info->input_info && !ml_tensors_info_is_valid (info->input_info))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'info' (ml_single_preset *), is not valid. It has 'input_info' entry that cannot be validated. ml_tensors_info_is_valid(info->input_info) has failed while info->input_info exists.");
+
+  /* Validate output tensor info. */
+  if (info->output_info && !ml_tensors_info_is_valid (info->output_info))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'info' (ml_single_preset *), is not valid. It has 'output_info' entry that cannot be validated. ml_tensors_info_is_valid(info->output_info) has failed while info->output_info exists.");
+
+  if (!info->models)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'info' (ml_single_preset *), is not valid. Its models entry if NULL (info->models is NULL).");
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to convert accelerator as tensor_filter property format.
+ * @note returned value must be freed by the caller
+ * @note More details on format can be found in gst_tensor_filter_install_properties() in tensor_filter_common.c.
+ */
+char *
+_ml_nnfw_to_str_prop (const ml_nnfw_hw_e hw)
+{
+  const gchar *hw_name;
+  const gchar *use_accl = "true:";
+  gchar *str_prop = NULL;
+
+  hw_name = get_accl_hw_str (_ml_nnfw_to_accl_hw (hw));
+  str_prop = g_strdup_printf ("%s%s", use_accl, hw_name);
+
+  return str_prop;
+}
+
+/**
+ * @brief Internal function to load the model with the tensor-filter.
+ * @details This only sets the tensor-filter, the handle is configured by __ml_single_configure().
+ * @param[out] model The entry of the shared model acquired, which should be set in the handle even on failure.
+ */
+static int
+__ml_single_start (ml_single * single_h, ml_single_preset * info,
+    ml_nnfw_type_e nnfw, ml_single_model_entry ** model)
+{
+  GObject *filter_obj;
+  int status = ML_ERROR_NONE;
+  ml_tensors_info_s *in_tensors_info, *out_tensors_info;
+  ml_nnfw_hw_e hw;
+  const gchar *fw_name;
+  char *hw_name;
+
+  in_tensors_info = (ml_tensors_info_s *) info->input_info;
+  out_tensors_info = (ml_tensors_info_s *) info->output_info;
+  hw = info->hw;
+  fw_name = _ml_get_nnfw_subplugin_name (nnfw);
+
+  filter_obj = G_OBJECT (single_h->filter);
+
+  /**
+   * 3. Construct a direct connection with the nnfw.
+   * Note that we do not construct a pipeline since 2019.12.
+   */
+  if (nnfw == ML_NNFW_TYPE_TENSORFLOW || nnfw == ML_NNFW_TYPE_SNAP ||
+      nnfw == ML_NNFW_TYPE_PYTORCH || nnfw == ML_NNFW_TYPE_TRIX_ENGINE) {
+    /* set input and output tensors information */
+    if (in_tensors_info && out_tensors_info) {
+      status =
+          ml_single_set_inout_tensors_info (filter_obj, TRUE, in_tensors_info);
+      if (status != ML_ERROR_NONE) {
+        _ml_error_report_continue
+            ("Input tensors info is given; however, failed to set input tensors info. Error code: %d",
+            status);
+        return status;
+      }
+
+      status =
+          ml_single_set_inout_tensors_info (filter_obj, FALSE,
+          out_tensors_info);
+      if (status != ML_ERROR_NONE) {
+        _ml_error_report_continue
+            ("Output tensors info is given; however, failed to set output tensors info. Error code: %d",
+            status);
+        return status;
+      }
+    } else {
+      _ml_error_report
+          ("To run the given nnfw, '%s', with a neural network model, both input and output information should be provided.",
+          fw_name);
+      status = ML_ERROR_INVALID_PARAMETER;
+      return status;
+    }
+  } else if (nnfw == ML_NNFW_TYPE_ARMNN) {
+    /* set input and output tensors information, if available */
+    if (in_tensors_info) {
+      status =
+          ml_single_set_inout_tensors_info (filter_obj, TRUE, in_tensors_info);
+      if (status != ML_ERROR_NONE) {
+        _ml_error_report_continue
+            ("With nnfw '%s', input tensors info is optional. However, the user has provided an invalid input tensors info. Error code: %d",
+            fw_name, status);
+        return status;
+      }
+    }
+    if (out_tensors_info) {
+      status =
+          ml_single_set_inout_tensors_info (filter_obj, FALSE,
+          out_tensors_info);
+      if (status != ML_ERROR_NONE) {
+        _ml_error_report_continue
+            ("With nnfw '%s', output tensors info is optional. However, the user has provided an invalid output tensors info. Error code: %d",
+            fw_name, status);
+        return status;
+      }
+    }
+  }
+
+  /* set accelerator, framework, model files and custom option */
+  if (info->fw_name) {
+    fw_name = (const char *) info->fw_name;
+  } else {
+    fw_name = _ml_get_nnfw_subplugin_name (nnfw);       /* retry for "auto" */
+  }
+  hw_name = _ml_nnfw_to_str_prop (hw);
+  g_object_set (filter_obj, "framework", fw_name, "accelerator", hw_name,
+      "model", info->models, NULL);
+  g_free (hw_name);
+
+  if (info->custom_option) {
+    g_object_set (filter_obj, "custom", info->custom_option, NULL);
+  }
+
+  /* Share the model loaded by other handles */
+  if (info->shared_model) {
+    if (g_object_class_find_property (G_OBJECT_GET_CLASS (filter_obj),
+            "shared-tensor-filter-key")) {
+      gchar *key = __model_cache_key (fw_name, hw, info);
+
+      *model = __model_cache_acquire (key);
+      g_object_set (filter_obj, "shared-tensor-filter-key",
+          (*model)->filter_key, NULL);
+      g_free (key);
+    } else {
+      _ml_logw
+          ("The tensor-filter does not support sharing the model, the model '%s' is loaded again.",
+          info->models);
+    }
+  }
+
+  /* 4. Start the nnfw to get inout configurations if needed */
+  if (!single_h->klass->start (single_h->filter)) {
+    _ml_error_report
+        ("Failed to start NNFW, '%s', to get inout configurations. Subplugin class method has failed to start.",
+        fw_name);
+    status = ML_ERROR_STREAMS_PIPE;
+    return status;
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to configure the handle with the model loaded.
+ * @note This is called with the handle locked.
+ */
+static int
+__ml_single_configure (ml_single * single_h, ml_single_preset * info,
+    ml_nnfw_type_e nnfw)
+{
+  int status = ML_ERROR_NONE;
+  ml_tensors_info_s *in_tensors_info, *out_tensors_info;
+
+  in_tensors_info = (ml_tensors_info_s *) info->input_info;
+  out_tensors_info = (ml_tensors_info_s *) info->output_info;
+
+  if (nnfw == ML_NNFW_TYPE_NNTR_INF) {
+    if (!in_tensors_info || !out_tensors_info) {
+      if (!in_tensors_info) {
+        ml_tensors_info_h in_info;
+        status = ml_tensors_info_create (&in_info);
+        if (status != ML_ERROR_NONE) {
+          _ml_error_report_continue
+              ("NNTrainer-inference-single cannot create tensors-info handle (ml_tensors_info_h) with ml_tensors_info_create. Error Code: %d",
+              status);
+          return status;
+        }
+
+        /* ml_single_set_input_info() can't be done as it checks num_tensors */
+        status = __set_gst_info (single_h, in_info);
+        ml_tensors_info_destroy (in_info);
+        if (status != ML_ERROR_NONE) {
+          _ml_error_report_continue
+              ("NNTrainer-inference-single cannot configure single_h handle instance with the given in_info. This might be an ML-API / NNTrainer internal error. Error Code: %d",
+              status);
+          return status;
+        }
+      } else {
+        /* The handle is locked and not loaded yet, set the info directly. */
+        if (!ml_tensors_info_is_valid (in_tensors_info))
+          status = ML_ERROR_INVALID_PARAMETER;
+        else
+          status = __set_gst_info (single_h, in_tensors_info);
+        if (status != ML_ERROR_NONE) {
+          _ml_error_report_continue
+              ("NNTrainer-inference-single cannot configure single_h handle instance with the given in_info from the user. Error code: %d",
+              status);
+          return status;
+        }
+      }
+    }
+  }
+
+  /* 5. Set in/out configs and metadata */
+  if (!ml_single_set_info_in_handle (single_h, TRUE, in_tensors_info)) {
+    _ml_error_report
+        ("The input tensors info is invalid. Cannot configure single_h handle with the given input tensors info.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    return status;
+  }
+
+  if (!ml_single_set_info_in_handle (single_h, FALSE, out_tensors_info)) {
+    _ml_error_report
+        ("The output tensors info is invalid. Cannot configure single_h handle with the given output tensors info.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    return status;
+  }
+
+  /* Setup input and output memory buffers for invoke */
+  if (in_tensors_info && in_tensors_info->is_extended)
+    _ml_tensors_set_rank (single_h->input_ranks, ML_TENSOR_RANK_LIMIT);
+  else
+    _ml_tensors_set_rank (single_h->input_ranks, ML_TENSOR_RANK_LIMIT_PREV);
+
+  if (out_tensors_info && out_tensors_info->is_extended)
+    _ml_tensors_set_rank (single_h->output_ranks, ML_TENSOR_RANK_LIMIT);
+  else
+    _ml_tensors_set_rank (single_h->output_ranks, ML_TENSOR_RANK_LIMIT_PREV);
+
+  __setup_in_out_tensors (single_h);
+
+  /* 6. Set the requests to be invoked at once */
+  if (info->max_batch > 1) {
+    single_h->max_batch = info->max_batch;
+    single_h->max_wait_us = info->max_wait_us;
+    single_h->batch = g_new0 (ml_single_request *, single_h->max_batch);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to load the model with the tensor-filter and configure the handle.
+ * @details The handle is configured under the lock with the result of loading,
+ *          because other threads may access the handle opened by ml_single_open_async() while loading.
+ * @note This does not close the handle on failure.
+ */
+static int
+__ml_single_load (ml_single * single_h, ml_single_preset * info,
+    ml_nnfw_type_e nnfw)
+{
+  ml_single_model_entry *model = NULL;
+  int status;
+
+  status = __ml_single_start (single_h, info, nnfw, &model);
+
+  g_mutex_lock (&single_h->mutex);
+  single_h->model = model;
+  if (status == ML_ERROR_NONE)
+    status = __ml_single_configure (single_h, info, nnfw);
+  if (single_h->load_status == ML_ERROR_TRY_AGAIN)
+    single_h->load_status = status;
+  g_mutex_unlock (&single_h->mutex);
+
+  return status;
+}
+
+/**
+ * @brief Thread to load the model of the handle opened by ml_single_open_async().
+ */
+static gpointer
+__ml_single_load_thread (gpointer data)
+{
+  ml_single_loader *loader = (ml_single_loader *) data;
+  ml_single *single_h = loader->single_h;
+  int status;
+
+  /* The result is set in the handle with the configuration. */
+  status = __ml_single_load (single_h, &loader->info, loader->nnfw);
+
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_continue
+        ("Failed to load the model '%s' in the background. Error code: %d",
+        loader->info.models, status);
+
+  loader->info.open_cb ((ml_single_h) single_h, status,
+      loader->info.open_user_data);
+
+  if (loader->info.input_info)
+    ml_tensors_info_destroy (loader->info.input_info);
+  if (loader->info.output_info)
+    ml_tensors_info_destroy (loader->info.output_info);
+  g_free (loader->info.models);
+  g_free (loader->info.custom_option);
+  g_free (loader->info.fw_name);
+  g_free (loader);
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to copy the tensors information to load the model in the background.
+ */
+static int
+__ml_single_loader_copy_info (ml_tensors_info_h * dest,
+    const ml_tensors_info_h src)
+{
+  *dest = NULL;
+  if (src == NULL)
+    return ML_ERROR_NONE;
+
+  return __clone_tensors_info (dest, src);
+}
+
+/**
+ * @brief Internal function to start loading the model in the background.
+ * @details The information is copied because the caller may release it before the model is loaded.
+ */
+static int
+__ml_single_load_async (ml_single * single_h, ml_single_preset * info,
+    ml_nnfw_type_e nnfw)
+{
+  ml_single_loader *loader;
+  GError *error = NULL;
+  int status;
+
+  loader = g_new0 (ml_single_loader, 1);
+  if (loader == NULL)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory to load the model in the background. Out of memory?");
+
+  loader->single_h = single_h;
+  loader->nnfw = nnfw;
+  loader->info = *info;
+  loader->info.models = g_strdup (info->models);
+  loader->info.custom_option = g_strdup (info->custom_option);
+  loader->info.fw_name = g_strdup (info->fw_name);
+
+  status = __ml_single_loader_copy_info (&loader->info.input_info,
+      info->input_info);
+  if (status == ML_ERROR_NONE)
+    status = __ml_single_loader_copy_info (&loader->info.output_info,
+        info->output_info);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to copy the tensors information to load the model in the background. Error code: %d",
+        status);
+    goto error;
+  }
+
+  single_h->load_status = ML_ERROR_TRY_AGAIN;
+  single_h->loader = g_thread_try_new ("ml-single-load",
+      __ml_single_load_thread, loader, &error);
+  if (single_h->loader == NULL) {
+    _ml_error_report
+        ("Failed to create the thread to load the model, g_thread_try_new has reported an error: %s.",
+        error ? error->message : "unknown");
+    g_clear_error (&error);
+    single_h->load_status = ML_ERROR_NONE;
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto error;
+  }
+
+  return ML_ERROR_NONE;
+
+error:
+  if (loader->info.input_info)
+    ml_tensors_info_destroy (loader->info.input_info);
+  if (loader->info.output_info)
+    ml_tensors_info_destroy (loader->info.output_info);
+  g_free (loader->info.models);
+  g_free (loader->info.custom_option);
+  g_free (loader->info.fw_name);
+  g_free (loader);
+  return status;
+}
+
+#if defined (__linux__)
+/**
+ * @brief The name of the scheduling policy (ml-option 'sched-policy').
+ */
+static const struct
+{
+  const char *name;
+  int policy;
+} sched_policy_name[] = {
+  {"other", SCHED_OTHER},
+  {"batch", SCHED_BATCH},
+  {"idle", SCHED_IDLE},
+  {"fifo", SCHED_FIFO},
+  {"rr", SCHED_RR},
+  {NULL, 0}
+};
+
+/**
+ * @brief Internal function to parse the list of CPUs such as '0-3,6'.
+ */
+static int
+__parse_cpu_list (const gchar * str, cpu_set_t * set)
+{
+  gchar **ranges;
+  gchar *endptr;
+  guint64 first, last, cpu;
+  guint i;
+  int status = ML_ERROR_NONE;
+
+  CPU_ZERO (set);
+
+  ranges = g_strsplit (str, ",", -1);
+  for (i = 0; ranges[i] != NULL; i++) {
+    first = g_ascii_strtoull (ranges[i], &endptr, 10);
+    if (endptr == ranges[i]) {
+      status = ML_ERROR_INVALID_PARAMETER;
+      break;
+    }
+
+    last = first;
+    if (*endptr == '-') {
+      const gchar *start = endptr + 1;
+
+      last = g_ascii_strtoull (start, &endptr, 10);
+      if (endptr == start) {
+        status = ML_ERROR_INVALID_PARAMETER;
+        break;
+      }
+    }
+
+    if (*endptr != '\0' || first > last || last >= CPU_SETSIZE) {
+      status = ML_ERROR_INVALID_PARAMETER;
+      break;
+    }
+
+    for (cpu = first; cpu <= last; cpu++)
+      CPU_SET ((int) cpu, set);
+  }
+
+  if (i == 0)
+    status = ML_ERROR_INVALID_PARAMETER;
+
+  g_strfreev (ranges);
+  return status;
+}
+
+/**
+ * @brief Internal function to convert the errno of the scheduling calls.
+ */
+static int
+__sched_errno_to_ml (int err)
+{
+  /* setpriority() fails with EACCES if an unprivileged caller lowers the nice value. */
+  return (err == EPERM || err == EACCES) ? ML_ERROR_PERMISSION_DENIED :
+      ML_ERROR_INVALID_PARAMETER;
+}
+#endif
+
+/**
+ * @brief Internal function to set the CPU affinity, scheduling policy and nice value of the invoke thread.
+ * @details The values are given with the ml-option keys 'cpu-affinity', 'sched-policy', 'sched-priority' and 'nice'.
+ */
+static int
+__set_thread_sched (ml_single * single_h, const ml_single_preset * info)
+{
+#if defined (__linux__)
+  cpu_set_t cpus;
+  struct sched_param param;
+  gchar *endptr;
+  gint64 val;
+  pid_t tid;
+  guint i;
+  int policy;
+  int status;
+
+  if (info->sched_priority && !info->sched_policy)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The ml-option 'sched-priority', '%s', is given without 'sched-policy'. It should be given with the policy 'fifo' or 'rr'.",
+        info->sched_priority);
+
+  if (!info->cpu_affinity && !info->sched_policy && !info->nice)
+    return ML_ERROR_NONE;
+
+  /* Wait until the invoke thread starts. */
+  g_mutex_lock (&single_h->mutex);
+  while (single_h->thread_tid == 0)
+    g_cond_wait (&single_h->cond, &single_h->mutex);
+  tid = (pid_t) single_h->thread_tid;
+  g_mutex_unlock (&single_h->mutex);
+
+  if (info->cpu_affinity) {
+    status = __parse_cpu_list (info->cpu_affinity, &cpus);
+    if (status != ML_ERROR_NONE)
+      _ml_error_report_return (status,
+          "The ml-option 'cpu-affinity', '%s', is not valid. It should be the list of CPUs such as '0-3,6'.",
+          info->cpu_affinity);
+
+    if (sched_setaffinity (tid, sizeof (cpu_set_t), &cpus) != 0)
+      _ml_error_report_return (__sched_errno_to_ml (errno),
+          "Failed to set the CPU affinity '%s' of the invoke thread: %s",
+          info->cpu_affinity, g_strerror (errno));
+  }
+
+  if (info->sched_policy) {
+    for (i = 0; sched_policy_name[i].name != NULL; i++) {
+      if (g_ascii_strcasecmp (info->sched_policy,
+              sched_policy_name[i].name) == 0)
+        break;
+    }
+
+    if (sched_policy_name[i].name == NULL)
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The ml-option 'sched-policy', '%s', is not valid. It should be one of {other, batch, idle, fifo, rr}.",
+          info->sched_policy);
+
+    policy = sched_policy_name[i].policy;
+    memset (&param, 0, sizeof (param));
+
+    /* The real-time policies require the priority, 1 by default. */
+    if (policy == SCHED_FIFO || policy == SCHED_RR) {
+      param.sched_priority = 1;
+
+      if (info->sched_priority) {
+        val = g_ascii_strtoll (info->sched_priority, &endptr, 10);
+        if (endptr == info->sched_priority || *endptr != '\0' ||
+            val < sched_get_priority_min (policy) ||
+            val > sched_get_priority_max (policy))
+          _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+              "The ml-option 'sched-priority', '%s', is not valid. It should be an integer from %d to %d.",
+              info->sched_priority, sched_get_priority_min (policy),
+              sched_get_priority_max (policy));
+
+        param.sched_priority = (int) val;
+      }
+    } else if (info->sched_priority) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The ml-option 'sched-priority', '%s', is given with the policy '%s'. It is available with the policy 'fifo' or 'rr' only.",
+          info->sched_priority, info->sched_policy);
+    }
+
+    if (sched_setscheduler (tid, policy, &param) != 0)
+      _ml_error_report_return (__sched_errno_to_ml (errno),
+          "Failed to set the scheduling policy '%s' of the invoke thread: %s",
+          info->sched_policy, g_strerror (errno));
+  }
+
+  if (info->nice) {
+    val = g_ascii_strtoll (info->nice, &endptr, 10);
+    if (endptr == info->nice || *endptr != '\0' || val < -20 || val > 19)
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The ml-option 'nice', '%s', is not valid. It should be an integer from -20 to 19.",
+          info->nice);
+
+    /* The nice value of a thread is set with its kernel thread id on Linux. */
+    if (setpriority (PRIO_PROCESS, (id_t) tid, (int) val) != 0)
+      _ml_error_report_return (__sched_errno_to_ml (errno),
+          "Failed to set the nice value '%s' of the invoke thread: %s",
+          info->nice, g_strerror (errno));
+  }
+
+  return ML_ERROR_NONE;
+#else
+  if (!info->cpu_affinity && !info->sched_policy && !info->sched_priority &&
+      !info->nice)
+    return ML_ERROR_NONE;
+
+  _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+      "The ml-option 'cpu-affinity', 'sched-policy' and 'nice' are supported on Linux only.");
+#endif
+}
+
+/**
+ * @brief Opens an ML model with the custom options and returns the instance as a handle.
+ */
+int
+ml_single_open_custom (ml_single_h * single, ml_single_preset * info)
+{
+  ml_single *single_h;
+  int status = ML_ERROR_NONE;
+  ml_nnfw_type_e nnfw;
+  ml_nnfw_hw_e hw;
+  const gchar *fw_name;
+  gchar **list_models;
+  guint num_models;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  /* Validate the params */
+  _ml_error_report_return_continue_iferr
+      (_ml_single_open_custom_validate_arguments (single, info),
+      "The parameter, 'info' (ml_single_preset *), cannot be validated. Please provide valid information for this object.");
+
+  /* init null */
+  *single = NULL;
+
+  nnfw = info->nnfw;
+  hw = info->hw;
+  fw_name = _ml_get_nnfw_subplugin_name (nnfw);
+
+  /**
+   * 1. Determine nnfw and validate model file
+   */
+  list_models = g_strsplit (info->models, ",", -1);
+  num_models = g_strv_length (list_models);
+
+  /* The model given with file descriptor has no file extension to be checked. */
+  if (info->model_is_fd)
+    status = (nnfw == ML_NNFW_TYPE_ANY) ?
+        ML_ERROR_INVALID_PARAMETER : ML_ERROR_NONE;
+  else
+    status = _ml_validate_model_file ((const char **) list_models, num_models,
+        &nnfw);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Cannot validate the model (1st model: %s. # models: %d). Error code: %d",
+        list_models[0], num_models, status);
+    g_strfreev (list_models);
+    return status;
+  }
+
+  g_strfreev (list_models);
+
+  /**
+   * 2. Determine hw
+   * (Supposed CPU only) Support others later.
+   */
+  if (!_ml_nnfw_is_available (nnfw, hw)) {
+    _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+        "The given nnfw, '%s', is not supported. There is no corresponding tensor-filter subplugin available or the given hardware requirement is not supported for the given nnfw.",
+        fw_name);
+  }
+
+                                        /** Create ml_single object */
+  if ((single_h = ml_single_create_handle (nnfw)) == NULL) {
+    _ml_error_report_return_continue (ML_ERROR_OUT_OF_MEMORY,
+        "Cannot create handle for the given nnfw, %s", fw_name);
+  }
+
+  /* Pin the invoke thread before loading the model. */
+  status = __set_thread_sched (single_h, info);
+  if (status != ML_ERROR_NONE)
+    goto error;
+
+  /* 3 ~ 6. Load the model and configure the handle */
+  if (info->open_cb)
+    status = __ml_single_load_async (single_h, info, nnfw);
+  else
+    status = __ml_single_load (single_h, info, nnfw);
+  if (status != ML_ERROR_NONE)
+    goto error;
+
+  *single = single_h;
+  return ML_ERROR_NONE;
+
+error:
+  ml_single_close (single_h);
+  return status;
+}
+
+/**
+ * @brief Opens an ML model and returns the instance as a handle.
+ */
+int
+ml_single_open (ml_single_h * single, const char *model,
+    const ml_tensors_info_h input_info, const ml_tensors_info_h output_info,
+    ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw)
+{
+  return ml_single_open_full (single, model, input_info, output_info, nnfw, hw,
+      NULL);
+}
+
+/**
+ * @brief Opens an ML model and returns the instance as a handle.
+ */
+int
+ml_single_open_full (ml_single_h * single, const char *model,
+    const ml_tensors_info_h input_info, const ml_tensors_info_h output_info,
+    ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, const char *custom_option)
+{
+  ml_single_preset info = { 0, };
+
+  info.input_info = input_info;
+  info.output_info = output_info;
+  info.nnfw = nnfw;
+  info.hw = hw;
+  info.models = (char *) model;
+  info.custom_option = (char *) custom_option;
+
+  return ml_single_open_custom (single, &info);
+}
+
+#if defined (__linux__)
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+/**
+ * @brief Internal function to open the model in the given file descriptor.
+ * @note The handle owns the file descriptor, which is closed if failed to open the model.
+ */
+static int
+__ml_single_open_fd (ml_single_h * single, int fd,
+    const ml_tensors_info_h input_info, const ml_tensors_info_h output_info,
+    ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, const char *custom_option)
+{
+  ml_single_preset info = { 0, };
+  gchar *path;
+  int status;
+
+  if (nnfw == ML_NNFW_TYPE_ANY) {
+    close (fd);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, nnfw, is ML_NNFW_TYPE_ANY. The model in the buffer has no file extension to detect the framework, so the framework should be specified.");
+  }
+
+  /* The sub-plugins load the model with its path, open it again with procfs. */
+  path = g_strdup_printf ("/proc/self/fd/%d", fd);
+
+  info.input_info = input_info;
+  info.output_info = output_info;
+  info.nnfw = nnfw;
+  info.hw = hw;
+  info.models = path;
+  info.custom_option = (char *) custom_option;
+  info.model_is_fd = TRUE;
+
+  status = ml_single_open_custom (single, &info);
+  g_free (path);
+
+  if (status == ML_ERROR_NONE)
+    ((ml_single *) (*single))->model_fd = fd;
+  else
+    close (fd);
+
+  return status;
+}
+
+/**
+ * @brief Internal function to create the file in memory and write the model.
+ * @return The file descriptor, or -1 if failed.
+ */
+static int
+__ml_single_create_model_fd (const void *data, size_t size)
+{
+  const guint8 *pos = (const guint8 *) data;
+  ssize_t written;
+  int fd = -1;
+
+  /* Do not leak the model to the child processes. */
+#if defined (SYS_memfd_create)
+  fd = (int) syscall (SYS_memfd_create, "ml-single-model", MFD_CLOEXEC);
+#endif
+
+  /* Fallback to the temporary file if memfd is not available. */
+  if (fd < 0) {
+    gchar *path = NULL;
+
+    fd = g_file_open_tmp ("ml-single-model-XXXXXX", &path, NULL);
+    if (fd >= 0)
+      g_unlink (path);
+    g_free (path);
+
+    if (fd < 0)
+      return -1;
+
+    if (fcntl (fd, F_SETFD, FD_CLOEXEC) < 0) {
+      close (fd);
+      return -1;
+    }
+  }
+
+  while (size > 0) {
+    written = write (fd, pos, size);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+
+      close (fd);
+      return -1;
+    }
+
+    pos += written;
+    size -= (size_t) written;
+  }
+
+  return fd;
+}
+#endif /* __linux__ */
+
+/**
+ * @brief Opens an ML model in the memory and returns the instance as a handle.
+ */
+int
+ml_single_open_from_buffer (ml_single_h * single, const void *data,
+    size_t size, const ml_tensors_info_h input_info,
+    const ml_tensors_info_h output_info, ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw,
+    const char *custom_option)
+{
+  int fd;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'single' (ml_single_h), is NULL. It should be a valid ml_single_h instance.");
+  if (!data || size == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'data', is NULL or 'size' is 0. It should be the valid model in the memory.");
+
+#if defined (__linux__)
+  fd = __ml_single_create_model_fd (data, size);
+  if (fd < 0)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to create the file in memory for the given model (size %zu). Out of memory?",
+        size);
+
+  return __ml_single_open_fd (single, fd, input_info, output_info, nnfw, hw,
+      custom_option);
+#else
+  (void) fd;
+  _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+      "Opening the model in the memory requires procfs (/proc/self/fd), which is available on Linux only.");
+#endif
+}
+
+/**
+ * @brief Opens an ML model in the file descriptor and returns the instance as a handle.
+ */
+int
+ml_single_open_from_fd (ml_single_h * single, int fd,
+    const ml_tensors_info_h input_info, const ml_tensors_info_h output_info,
+    ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, const char *custom_option)
+{
+  int model_fd;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'single' (ml_single_h), is NULL. It should be a valid ml_single_h instance.");
+  if (fd < 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'fd' (%d), is invalid. It should be the file descriptor of the model.",
+        fd);
+
+#if defined (__linux__)
+  /* The handle keeps its own descriptor, the caller may close the given one. */
+  model_fd = fcntl (fd, F_DUPFD_CLOEXEC, 0);
+  if (model_fd < 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to duplicate the given file descriptor (%d), errno %d.", fd,
+        errno);
+
+  return __ml_single_open_fd (single, model_fd, input_info, output_info, nnfw,
+      hw, custom_option);
+#else
+  (void) model_fd;
+  _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+      "Opening the model in the file descriptor requires procfs (/proc/self/fd), which is available on Linux only.");
+#endif
+}
+
+/**
+ * @brief Internal function to fill the information to open the model with given option.
+ */
+static void
+__ml_single_parse_option (const ml_option_h option, ml_single_preset * info)
+{
+  ml_option_s *_option;
+  GHashTable *table;
+  GHashTableIter iter;
+  gchar *key;
+  ml_option_value_s *_option_value;
+
+  _option = (ml_option_s *) option;
+  table = _option->option_table;
+
+  g_hash_table_iter_init (&iter, table);
+  while (g_hash_table_iter_next (&iter, (gpointer *) & key,
+          (gpointer *) & _option_value)) {
+    if (g_ascii_strcasecmp (key, "input_info") == 0) {
+      info->input_info = _option_value->value;
+    } else if (g_ascii_strcasecmp (key, "output_info") == 0) {
+      info->output_info = _option_value->value;
+    } else if (g_ascii_strcasecmp (key, "nnfw") == 0) {
+      info->nnfw = *((ml_nnfw_type_e *) _option_value->value);
+    } else if (g_ascii_strcasecmp (key, "hw") == 0) {
+      info->hw = *((ml_nnfw_hw_e *) _option_value->value);
+    } else if (g_ascii_strcasecmp (key, "models") == 0) {
+      info->models = (gchar *) _option_value->value;
+    } else if (g_ascii_strcasecmp (key, "custom") == 0) {
+      info->custom_option = (gchar *) _option_value->value;
+    } else if (g_ascii_strcasecmp (key, "framework_name") == 0) {
+      info->fw_name = (gchar *) _option_value->value;
+    } else if (g_ascii_strcasecmp (key, "max-batch") == 0) {
+      info->max_batch = *((unsigned int *) _option_value->value);
+    } else if (g_ascii_strcasecmp (key, "max-wait-us") == 0) {
+      info->max_wait_us = *((unsigned int *) _option_value->value);
+    } else if (g_ascii_strcasecmp (key, "shared-model") == 0) {
+      const gchar *val = (const gchar *) _option_value->value;
+
+      info->shared_model = (val && (g_ascii_strcasecmp (val, "true") == 0));
+    } else if (g_ascii_strcasecmp (key, "cpu-affinity") == 0) {
+      info->cpu_affinity = (gchar *) _option_value->value;
+    } else if (g_ascii_strcasecmp (key, "sched-policy") == 0) {
+      info->sched_policy = (gchar *) _option_value->value;
+    } else if (g_ascii_strcasecmp (key, "sched-priority") == 0) {
+      info->sched_priority = (gchar *) _option_value->value;
+    } else if (g_ascii_strcasecmp (key, "nice") == 0) {
+      info->nice = (gchar *) _option_value->value;
+    } else {
+      _ml_logw ("Ignore unknown key for ml_option: %s", key);
+    }
+  }
+
+}
+
+/**
+ * @brief Open new single handle with given option.
+ */
+int
+ml_single_open_with_option (ml_single_h * single, const ml_option_h option)
+{
+  ml_single_preset info = { 0, };
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!option) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'option' is NULL. It should be a valid ml_option_h, which should be created by ml_option_create().");
+  }
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'single' (ml_single_h), is NULL. It should be a valid ml_single_h instance, usually created by ml_single_open().");
+
+  __ml_single_parse_option (option, &info);
+
+  return ml_single_open_custom (single, &info);
+}
+
+/**
+ * @brief Opens an ML model with given option and loads it in the background.
+ */
+int
+ml_single_open_async (ml_single_h * single, const ml_option_h option,
+    ml_single_open_cb cb, void *user_data)
+{
+  ml_single_preset info = { 0, };
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!option) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'option' is NULL. It should be a valid ml_option_h, which should be created by ml_option_create().");
+  }
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'single' (ml_single_h), is NULL. It should be a valid pointer to get the handle.");
+
+  if (!cb)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'cb' (ml_single_open_cb), is NULL. It should be a valid function to get the result of loading the model.");
+
+  __ml_single_parse_option (option, &info);
+  info.open_cb = cb;
+  info.open_user_data = user_data;
+
+  return ml_single_open_custom (single, &info);
+}
+
+/**
+ * @brief Gets the statistics of the models shared among the single-shot handles.
+ */
+int
+ml_single_get_model_cache_stats (unsigned int *hits, unsigned int *misses,
+    unsigned int *resident)
+{
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!hits && !misses && !resident)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameters, 'hits', 'misses' and 'resident', are all NULL. At least one of them should be a valid pointer.");
+
+  G_LOCK (model_cache);
+  if (hits)
+    *hits = (unsigned int) model_cache.hits;
+  if (misses)
+    *misses = (unsigned int) model_cache.misses;
+  if (resident)
+    *resident = model_cache.table ? g_hash_table_size (model_cache.table) : 0;
+  G_UNLOCK (model_cache);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Closes the opened model handle.
+ *
+ * @details State changes performed by this function:
+ *          ANY STATE -> JOIN REQUESTED - on receiving a request to close
+ *
+ *          Once requested to close, invoke_thread() will exit after processing
+ *          the current input (if any). The requests not processed yet are
+ *          completed with an error.
+ */
+int
+ml_single_close (ml_single_h single)
+{
+  ml_single *single_h;
+  ml_single_request *request;
+  gboolean invoking;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'single' (ml_single_h), is NULL. It should be a valid ml_single_h instance, usually created by ml_single_open().");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 1);
+
+  /** Wait until the model is loaded in the background */
+  if (single_h->loader) {
+    GThread *loader = single_h->loader;
+
+    single_h->loader = NULL;
+    ML_SINGLE_HANDLE_UNLOCK (single_h);
+    g_thread_join (loader);
+    g_mutex_lock (&single_h->mutex);
+  }
+
+  single_h->state = JOIN_REQUESTED;
+  g_cond_broadcast (&single_h->cond);
+
+  /** Cancel the requests not processed yet */
+  while ((request = (ml_single_request *)
+          g_queue_pop_head (&single_h->requests)) != NULL) {
+    __cancel_request (single_h, request, ML_ERROR_STREAMS_PIPE);
+  }
+
+  /** Wait until the callers waiting for the result return back */
+  while (single_h->waiting > 0)
+    g_cond_wait (&single_h->cond, &single_h->mutex);
+
+  invoking = single_h->invoking;
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  /** Wait until invoke process is finished */
+  while (invoking) {
+    _ml_logd ("Wait 1 ms until invoke is finished and close the handle.");
+    g_usleep (1000);
+    invoking = single_h->invoking;
+    /**
+     * single_h->invoking is the only protected value here and we are
+     * doing a read-only operation and do not need to project its value
+     * after the assignment.
+     * Thus, we do not need to lock single_h here.
+     */
+  }
+
+  if (single_h->thread != NULL)
+    g_thread_join (single_h->thread);
+
+  /** locking ensures correctness with parallel calls on close */
+  if (single_h->filter) {
+    g_list_foreach (single_h->destroy_data_list, __destroy_notify, single_h);
+    g_list_free (single_h->destroy_data_list);
+
+    if (single_h->klass)
+      single_h->klass->stop (single_h->filter);
+
+    g_object_unref (single_h->filter);
+    single_h->filter = NULL;
+  }
+
+  if (single_h->model) {
+    __model_cache_release (single_h->model);
+    single_h->model = NULL;
+  }
+
+  if (single_h->model_fd >= 0) {
+    close (single_h->model_fd);
+    single_h->model_fd = -1;
+  }
+
+  if (single_h->klass) {
+    g_type_class_unref (single_h->klass);
+    single_h->klass = NULL;
+  }
+
+  _ml_tensors_info_free (&single_h->in_info);
+  _ml_tensors_info_free (&single_h->out_info);
+  if (single_h->in_tensors.info)
+    ml_tensors_info_destroy (single_h->in_tensors.info);
+  if (single_h->out_tensors.info)
+    ml_tensors_info_destroy (single_h->out_tensors.info);
+  g_free (single_h->batch);
+  g_hash_table_destroy (single_h->pending);
+
+  /** The outputs in use free their buffers when destroyed */
+  g_mutex_lock (&single_h->output_pool->lock);
+  single_h->output_pool->closed = TRUE;
+  __output_pool_flush (single_h->output_pool);
+  g_mutex_unlock (&single_h->output_pool->lock);
+  __output_pool_unref (single_h->output_pool);
+
+  g_cond_clear (&single_h->cond);
+  g_mutex_clear (&single_h->mutex);
+
+  g_free (single_h);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to validate input/output data.
+ */
+static int
+_ml_single_invoke_validate_data (ml_single_h single,
+    const ml_tensors_data_h data, const gboolean is_input)
+{
+  ml_single *single_h;
+  ml_tensors_data_s *_data;
+  ml_tensors_data_s *_model;
+  guint i;
+  size_t raw_size;
+
+  single_h = (ml_single *) single;
+  _data = (ml_tensors_data_s *) data;
+
+  if (G_UNLIKELY (!_data))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "(internal function) The parameter, 'data' (const ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+
+  if (is_input)
+    _model = &single_h->in_tensors;
+  else
+    _model = &single_h->out_tensors;
+
+  if (G_UNLIKELY (_data->num_tensors != _model->num_tensors))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "(internal function) The number of %s tensors is not compatible with model. Given: %u, Expected: %u.",
+        (is_input) ? "input" : "output", _data->num_tensors,
+        _model->num_tensors);
+
+  for (i = 0; i < _data->num_tensors; i++) {
+    if (G_UNLIKELY (!_data->tensors[i].tensor))
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The %d-th input tensor is not valid. There is no valid dimension metadata for this tensor.",
+          i);
+
+    raw_size = _model->tensors[i].size;
+    if (G_UNLIKELY (_data->tensors[i].size != raw_size))
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The size of %d-th %s tensor is not compatible with model. Given: %zu, Expected: %zu (type: %d).",
+          i, (is_input) ? "input" : "output", _data->tensors[i].size, raw_size,
+          single_h->in_info.info[i].type);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to invoke the model in the caller's thread.
+ * @note This is called with the handle locked, when there is no timeout and the invoke thread is idle.
+ * @param[in] borrow TRUE if the caller keeps the input alive until this returns.
+ * @param[in] record TRUE to record the latency in the statistics.
+ */
+static int
+_ml_single_invoke_inline (ml_single * single_h, const ml_tensors_data_h input,
+    ml_tensors_data_h * output, const gboolean need_alloc,
+    const gboolean borrow, const gboolean record)
+{
+  ml_tensors_data_h in_data, out_data;
+  gboolean free_input;
+  gboolean alloc_in_invoke = FALSE;
+  gint64 start_time;
+  int status;
+
+  start_time = g_get_monotonic_time ();
+
+  /* prepare output data */
+  if (need_alloc) {
+    *output = NULL;
+
+    status = __alloc_output (single_h, &out_data, &alloc_in_invoke);
+    if (status != ML_ERROR_NONE)
+      return status;
+  } else {
+    out_data = *output;
+  }
+
+  /**
+   * Clone input data here to prevent use-after-free case.
+   * We should release the input after calling __invoke() function.
+   * If the caller lends the input, the caller keeps the input alive
+   * until this returns.
+   */
+  free_input = !borrow;
+  if (free_input) {
+    status = ml_tensors_data_clone (input, &in_data);
+    if (status != ML_ERROR_NONE)
+      goto error;
+  } else {
+    in_data = input;
+  }
+
+  single_h->state = RUNNING;
+  single_h->invoking = TRUE;
+  status = __invoke (single_h, in_data, out_data, alloc_in_invoke);
+  if (free_input)
+    ml_tensors_data_destroy (in_data);
+  single_h->invoking = FALSE;
+  single_h->state = IDLE;
+
+  if (status != ML_ERROR_NONE)
+    goto error;
+
+  if (need_alloc) {
+    set_destroy_notify (single_h, (ml_tensors_data_s *) out_data, FALSE);
+    *output = out_data;
+  }
+
+  if (record)
+    __record_latency (single_h, start_time);
+  return ML_ERROR_NONE;
+
+error:
+  if (need_alloc)
+    ml_tensors_data_destroy (out_data);
+  return status;
+}
+
+/**
+ * @brief Internal function to invoke the model.
+ *
+ * @details State changes performed by this function:
+ *          IDLE -> RUNNING -> IDLE - if the model is invoked in the caller's thread
+ *
+ *          If there is no timeout and the invoke thread is idle, the model
+ *          is invoked in the caller's thread.
+ *          Otherwise, the request is pushed into the queue of the invoke
+ *          thread, and this waits for the processing to be complete and
+ *          returns back the result once notified by the processing thread.
+ *
+ * @note IDLE is the valid thread state before and after this function call.
+ * @param[in] record TRUE to record the latency in the statistics, FALSE for the invocations not from the application (e.g., warm-up).
+ */
+static int
+_ml_single_invoke_internal (ml_single_h single,
+    const ml_tensors_data_h input, ml_tensors_data_h * output,
+    const gboolean need_alloc, const gboolean record)
+{
+  ml_single *single_h;
+  ml_single_request *request;
+  gint64 end_time = 0;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (G_UNLIKELY (!single))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "(internal function) The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, usually created by ml_single_open().");
+
+  if (G_UNLIKELY (!input))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "(internal function) The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+
+  if (G_UNLIKELY (!output))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "(internal functino) The parameter, output (ml_tensors_data_h *), is NULL. It should be a valid pointer to an instance of ml_tensors_data_h to store the inference results.");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  if (G_UNLIKELY (!single_h->filter)) {
+    _ml_error_report
+        ("The tensor_filter element of this single handle (single_h) is not valid. It appears that the handle (ml_single_h single) is not appropriately created by ml_single_open(), user thread has touched its internal data, or the handle is already closed or freed by user.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  status = __check_loaded (single_h);
+  if (status == ML_ERROR_NONE)
+    status = __check_not_invoke_thread (single_h);
+  if (status != ML_ERROR_NONE)
+    goto exit;
+
+  /* Validate input/output data */
+  status = _ml_single_invoke_validate_data (single, input, TRUE);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("The input data for the inference is not valid: error code %d. Please check the dimensions, type, number-of-tensors, and size information of the input data.",
+        status);
+    goto exit;
+  }
+
+  if (!need_alloc) {
+    status = _ml_single_invoke_validate_data (single, *output, FALSE);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue
+          ("The output data buffer provided by the user is not valid for the given neural network mode: error code %d. Please check the dimensions, type, number-of-tensors, and size information of the output data buffer.",
+          status);
+      goto exit;
+    }
+  }
+
+  if (G_UNLIKELY (single_h->state == JOIN_REQUESTED)) {
+    _ml_error_report
+        ("The handle (single_h single) is closed or being closed awaiting for the last ongoing invocation. Invoking with such a handle is not allowed. Please open another single_h handle to invoke.");
+    status = ML_ERROR_STREAMS_PIPE;
+    goto exit;
+  }
+
+  if (single_h->timeout == 0 && single_h->state == IDLE &&
+      single_h->max_batch <= 1 && g_queue_is_empty (&single_h->requests)) {
+    /**
+     * Don't worry. We have locked single_h->mutex, thus there is no
+     * other thread with ml_single_invoke function on the same handle
+     * that are in this if-then-else block, which means that there is
+     * no other thread with active invoke-thread (calling __invoke())
+     * with the same handle. Thus we can call __invoke without
+     * having yet another mutex for __invoke.
+     */
+    status = _ml_single_invoke_inline (single_h, input, output, need_alloc,
+        single_h->borrow_input, record);
+    goto exit;
+  }
+
+  request = g_new0 (ml_single_request, 1);
+  if (request == NULL) {
+    _ml_error_report
+        ("Failed to allocate memory for the request. Out of memory?");
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto exit;
+  }
+
+  /**
+   * Clone input data here to prevent use-after-free case.
+   * The invoke thread may outlive this call with timeout, so it always needs a copy.
+   * The output is allocated by the invoke thread if needed.
+   */
+  status = ml_tensors_data_clone (input, &request->input);
+  if (status != ML_ERROR_NONE) {
+    g_free (request);
+    goto exit;
+  }
+
+  request->free_input = TRUE;
+  request->free_output = need_alloc;
+  request->no_latency = !record;
+  if (!need_alloc)
+    request->output = *output;
+
+  if (single_h->timeout > 0) {
+    /* set timeout */
+    end_time = g_get_monotonic_time () +
+        single_h->timeout * G_TIME_SPAN_MILLISECOND;
+  }
+
+  single_h->waiting++;
+
+  status = __push_request (single_h, request, end_time);
+  if (status != ML_ERROR_NONE) {
+    ml_tensors_data_destroy (request->input);
+    g_free (request);
+    goto done;
+  }
+
+  if (single_h->spin_us > 0)
+    __spin_for_done (single_h, request, end_time);
+
+  while (!request->done) {
+    if (end_time > 0) {
+      if (!g_cond_wait_until (&single_h->cond, &single_h->mutex, end_time))
+        break;
+    } else {
+      g_cond_wait (&single_h->cond, &single_h->mutex);
+    }
+  }
+
+  if (request->done) {
+    status = request->status;
+    if (status == ML_ERROR_NONE && need_alloc)
+      *output = request->output;
+    g_free (request);
+  } else {
+    _ml_logw ("Wait for invoke has timed out");
+    status = ML_ERROR_TIMED_OUT;
+
+    if (g_queue_remove (&single_h->requests, request)) {
+      /* The request is not processed yet. */
+      ml_tensors_data_destroy (request->input);
+      g_free (request);
+    } else {
+      /** This is set to notify invoke_thread to not process if timed out */
+      request->abandoned = TRUE;
+    }
+  }
+
+done:
+  single_h->waiting--;
+  if (single_h->state == JOIN_REQUESTED)
+    g_cond_broadcast (&single_h->cond);
+
+exit:
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return status;
+}
+
+/**
+ * @brief Invokes the model with the given input data.
+ */
+int
+ml_single_invoke (ml_single_h single,
+    const ml_tensors_data_h input, ml_tensors_data_h * output)
+{
+  return _ml_single_invoke_internal (single, input, output, TRUE, TRUE);
+}
+
+/**
+ * @brief Invokes the model with the given input data and fills the output data handle.
+ */
+int
+ml_single_invoke_fast (ml_single_h single,
+    const ml_tensors_data_h input, ml_tensors_data_h output)
+{
+  return _ml_single_invoke_internal (single, input, &output, FALSE, TRUE);
+}
+
+/**
+ * @brief Requests to invoke the model with the given input data and deadline, and returns immediately.
+ */
+int
+ml_single_invoke_async_full (ml_single_h single, const ml_tensors_data_h input,
+    ml_single_invoke_cb cb, void *user_data, unsigned int timeout,
+    unsigned int *request_id)
+{
+  ml_single *single_h;
+  ml_single_request *request;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (!input)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+  if (!cb)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, cb (ml_single_invoke_cb), is NULL. It should be a valid function to get the result of the inference.");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  if (G_UNLIKELY (!single_h->filter)) {
+    _ml_error_report
+        ("The tensor_filter element of this single handle (single_h) is not valid. It appears that the handle (ml_single_h single) is not appropriately created by ml_single_open(), user thread has touched its internal data, or the handle is already closed or freed by user.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  status = __check_loaded (single_h);
+  if (status != ML_ERROR_NONE)
+    goto exit;
+
+  if (G_UNLIKELY (single_h->state == JOIN_REQUESTED)) {
+    _ml_error_report
+        ("The handle (single_h single) is closed or being closed awaiting for the last ongoing invocation. Invoking with such a handle is not allowed. Please open another single_h handle to invoke.");
+    status = ML_ERROR_STREAMS_PIPE;
+    goto exit;
+  }
+
+  status = _ml_single_invoke_validate_data (single, input, TRUE);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("The input data for the inference is not valid: error code %d. Please check the dimensions, type, number-of-tensors, and size information of the input data.",
+        status);
+    goto exit;
+  }
+
+  request = g_new0 (ml_single_request, 1);
+  if (request == NULL) {
+    _ml_error_report
+        ("Failed to allocate memory for the asynchronous request. Out of memory?");
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto exit;
+  }
+
+  /**
+   * If the caller lends the input (borrow-input), the caller keeps the input
+   * alive until the callback is called.
+   */
+  request->free_input = !single_h->borrow_input;
+  if (request->free_input) {
+    status = ml_tensors_data_clone (input, &request->input);
+    if (status != ML_ERROR_NONE) {
+      g_free (request);
+      goto exit;
+    }
+  } else {
+    request->input = input;
+  }
+
+  request->free_output = TRUE;
+  request->cb = cb;
+  request->user_data = user_data;
+
+  /* The result after the deadline is dropped, even if the model is running. */
+  if (timeout > 0)
+    request->deadline = g_get_monotonic_time () +
+        timeout * G_TIME_SPAN_MILLISECOND;
+
+  single_h->waiting++;
+  status = __push_request (single_h, request, 0);
+  single_h->waiting--;
+  if (single_h->state == JOIN_REQUESTED)
+    g_cond_broadcast (&single_h->cond);
+
+  if (status != ML_ERROR_NONE) {
+    if (request->free_input)
+      ml_tensors_data_destroy (request->input);
+    g_free (request);
+    goto exit;
+  }
+
+  if (request_id) {
+    /* 0 is reserved for the request not cancellable. */
+    if (++single_h->last_request_id == 0)
+      single_h->last_request_id = 1;
+
+    request->id = single_h->last_request_id;
+    g_hash_table_insert (single_h->pending, GUINT_TO_POINTER (request->id),
+        request);
+    *request_id = request->id;
+  }
+
+exit:
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return status;
+}
+
+/**
+ * @brief Requests to invoke the model with the given input data, and returns immediately.
+ */
+int
+ml_single_invoke_async (ml_single_h single, const ml_tensors_data_h input,
+    ml_single_invoke_cb cb, void *user_data)
+{
+  return ml_single_invoke_async_full (single, input, cb, user_data, 0, NULL);
+}
+
+/**
+ * @brief Cancels the asynchronous request.
+ */
+int
+ml_single_cancel (ml_single_h single, unsigned int request_id)
+{
+  ml_single *single_h;
+  ml_single_request *request;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (request_id == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, request_id, is 0. It should be the id given by ml_single_invoke_async_full().");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  request = (ml_single_request *) g_hash_table_lookup (single_h->pending,
+      GUINT_TO_POINTER (request_id));
+  if (request == NULL) {
+    _ml_error_report
+        ("The request (id %u) is not found. It appears that the request is already completed or cancelled, or the id is not given by ml_single_invoke_async_full() with this handle.",
+        request_id);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  if (g_queue_remove (&single_h->requests, request)) {
+    /**
+     * The request is not processed yet. Wake up the callers waiting for the room.
+     * The lock is released while calling the callback, so count this caller
+     * not to close the handle until the callback returns.
+     */
+    single_h->waiting++;
+    __cancel_request (single_h, request, ML_ERROR_TRY_AGAIN);
+    single_h->waiting--;
+    g_cond_broadcast (&single_h->cond);
+  } else {
+    /**
+     * The invoke thread is running the request. The sub-plugin cannot abort
+     * the invoke, thus drop the result when the invoke is done.
+     */
+    request->drop_status = ML_ERROR_TRY_AGAIN;
+    g_hash_table_remove (single_h->pending, GUINT_TO_POINTER (request_id));
+  }
+
+exit:
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return status;
+}
+
+/**
+ * @brief Internal function to wait for the request pushed by ml_single_invoke_batch().
+ * @note This is called with the handle locked.
+ * @return TRUE if the request is done, FALSE if the wait has timed out.
+ */
+static gboolean
+__wait_request (ml_single * single_h, ml_single_request * request)
+{
+  gint64 end_time = 0;
+
+  if (single_h->timeout > 0)
+    end_time = g_get_monotonic_time () +
+        single_h->timeout * G_TIME_SPAN_MILLISECOND;
+
+  if (single_h->spin_us > 0)
+    __spin_for_done (single_h, request, end_time);
+
+  if (end_time == 0) {
+    while (!request->done)
+      g_cond_wait (&single_h->cond, &single_h->mutex);
+    return TRUE;
+  }
+
+  while (!request->done) {
+    if (!g_cond_wait_until (&single_h->cond, &single_h->mutex, end_time))
+      return request->done;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to invoke the model with the inputs of ml_single_invoke_batch() in the invoke thread.
+ * @details The requests are pushed to the queue one by one, so the invoke thread runs the model while the next input is copied.
+ *          Without timeout, the caller waits for all requests and the inputs are not copied.
+ * @note This is called with the handle locked.
+ */
+static int
+__invoke_batch_queued (ml_single * single_h, const ml_tensors_data_h * inputs,
+    ml_tensors_data_h * outputs, unsigned int n)
+{
+  ml_single_request **requests;
+  ml_single_request *request;
+  gboolean borrow;
+  unsigned int i, pushed;
+  int status = ML_ERROR_NONE;
+
+  requests = g_try_new0 (ml_single_request *, n);
+  if (requests == NULL)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the requests of the batch. Out of memory?");
+
+  /* The caller waits for all requests unless the wait is timed out. */
+  borrow = (single_h->timeout == 0);
+  single_h->waiting++;
+
+  for (pushed = 0; pushed < n; pushed++) {
+    request = g_new0 (ml_single_request, 1);
+
+    request->free_input = !borrow;
+    if (request->free_input) {
+      status = ml_tensors_data_clone (inputs[pushed], &request->input);
+      if (status != ML_ERROR_NONE) {
+        g_free (request);
+        break;
+      }
+    } else {
+      request->input = inputs[pushed];
+    }
+
+    request->free_output = TRUE;
+
+    /* Wait for the room regardless of 'queue-policy', not to drop the own requests. */
+    while (single_h->state != JOIN_REQUESTED &&
+        g_queue_get_length (&single_h->requests) >= single_h->queue_size)
+      g_cond_wait (&single_h->cond, &single_h->mutex);
+
+    status = __push_request (single_h, request, 0);
+    if (status != ML_ERROR_NONE) {
+      if (request->free_input)
+        ml_tensors_data_destroy (request->input);
+      g_free (request);
+      break;
+    }
+
+    requests[pushed] = request;
+  }
+
+  /* Wait for all requests pushed, even if pushing the rest has failed. */
+  for (i = 0; i < pushed; i++) {
+    request = requests[i];
+
+    if (__wait_request (single_h, request)) {
+      if (status == ML_ERROR_NONE)
+        status = request->status;
+
+      outputs[i] = request->output;
+      g_free (request);
+      continue;
+    }
+
+    _ml_logw ("Wait for invoke of the batch has timed out");
+    status = ML_ERROR_TIMED_OUT;
+
+    if (g_queue_remove (&single_h->requests, request)) {
+      /* The request is not processed yet. */
+      ml_tensors_data_destroy (request->input);
+      g_free (request);
+    } else {
+      /** This is set to notify invoke_thread to not process if timed out */
+      request->abandoned = TRUE;
+    }
+  }
+
+  single_h->waiting--;
+  if (single_h->state == JOIN_REQUESTED)
+    g_cond_broadcast (&single_h->cond);
+
+  g_free (requests);
+  return status;
+}
+
+/**
+ * @brief Invokes the model with the array of the input data.
+ */
+int
+ml_single_invoke_batch (ml_single_h single, const ml_tensors_data_h * inputs,
+    ml_tensors_data_h * outputs, unsigned int n)
+{
+  ml_single *single_h;
+  unsigned int i;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (!inputs)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, inputs (const ml_tensors_data_h *), is NULL. It should be a valid array of ml_tensors_data_h.");
+  if (!outputs)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, outputs (ml_tensors_data_h *), is NULL. It should be a valid array to store the inference results.");
+  if (n == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, n, is 0. It should be the positive number of the input data.");
+
+  for (i = 0; i < n; i++)
+    outputs[i] = NULL;
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  if (G_UNLIKELY (!single_h->filter)) {
+    _ml_error_report
+        ("The tensor_filter element of this single handle (single_h) is not valid. It appears that the handle (ml_single_h single) is not appropriately created by ml_single_open(), user thread has touched its internal data, or the handle is already closed or freed by user.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  status = __check_loaded (single_h);
+  if (status == ML_ERROR_NONE)
+    status = __check_not_invoke_thread (single_h);
+  if (status != ML_ERROR_NONE)
+    goto exit;
+
+  if (G_UNLIKELY (single_h->state == JOIN_REQUESTED)) {
+    _ml_error_report
+        ("The handle (single_h single) is closed or being closed awaiting for the last ongoing invocation. Invoking with such a handle is not allowed. Please open another single_h handle to invoke.");
+    status = ML_ERROR_STREAMS_PIPE;
+    goto exit;
+  }
+
+  /* Validate all inputs before invoking the model. */
+  for (i = 0; i < n; i++) {
+    status = _ml_single_invoke_validate_data (single, inputs[i], TRUE);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue
+          ("The %u-th input data of the batch is not valid: error code %d. Please check the dimensions, type, number-of-tensors, and size information of the input data.",
+          i, status);
+      goto exit;
+    }
+  }
+
+  if (single_h->timeout == 0 && single_h->state == IDLE &&
+      single_h->max_batch <= 1 && g_queue_is_empty (&single_h->requests)) {
+    /* Same as ml_single_invoke(), the caller keeps the inputs until this returns. */
+    for (i = 0; i < n; i++) {
+      status = _ml_single_invoke_inline (single_h, inputs[i], &outputs[i],
+          TRUE, TRUE, TRUE);
+      if (status != ML_ERROR_NONE)
+        break;
+    }
+  } else {
+    status = __invoke_batch_queued (single_h, inputs, outputs, n);
+  }
+
+exit:
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  /* The output may lock the handle when destroyed. */
+  if (status != ML_ERROR_NONE) {
+    for (i = 0; i < n; i++) {
+      if (outputs[i]) {
+        ml_tensors_data_destroy (outputs[i]);
+        outputs[i] = NULL;
+      }
+    }
+  }
+
+  return status;
+}
+
+/**
+ * @brief Invokes the model with synthetic input data to warm up the framework.
+ */
+int
+ml_single_warmup (ml_single_h single, unsigned int n)
+{
+  ml_tensors_info_h in_info = NULL;
+  ml_tensors_data_h input = NULL, output;
+  ml_tensors_data_s *_input;
+  unsigned int i;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (n == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, n, is 0. It should be the positive number of the invocations to warm up the model.");
+
+  status = ml_single_get_input_info (single, &in_info);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to get the input information to warm up the model. Error code: %d",
+        status);
+    return status;
+  }
+
+  /* The input sized from the input tensors of the model. */
+  status = ml_tensors_data_create (in_info, &input);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to create the input data to warm up the model. Error code: %d",
+        status);
+    goto done;
+  }
+
+  /**
+   * The buffers are not zero-filled with ML_TENSORS_ALLOC_NO_ZERO_FILL.
+   * Fill them with zero, not to warm up with the garbage (e.g., NaN or denormal values).
+   */
+  _input = (ml_tensors_data_s *) input;
+  for (i = 0; i < _input->num_tensors; i++)
+    memset (_input->tensors[i].tensor, 0, _input->tensors[i].size);
+
+  /* The latency of the warm-up is not the one of the application, do not record it. */
+  for (i = 0; i < n; i++) {
+    status = _ml_single_invoke_internal (single, input, &output, TRUE, FALSE);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue
+          ("Failed to invoke the model to warm up (%u of %u). Error code: %d",
+          i + 1, n, status);
+      goto done;
+    }
+
+    ml_tensors_data_destroy (output);
+  }
+
+done:
+  if (input)
+    ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  return status;
+}
+
+/**
+ * @brief Gets the tensors info for the given handle.
+ * @param[out] info A pointer to a NULL (unallocated) instance.
+ */
+static int
+ml_single_get_tensors_info (ml_single_h single, gboolean is_input,
+    ml_tensors_info_h * info)
+{
+  ml_single *single_h;
+  int status = ML_ERROR_NONE;
+  ml_tensors_info_s *input_info;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "(internal function) The parameter, 'single' (ml_single_h), is NULL. It should be a valid ml_single_h instance, usually created by ml_single_open().");
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "(internal function) The parameter, 'info' (ml_tensors_info_h *) is NULL. It should be a valid pointer to an empty (NULL) instance of ml_tensor_info_h, which is supposed to be filled with the fetched info by this function.");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  status = __check_loaded (single_h);
+  if (status != ML_ERROR_NONE)
+    goto exit;
+
+  /* allocate handle for tensors info */
+  status = ml_tensors_info_create (info);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("(internal function) Failed to create an entry for the ml_tensors_info_h instance. Error code: %d",
+        status);
+    goto exit;
+  }
+
+  input_info = (ml_tensors_info_s *) (*info);
+
+  if (is_input)
+    status = ml_tensors_info_clone (input_info, &single_h->in_info);
+  else
+    status = ml_tensors_info_clone (input_info, &single_h->out_info);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("(internal function) Failed to clone fetched input/output metadata to output pointer (ml_tensors_info *info). Error code: %d",
+        status);
+    ml_tensors_info_destroy (input_info);
+  }
+
+exit:
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return status;
+}
+
+/**
+ * @brief Gets the information of required input data for the given handle.
+ * @note information = (tensor dimension, type, name and so on)
+ */
+int
+ml_single_get_input_info (ml_single_h single, ml_tensors_info_h * info)
+{
+  return ml_single_get_tensors_info (single, TRUE, info);
+}
+
+/**
+ * @brief Gets the information of output data for the given handle.
+ * @note information = (tensor dimension, type, name and so on)
+ */
+int
+ml_single_get_output_info (ml_single_h single, ml_tensors_info_h * info)
+{
+  return ml_single_get_tensors_info (single, FALSE, info);
+}
+
+/**
+ * @brief Sets the maximum amount of time to wait for an output, in milliseconds.
+ */
+int
+ml_single_set_timeout (ml_single_h single, unsigned int timeout)
+{
+  ml_single *single_h;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  single_h->timeout = (guint) timeout;
+
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Sets the information (tensor dimension, type, name and so on) of required input data for the given model.
+ */
+int
+ml_single_set_input_info (ml_single_h single, const ml_tensors_info_h info)
+{
+  ml_single *single_h;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info (const ml_tensors_info_h), is NULL. It should be a valid instance of ml_tensors_info_h, which is usually created by ml_tensors_info_create() or other APIs.");
+
+  if (!ml_tensors_info_is_valid (info))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info (const ml_tensors_info_h), is not valid. Although it is not NULL, the content of 'info' is invalid. If it is created by ml_tensors_info_create(), which creates an empty instance, it should be filled by users afterwards. Please check if 'info' has all elements filled with valid values.");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+  status = __check_loaded (single_h);
+  if (status == ML_ERROR_NONE)
+    status = ml_single_set_gst_info (single_h, info);
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_continue
+        ("ml_single_set_gst_info() has failed to configure the single_h handle with the given info. Error code: %d",
+        status);
+
+  return status;
+}
+
+/**
+ * @brief Invokes the model with the given input data with the given info.
+ */
+int
+ml_single_invoke_dynamic (ml_single_h single,
+    const ml_tensors_data_h input, const ml_tensors_info_h in_info,
+    ml_tensors_data_h * output, ml_tensors_info_h * out_info)
+{
+  ml_single *single_h;
+  int status;
+  ml_tensors_info_h cur_in_info = NULL;
+  gboolean reconfigured = FALSE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (!input)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, input (const ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h with input data frame for inference.");
+  if (!in_info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, in_info (const ml_tensors_info_h), is NULL. It should be a valid instance of ml_tensor_info_h that describes metadata of the given input for inference (input).");
+  if (!output)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, output (ml_tensors_data_h *), is NULL. It should be a pointer to an empty (NULL or do-not-care) instance of ml_tensors_data_h, which is filled by this API with the result of inference.");
+  if (!out_info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, out_info (ml_tensors_info_h *), is NULL. It should be a pointer to an empty (NULL or do-not-care) instance of ml_tensors_info_h, which is filled by this API with the neural network model info.");
+
+  /* init null */
+  *output = NULL;
+  *out_info = NULL;
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  status = __check_loaded (single_h);
+  if (status == ML_ERROR_NONE)
+    status = __check_not_invoke_thread (single_h);
+  if (status == ML_ERROR_NONE)
+    status = __clone_tensors_info (&cur_in_info, &single_h->in_info);
+  if (status != ML_ERROR_NONE) {
+    ML_SINGLE_HANDLE_UNLOCK (single_h);
+    _ml_error_report_continue
+        ("Failed to get input metadata configured by the opened single_h handle instance. Error code: %d.",
+        status);
+    goto exit;
+  }
+
+  status = __configure_shape (single_h, in_info, out_info, &reconfigured);
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to reconfigure the opened single_h handle instance with the updated input/output metadata. Error code: %d.",
+        status);
+    goto exit;
+  }
+
+  status = ml_single_invoke (single, input, output);
+  if (status != ML_ERROR_NONE) {
+    if (reconfigured)
+      ml_single_set_input_info (single, cur_in_info);
+    if (status != ML_ERROR_TRY_AGAIN) {
+      /* If it's TRY_AGAIN, ml_single_invoke() has already gave enough info. */
+      _ml_error_report_continue
+          ("Invoking the given neural network has failed. Error code: %d.",
+          status);
+    }
+  }
+
+exit:
+  if (cur_in_info)
+    ml_tensors_info_destroy (cur_in_info);
+
+  if (status != ML_ERROR_NONE) {
+    if (*out_info) {
+      ml_tensors_info_destroy (*out_info);
+      *out_info = NULL;
+    }
+  }
+
+  return status;
+}
+
+/**
+ * @brief Sets the property value for the given model.
+ */
+int
+ml_single_set_property (ml_single_h single, const char *name, const char *value)
+{
+  ml_single *single_h;
+  int status = ML_ERROR_NONE;
+  char *old_value = NULL;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (!name)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, name (const char *), is NULL. It should be a valid string representing a property key.");
+
+  /* get old value, also check the property is updatable. */
+  _ml_error_report_return_continue_iferr
+      (ml_single_get_property (single, name, &old_value),
+      "Cannot fetch the previous value for the given property name, '%s'. It appears that the property key, '%s', is invalid (not supported).",
+      name, name);
+
+  /* if sets same value, do not change. */
+  if (old_value && value && g_ascii_strcasecmp (old_value, value) == 0) {
+    g_free (old_value);
+    return ML_ERROR_NONE;
+  }
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  /* update property */
+  if (g_str_equal (name, "is-updatable")) {
+    if (!value)
+      goto error;
+    /* boolean */
+    if (g_ascii_strcasecmp (value, "true") == 0) {
+      if (g_ascii_strcasecmp (old_value, "true") != 0)
+        g_object_set (G_OBJECT (single_h->filter), name, (gboolean) TRUE, NULL);
+    } else if (g_ascii_strcasecmp (value, "false") == 0) {
+      if (g_ascii_strcasecmp (old_value, "false") != 0)
+        g_object_set (G_OBJECT (single_h->filter), name, (gboolean) FALSE,
+            NULL);
+    } else {
+      _ml_error_report
+          ("The property value, '%s', is not appropriate for a boolean property 'is-updatable'. It should be either 'true' or 'false'.",
+          value);
+      status = ML_ERROR_INVALID_PARAMETER;
+    }
+  } else if (g_str_equal (name, "borrow-input")) {
+    if (!value)
+      goto error;
+    /* boolean, handled by single-shot itself */
+    if (g_ascii_strcasecmp (value, "true") == 0) {
+      single_h->borrow_input = TRUE;
+    } else if (g_ascii_strcasecmp (value, "false") == 0) {
+      single_h->borrow_input = FALSE;
+    } else {
+      _ml_error_report
+          ("The property value, '%s', is not appropriate for a boolean property 'borrow-input'. It should be either 'true' or 'false'.",
+          value);
+      status = ML_ERROR_INVALID_PARAMETER;
+    }
+  } else if (g_str_equal (name, "queue-size")) {
+    guint64 size;
+    gchar *endptr = NULL;
+
+    if (!value)
+      goto error;
+    /* positive integer, handled by single-shot itself */
+    size = g_ascii_strtoull (value, &endptr, 10);
+    if (endptr == value || *endptr != '\0' || size == 0 || size > G_MAXUINT) {
+      _ml_error_report
+          ("The property value, '%s', is not appropriate for the property 'queue-size'. It should be a positive integer.",
+          value);
+      status = ML_ERROR_INVALID_PARAMETER;
+    } else {
+      single_h->queue_size = (guint) size;
+      /* Wake up the callers waiting for the room. */
+      g_cond_broadcast (&single_h->cond);
+    }
+  } else if (g_str_equal (name, "queue-policy")) {
+    guint i;
+
+    if (!value)
+      goto error;
+    /* string, handled by single-shot itself */
+    for (i = 0; i < QUEUE_POLICY_MAX; i++) {
+      if (g_ascii_strcasecmp (value, queue_policy_name[i]) == 0)
+        break;
+    }
+
+    if (i < QUEUE_POLICY_MAX) {
+      single_h->policy = (queue_policy) i;
+      g_cond_broadcast (&single_h->cond);
+    } else {
+      _ml_error_report
+          ("The property value, '%s', is not appropriate for the property 'queue-policy'. It should be one of {block, fail, drop-oldest}.",
+          value);
+      status = ML_ERROR_INVALID_PARAMETER;
+    }
+  } else if (g_str_equal (name, "output-pool-size")) {
+    guint64 size;
+    gchar *endptr = NULL;
+
+    if (!value)
+      goto error;
+    /* non-negative integer, handled by single-shot itself */
+    size = g_ascii_strtoull (value, &endptr, 10);
+    if (endptr == value || *endptr != '\0' || size > G_MAXUINT) {
+      _ml_error_report
+          ("The property value, '%s', is not appropriate for the property 'output-pool-size'. It should be a non-negative integer.",
+          value);
+      status = ML_ERROR_INVALID_PARAMETER;
+    } else {
+      ml_single_output_pool *pool = single_h->output_pool;
+
+      g_mutex_lock (&pool->lock);
+      pool->max_buffers = (guint) size;
+      while (g_queue_get_length (&pool->buffers) > pool->max_buffers) {
+        gpointer *buffers = (gpointer *) g_queue_pop_tail (&pool->buffers);
+        guint i;
+
+        for (i = 0; i < pool->num_tensors; i++)
+          g_free (buffers[i]);
+        g_free (buffers);
+      }
+      g_mutex_unlock (&pool->lock);
+    }
+  } else if (g_str_equal (name, "handoff-spin-us")) {
+    guint64 usec;
+    gchar *endptr = NULL;
+
+    if (!value)
+      goto error;
+    /* non-negative integer, handled by single-shot itself */
+    usec = g_ascii_strtoull (value, &endptr, 10);
+    if (endptr == value || *endptr != '\0' ||
+        usec > SINGLE_MAX_HANDOFF_SPIN_US) {
+      _ml_error_report
+          ("The property value, '%s', is not appropriate for the property 'handoff-spin-us'. It should be a non-negative integer up to %u.",
+          value, SINGLE_MAX_HANDOFF_SPIN_US);
+      status = ML_ERROR_INVALID_PARAMETER;
+    } else {
+      single_h->spin_us = (guint) usec;
+    }
+  } else if (g_str_equal (name, "queue-depth") ||
+      g_str_equal (name, "queue-wait-time") ||
+      g_str_equal (name, "queue-max-wait-time") ||
+      g_str_equal (name, "queue-dropped") ||
+      g_str_equal (name, "output-pool-available") ||
+      g_str_equal (name, "output-pool-high-water") ||
+      g_str_equal (name, "latency-stats")) {
+    _ml_error_report
+        ("The property '%s' is read-only. It cannot be updated with ml_single_set_property().",
+        name);
+    status = ML_ERROR_INVALID_PARAMETER;
+  } else if (g_str_equal (name, "input") || g_str_equal (name, "inputtype")
+      || g_str_equal (name, "inputname") || g_str_equal (name, "output")
+      || g_str_equal (name, "outputtype") || g_str_equal (name, "outputname")) {
+    GstTensorsInfo gst_info;
+    gboolean is_input = g_str_has_prefix (name, "input");
+    guint num;
+
+    if (!value)
+      goto error;
+
+    ml_single_get_gst_info (single_h, is_input, &gst_info);
+
+    if (g_str_has_suffix (name, "type"))
+      num = gst_tensors_info_parse_types_string (&gst_info, value);
+    else if (g_str_has_suffix (name, "name"))
+      num = gst_tensors_info_parse_names_string (&gst_info, value);
+    else {
+      guint *rank;
+      gchar **str_dims;
+      guint i;
+
+      if (is_input) {
+        rank = single_h->input_ranks;
+      } else {
+        rank = single_h->output_ranks;
+      }
+
+      str_dims = g_strsplit_set (value, ",.", -1);
+      num = g_strv_length (str_dims);
+
+      if (num > ML_TENSOR_SIZE_LIMIT) {
+        _ml_error_report ("Invalid param, dimensions (%d) max (%d)\n",
+            num, ML_TENSOR_SIZE_LIMIT);
+
+        num = ML_TENSOR_SIZE_LIMIT;
+      }
+
+      for (i = 0; i < num; ++i) {
+        rank[i] = gst_tensor_parse_dimension (str_dims[i],
+            gst_info.info[i].dimension);
+      }
+      g_strfreev (str_dims);
+    }
+
+    if (num == gst_info.num_tensors) {
+      ml_tensors_info_h ml_info;
+
+      _ml_tensors_info_create_from_gst (&ml_info, &gst_info);
+
+      /* change configuration */
+      status = ml_single_set_gst_info (single_h, ml_info);
+
+      ml_tensors_info_destroy (ml_info);
+    } else {
+      _ml_error_report
+          ("The property value, '%s', is not appropriate for the given property key, '%s'. The API has failed to parse the given property value.",
+          value, name);
+      status = ML_ERROR_INVALID_PARAMETER;
+    }
+
+    gst_tensors_info_free (&gst_info);
+  } else {
+    g_object_set (G_OBJECT (single_h->filter), name, value, NULL);
+  }
+  goto done;
+error:
+  _ml_error_report
+      ("The parameter, value (const char *), is NULL. It should be a valid string representing the value to be set for the given property key, '%s'",
+      name);
+  status = ML_ERROR_INVALID_PARAMETER;
+done:
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  g_free (old_value);
+  return status;
+}
+
+/**
+ * @brief Gets the property value for the given model.
+ */
+int
+ml_single_get_property (ml_single_h single, const char *name, char **value)
+{
+  ml_single *single_h;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (!name)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, name (const char *), is NULL. It should be a valid string representing a property key.");
+  if (!value)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, value (const char *), is NULL. It should be a valid string representing the value to be set for the given property key, '%s'",
+        name);
+
+  /* init null */
+  *value = NULL;
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  status = __check_loaded (single_h);
+  if (status != ML_ERROR_NONE) {
+    ML_SINGLE_HANDLE_UNLOCK (single_h);
+    return status;
+  }
+
+  if (g_str_equal (name, "inputtype") || g_str_equal (name, "inputname") ||
+      g_str_equal (name, "inputlayout") || g_str_equal (name, "outputtype") ||
+      g_str_equal (name, "outputname") || g_str_equal (name, "outputlayout") ||
+      g_str_equal (name, "accelerator") || g_str_equal (name, "custom")) {
+    /* string */
+    g_object_get (G_OBJECT (single_h->filter), name, value, NULL);
+  } else if (g_str_equal (name, "is-updatable")) {
+    gboolean bool_value = FALSE;
+
+    /* boolean */
+    g_object_get (G_OBJECT (single_h->filter), name, &bool_value, NULL);
+    *value = (bool_value) ? g_strdup ("true") : g_strdup ("false");
+  } else if (g_str_equal (name, "borrow-input")) {
+    *value = (single_h->borrow_input) ? g_strdup ("true") : g_strdup ("false");
+  } else if (g_str_equal (name, "queue-size")) {
+    *value = g_strdup_printf ("%u", single_h->queue_size);
+  } else if (g_str_equal (name, "queue-policy")) {
+    *value = g_strdup (queue_policy_name[single_h->policy]);
+  } else if (g_str_equal (name, "queue-depth")) {
+    *value = g_strdup_printf ("%u", g_queue_get_length (&single_h->requests));
+  } else if (g_str_equal (name, "queue-wait-time")) {
+    /* average time (usec) the requests have waited in the queue */
+    gint64 avg = (single_h->queue_processed > 0) ?
+        single_h->queue_wait_total / (gint64) single_h->queue_processed : 0;
+
+    *value = g_strdup_printf ("%" G_GINT64_FORMAT, avg);
+  } else if (g_str_equal (name, "queue-max-wait-time")) {
+    *value = g_strdup_printf ("%" G_GINT64_FORMAT, single_h->queue_wait_max);
+  } else if (g_str_equal (name, "queue-dropped")) {
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT, single_h->queue_dropped);
+  } else if (g_str_equal (name, "output-pool-size") ||
+      g_str_equal (name, "output-pool-available") ||
+      g_str_equal (name, "output-pool-high-water")) {
+    ml_single_output_pool *pool = single_h->output_pool;
+    guint val;
+
+    g_mutex_lock (&pool->lock);
+    if (g_str_equal (name, "output-pool-size"))
+      val = pool->max_buffers;
+    else if (g_str_equal (name, "output-pool-available"))
+      val = g_queue_get_length (&pool->buffers);
+    else
+      val = pool->high_water;
+    g_mutex_unlock (&pool->lock);
+
+    *value = g_strdup_printf ("%u", val);
+  } else if (g_str_equal (name, "latency-stats")) {
+    *value = __latency_stats_string (single_h);
+  } else if (g_str_equal (name, "handoff-spin-us")) {
+    *value = g_strdup_printf ("%u", single_h->spin_us);
+  } else if (g_str_equal (name, "input") || g_str_equal (name, "output")) {
+    gchar *dim_str = NULL;
+    const guint *rank;
+    gboolean is_input = g_str_has_prefix (name, "input");
+    GstTensorsInfo gst_info;
+
+    if (is_input) {
+      rank = single_h->input_ranks;
+    } else {
+      rank = single_h->output_ranks;
+    }
+
+    ml_single_get_gst_info (single_h, is_input, &gst_info);
+
+    if (gst_info.num_tensors > 0) {
+      guint i;
+      GString *dimensions = g_string_new (NULL);
+
+      for (i = 0; i < gst_info.num_tensors; ++i) {
+        dim_str =
+            gst_tensor_get_rank_dimension_string (gst_info.info[i].dimension,
+            *(rank + i));
+        g_string_append (dimensions, dim_str);
+
+        if (i < gst_info.num_tensors - 1) {
+          g_string_append (dimensions, ",");
+        }
+        g_free (dim_str);
+      }
+      dim_str = g_string_free (dimensions, FALSE);
+    } else {
+      dim_str = g_strdup ("");
+    }
+    *value = dim_str;
+  } else {
+    _ml_error_report
+        ("The property key, '%s', is not available for get_property and not recognized by the API. It should be one of {input, inputtype, inputname, inputlayout, output, outputtype, outputname, outputlayout, accelerator, custom, is-updatable, borrow-input, queue-size, queue-policy, queue-depth, queue-wait-time, queue-max-wait-time, queue-dropped, output-pool-size, output-pool-available, output-pool-high-water, latency-stats, handoff-spin-us}.",
+        name);
+    status = ML_ERROR_NOT_SUPPORTED;
+  }
+
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return status;
+}
+
+/**
+ * @brief Internal helper function to validate model files.
+ */
+static int
+__ml_validate_model_file (const char *const *model,
+    const unsigned int num_models, gboolean * is_dir)
+{
+  guint i;
+
+  if (!model)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, model, is NULL. It should be a valid array of strings, where each string is a valid file path for a neural network model file.");
+  if (num_models < 1)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, num_models, is 0. It should be the number of files for the given neural network model.");
+
+  if (g_file_test (model[0], G_FILE_TEST_IS_DIR)) {
+    *is_dir = TRUE;
+    return ML_ERROR_NONE;
+  }
+
+  for (i = 0; i < num_models; i++) {
+    if (!model[i] || !g_file_test (model[i], G_FILE_TEST_IS_REGULAR)) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, model path [%d] = \"%s\" is invalid or the file is not found or accessible.",
+          i, _STR_NULL (model[i]));
+    }
+  }
+
+  *is_dir = FALSE;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Validates the nnfw model file.
+ * @since_tizen 5.5
+ * @param[in] model The path of model file.
+ * @param[in/out] nnfw The type of NNFW.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or framework to support this model file is unavailable in the environment.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int
+_ml_validate_model_file (const char *const *model,
+    const unsigned int num_models, ml_nnfw_type_e * nnfw)
+{
+  int status = ML_ERROR_NONE;
+  ml_nnfw_type_e detected = ML_NNFW_TYPE_ANY;
+  gboolean is_dir = FALSE;
+  gchar *pos, *fw_name;
+  gchar **file_ext = NULL;
+  guint i;
+
+  if (!nnfw)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, nnfw, is NULL. It should be a valid pointer of ml_nnfw_type_e.");
+
+  _ml_error_report_return_continue_iferr (__ml_validate_model_file (model,
+          num_models, &is_dir),
+      "The parameters, model and num_models, are not valid.");
+
+  /**
+   * @note detect-fw checks the file ext and returns proper fw name for given models.
+   * If detected fw and given nnfw are same, we don't need to check the file extension.
+   * If any condition for auto detection is added later, below code also should be updated.
+   */
+  fw_name = gst_tensor_filter_detect_framework (model, num_models, TRUE);
+  detected = _ml_get_nnfw_type_by_subplugin_name (fw_name);
+  g_free (fw_name);
+
+  if (*nnfw == ML_NNFW_TYPE_ANY) {
+    if (detected == ML_NNFW_TYPE_ANY) {
+      _ml_error_report
+          ("The given neural network model (1st path is \"%s\", and there are %d paths declared) has unknown or unsupported extension. Please check its corresponding neural network framework and try to specify it instead of \"ML_NNFW_TYPE_ANY\".",
+          model[0], num_models);
+      status = ML_ERROR_INVALID_PARAMETER;
+    } else {
+      _ml_logi ("The given model is supposed a %s model.",
+          _ml_get_nnfw_subplugin_name (detected));
+      *nnfw = detected;
+    }
+
+    goto done;
+  } else if (is_dir && *nnfw != ML_NNFW_TYPE_NNFW) {
+    /* supposed it is ONE if given model is directory */
+    _ml_error_report
+        ("The given model (1st path is \"%s\", and there are %d paths declared) is directory, which is allowed by \"NNFW (One Runtime)\" only, Please check the model and framework.",
+        model[0], num_models);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  } else if (detected == *nnfw) {
+    /* Expected framework, nothing to do. */
+    goto done;
+  }
+
+  /* Handle mismatched case, check file extension. */
+  file_ext = g_malloc0 (sizeof (char *) * (num_models + 1));
+  for (i = 0; i < num_models; i++) {
+    if ((pos = strrchr (model[i], '.')) == NULL) {
+      _ml_error_report ("The given model [%d]=\"%s\" has invalid extension.", i,
+          model[i]);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    file_ext[i] = g_ascii_strdown (pos, -1);
+  }
+
+  /** @todo Make sure num_models is correct for each nnfw type */
+  switch (*nnfw) {
+    case ML_NNFW_TYPE_NNFW:
+    case ML_NNFW_TYPE_TVM:
+      /**
+       * We cannot check the file ext with NNFW.
+       * NNFW itself will validate metadata and model file.
+       */
+      break;
+    case ML_NNFW_TYPE_MVNC:
+    case ML_NNFW_TYPE_OPENVINO:
+    case ML_NNFW_TYPE_EDGE_TPU:
+      /**
+       * @todo Need to check method to validate model
+       * Although nnstreamer supports these frameworks,
+       * ML-API implementation is not ready.
+       */
+      _ml_error_report
+          ("Given NNFW is not supported by ML-API Inference.Single, yet, although it is supported by NNStreamer. If you have such NNFW integrated into your machine and want to access via ML-API, please update the corresponding implementation or report and discuss at github.com/nnstreamer/nnstreamer/issues.");
+      status = ML_ERROR_NOT_SUPPORTED;
+      break;
+    case ML_NNFW_TYPE_VD_AIFW:
+      if (!g_str_equal (file_ext[0], ".nb") &&
+          !g_str_equal (file_ext[0], ".ncp") &&
+          !g_str_equal (file_ext[0], ".tvn") &&
+          !g_str_equal (file_ext[0], ".bin")) {
+        status = ML_ERROR_INVALID_PARAMETER;
+      }
+      break;
+    case ML_NNFW_TYPE_SNAP:
+#if !defined (__ANDROID__)
+      _ml_error_report ("SNAP is supported by Android/arm64-v8a devices only.");
+      status = ML_ERROR_NOT_SUPPORTED;
+#endif
+      /* SNAP requires multiple files, set supported if model file exists. */
+      break;
+    case ML_NNFW_TYPE_ARMNN:
+      if (!g_str_equal (file_ext[0], ".caffemodel") &&
+          !g_str_equal (file_ext[0], ".tflite") &&
+          !g_str_equal (file_ext[0], ".pb") &&
+          !g_str_equal (file_ext[0], ".prototxt")) {
+        _ml_error_report
+            ("ARMNN accepts .caffemodel, .tflite, .pb, and .prototxt files only. Please support correct file extension. You have specified: \"%s\"",
+            file_ext[0]);
+        status = ML_ERROR_INVALID_PARAMETER;
+      }
+      break;
+    case ML_NNFW_TYPE_MXNET:
+      if (!g_str_equal (file_ext[0], ".params") &&
+          !g_str_equal (file_ext[0], ".json")) {
+        status = ML_ERROR_INVALID_PARAMETER;
+      }
+      break;
+    default:
+      _ml_error_report
+          ("You have designated an incorrect neural network framework (out of bound).");
+      status = ML_ERROR_INVALID_PARAMETER;
+      break;
+  }
+
+done:
+  if (status == ML_ERROR_NONE) {
+    if (!_ml_nnfw_is_available (*nnfw, ML_NNFW_HW_ANY)) {
+      status = ML_ERROR_NOT_SUPPORTED;
+      _ml_error_report
+          ("The subplugin for tensor-filter \"%s\" is not available. Please install the corresponding tensor-filter subplugin file (usually, \"libnnstreamer_filter_${NAME}.so\") at the correct path. Please use \"nnstreamer-check\" utility to check related configurations. If you do not have the utility ready, build and install \"confchk\", which is located at ${nnstreamer_source}/tools/development/confchk/ .",
+          _ml_get_nnfw_subplugin_name (*nnfw));
+    }
+  } else {
+    _ml_error_report
+        ("The given model file, \"%s\" (1st of %d files), is invalid.",
+        model[0], num_models);
+  }
+
+  g_strfreev (file_ext);
+  return status;
+}
+
+/** Group of the single-shot handles, which is the common part of the pool, series and ensemble handles */
+typedef struct
+{
+  const gchar *name;                  /**< name of the group handle for the messages */
+  ml_single_h *singles;               /**< single-shot handles */
+  guint num_singles;                  /**< number of the handles opened */
+  guint magic;                        /**< code to verify valid handle */
+
+  GMutex lock;                        /**< mutex for synchronization */
+  GCond cond;                         /**< condition for synchronization */
+  guint pending;                      /**< number of requests in progress */
+  gboolean closing;                   /**< true if the group is being closed */
+} ml_single_group;
+
+/** Function to cancel the requests not processed yet when closing the group, called with the group locked */
+typedef void (*ml_single_group_cancel_cb) (ml_single_group * group);
+
+/**
+ * @brief Internal function to initialize the group to open the given number of handles.
+ */
+static void
+__group_init (ml_single_group * group, const gchar * name, guint size)
+{
+  group->name = name;
+  group->singles = g_new0 (ml_single_h, size);
+  g_mutex_init (&group->lock);
+  g_cond_init (&group->cond);
+}
+
+/**
+ * @brief Internal function to open the next handle of the group with the given ml-option.
+ * @param[in] borrow TRUE to set the property 'borrow-input', if the input is kept until the handle returns the output.
+ */
+static int
+__group_open_single (ml_single_group * group, const ml_option_h option,
+    gboolean borrow)
+{
+  ml_single_h single;
+  guint idx = group->num_singles;
+  int status;
+
+  if (!option)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The %u-th option of the %s is NULL. It should be a valid ml_option_h instance.",
+        idx, group->name);
+
+  status = ml_single_open_with_option (&single, option);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to open the %u-th model of the %s. Error code: %d.",
+        idx, group->name, status);
+
+  if (borrow) {
+    status = ml_single_set_property (single, "borrow-input", "true");
+    if (status != ML_ERROR_NONE) {
+      ml_single_close (single);
+      return status;
+    }
+  }
+
+  group->singles[group->num_singles++] = single;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to close all the handles of the group and release the resources.
+ * @note The group handle itself is released by the caller.
+ */
+static void
+__group_clear (ml_single_group * group)
+{
+  guint i;
+
+  for (i = 0; i < group->num_singles; i++)
+    ml_single_close (group->singles[i]);
+
+  g_cond_clear (&group->cond);
+  g_mutex_clear (&group->lock);
+  g_free (group->singles);
+}
+
+/**
+ * @brief Internal function to get the group of the given handle and mark a request in progress.
+ * @details The group is not closed until __group_end() is called.
+ */
+static int
+__group_begin (gpointer handle, guint magic, ml_single_group ** group)
+{
+  ml_single_group *_group;
+
+  G_LOCK (magic);
+  _group = (ml_single_group *) handle;
+  if (G_UNLIKELY (_group->magic != magic)) {
+    G_UNLOCK (magic);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The given handle is invalid. It is not the handle of the pool, series or ensemble it is given to, or the user thread has modified it.");
+  }
+  g_mutex_lock (&_group->lock);
+  G_UNLOCK (magic);
+
+  if (G_UNLIKELY (_group->closing)) {
+    g_mutex_unlock (&_group->lock);
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "The %s handle is being closed. Such a handle cannot be used any more.",
+        _group->name);
+  }
+
+  _group->pending++;
+  g_mutex_unlock (&_group->lock);
+
+  *group = _group;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to mark the request of the group done.
+ */
+static void
+__group_end (ml_single_group * group)
+{
+  g_mutex_lock (&group->lock);
+  group->pending--;
+  g_cond_broadcast (&group->cond);
+  g_mutex_unlock (&group->lock);
+}
+
+/**
+ * @brief Internal function to close the group of the given handle, after the requests in progress are done.
+ * @param[in] cancel The function to cancel the requests not processed yet, NULL if there is no such request.
+ * @note This releases the resources of the group, and the caller releases the handle itself.
+ */
+static int
+__group_close (gpointer handle, guint magic, ml_single_group_cancel_cb cancel)
+{
+  ml_single_group *group;
+
+  G_LOCK (magic);
+  group = (ml_single_group *) handle;
+  if (G_UNLIKELY (group->magic != magic)) {
+    G_UNLOCK (magic);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The given handle is invalid. It is not the handle of the pool, series or ensemble it is given to, or the user thread has modified it.");
+  }
+  group->magic = 0;
+  g_mutex_lock (&group->lock);
+  G_UNLOCK (magic);
+
+  /* No request is marked in progress after resetting the magic number. */
+  group->closing = TRUE;
+  if (cancel)
+    cancel (group);
+
+  while (group->pending > 0)
+    g_cond_wait (&group->cond, &group->lock);
+  g_mutex_unlock (&group->lock);
+
+  __group_clear (group);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Magic number to verify the pool handle.
+ */
+#define ML_SINGLE_POOL_MAGIC 0xfeedbeef
+
+/**
+ * @brief Max number of the instances of the pool, each of which loads the model and runs its own thread.
+ */
+#define SINGLE_POOL_MAX_INSTANCES 64U
+
+/** Request to be dispatched to an instance of the pool */
+typedef struct
+{
+  ml_tensors_data_h input;            /**< input received from user */
+  ml_tensors_data_h output;           /**< output to be sent back to user */
+  int status;                         /**< status of processing */
+  gboolean done;                      /**< true if the request is completed */
+} ml_single_pool_request;
+
+typedef struct _ml_single_pool ml_single_pool;
+
+/** An instance of the pool, which has its own invoke thread */
+typedef struct
+{
+  ml_single_pool *pool;               /**< the pool which this instance belongs to */
+  ml_single_h single;                 /**< single-shot handle */
+  ml_single_pool_request *current;    /**< the request in progress, NULL if idle */
+  guint64 processed;                  /**< number of requests processed */
+} ml_single_pool_instance;
+
+/** ML single api data structure for the pool handle */
+struct _ml_single_pool
+{
+  ml_single_group group;              /**< single-shot handles of the instances, should be the first member */
+  ml_single_pool_instance *instances; /**< single-shot instances */
+  GQueue pending;                     /**< requests waiting for an idle instance */
+};
+
+static void __pool_invoke_cb (int status, ml_tensors_data_h output,
+    void *user_data);
+
+/**
+ * @brief Internal function to get the idle instance which has processed the fewest requests.
+ * @note This is called with the pool locked.
+ */
+static ml_single_pool_instance *
+__pool_get_idle_instance (ml_single_pool * pool)
+{
+  ml_single_pool_instance *idle = NULL;
+  guint i;
+
+  for (i = 0; i < pool->group.num_singles; i++) {
+    ml_single_pool_instance *inst = &pool->instances[i];
+
+    if (inst->current)
+      continue;
+
+    if (!idle || inst->processed < idle->processed)
+      idle = inst;
   }
 
-  if (out_tensors_info && out_tensors_info->is_extended) {
-    ml_tensors_info_create_extended (&single_h->out_tensors.info);
-    _ml_tensors_set_rank (single_h->output_ranks, ML_TENSOR_RANK_LIMIT);
-  } else {
-    ml_tensors_info_create (&single_h->out_tensors.info);
-    _ml_tensors_set_rank (single_h->output_ranks, ML_TENSOR_RANK_LIMIT_PREV);
-  }
+  return idle;
+}
 
-  __setup_in_out_tensors (single_h);
+/**
+ * @brief Internal function to pass the request to the instance.
+ * @note This is called with the pool locked. The pool is unlocked while invoking the instance,
+ *       because the single-shot handle takes the magic lock, which is never taken with the pool locked.
+ */
+static int
+__pool_dispatch (ml_single_pool_instance * inst,
+    ml_single_pool_request * request)
+{
+  ml_single_pool *pool = inst->pool;
+  int status;
 
-  *single = single_h;
-  return ML_ERROR_NONE;
+  /* The instance is marked busy, no other thread dispatches to it. */
+  inst->current = request;
+  g_mutex_unlock (&pool->group.lock);
+
+  status = ml_single_invoke_async (inst->single, request->input,
+      __pool_invoke_cb, inst);
+
+  g_mutex_lock (&pool->group.lock);
+  if (status != ML_ERROR_NONE)
+    inst->current = NULL;
 
-error:
-  ml_single_close (single_h);
   return status;
 }
 
 /**
- * @brief Opens an ML model and returns the instance as a handle.
+ * @brief Internal function to pass the oldest pending request to the idle instance.
+ * @note This is called with the pool locked.
  */
-int
-ml_single_open (ml_single_h * single, const char *model,
-    const ml_tensors_info_h input_info, const ml_tensors_info_h output_info,
-    ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw)
+static void
+__pool_dispatch_pending (ml_single_pool_instance * inst)
 {
-  return ml_single_open_full (single, model, input_info, output_info, nnfw, hw,
-      NULL);
+  ml_single_pool *pool = inst->pool;
+  ml_single_pool_request *request;
+  int status;
+
+  while (!inst->current && (request = (ml_single_pool_request *)
+          g_queue_pop_head (&pool->pending)) != NULL) {
+    status = __pool_dispatch (inst, request);
+    if (status == ML_ERROR_NONE)
+      break;
+
+    request->status = status;
+    request->done = TRUE;
+    g_cond_broadcast (&pool->group.cond);
+  }
 }
 
 /**
- * @brief Opens an ML model and returns the instance as a handle.
+ * @brief Callback for the result from an instance of the pool.
+ * @details The instance takes the oldest request waiting in the pool, so the faster instance processes more requests.
  */
-int
-ml_single_open_full (ml_single_h * single, const char *model,
-    const ml_tensors_info_h input_info, const ml_tensors_info_h output_info,
-    ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, const char *custom_option)
+static void
+__pool_invoke_cb (int status, ml_tensors_data_h output, void *user_data)
 {
-  ml_single_preset info = { 0, };
+  ml_single_pool_instance *inst = (ml_single_pool_instance *) user_data;
+  ml_single_pool *pool = inst->pool;
+  ml_single_pool_request *request;
 
-  info.input_info = input_info;
-  info.output_info = output_info;
-  info.nnfw = nnfw;
-  info.hw = hw;
-  info.models = (char *) model;
-  info.custom_option = (char *) custom_option;
+  g_mutex_lock (&pool->group.lock);
 
-  return ml_single_open_custom (single, &info);
+  request = inst->current;
+  inst->current = NULL;
+  inst->processed++;
+
+  request->status = status;
+  request->output = output;
+  request->done = TRUE;
+  g_cond_broadcast (&pool->group.cond);
+
+  /* Steal the pending request to keep this instance busy. */
+  __pool_dispatch_pending (inst);
+
+  g_mutex_unlock (&pool->group.lock);
 }
 
 /**
- * @brief Open new single handle with given option.
+ * @brief Opens the pool of single-shot instances with the given ml-option.
  */
 int
-ml_single_open_with_option (ml_single_h * single, const ml_option_h option)
+ml_single_pool_open (ml_single_pool_h * pool, const ml_option_h option,
+    unsigned int n_instances)
 {
-  ml_option_s *_option;
-  GHashTable *table;
-  GHashTableIter iter;
-  gchar *key;
-  ml_option_value_s *_option_value;
-  ml_single_preset info = { 0, };
+  ml_single_pool *pool_h;
+  guint i;
+  int status = ML_ERROR_NONE;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
-  if (!option) {
+  if (!pool)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'option' is NULL. It should be a valid ml_option_h, which should be created by ml_option_create().");
+        "The parameter, pool (ml_single_pool_h *), is NULL. It should be a valid pointer to store the pool handle.");
+  if (!option)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, option (ml_option_h), is NULL. It should be a valid ml_option_h instance, usually created by ml_option_create().");
+
+  if (n_instances > SINGLE_POOL_MAX_INSTANCES)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, n_instances (%u), is too large. It should be less than or equal to %u.",
+        n_instances, SINGLE_POOL_MAX_INSTANCES);
+
+  /* init null */
+  *pool = NULL;
+
+  if (n_instances == 0)
+    n_instances = MIN (g_get_num_processors (), SINGLE_POOL_MAX_INSTANCES);
+
+  pool_h = g_new0 (ml_single_pool, 1);
+  pool_h->instances = g_new0 (ml_single_pool_instance, n_instances);
+  __group_init (&pool_h->group, "pool", n_instances);
+  g_queue_init (&pool_h->pending);
+
+  for (i = 0; i < n_instances; i++) {
+    ml_single_pool_instance *inst = &pool_h->instances[i];
+
+    /* The caller of ml_single_pool_invoke() waits for the result, no need to copy the input. */
+    status = __group_open_single (&pool_h->group, option, TRUE);
+    if (status != ML_ERROR_NONE)
+      goto error;
+
+    inst->pool = pool_h;
+    inst->single = pool_h->group.singles[i];
   }
 
-  if (!single)
+  pool_h->group.magic = ML_SINGLE_POOL_MAGIC;
+  *pool = pool_h;
+  return ML_ERROR_NONE;
+
+error:
+  __group_clear (&pool_h->group);
+  g_free (pool_h->instances);
+  g_free (pool_h);
+  return status;
+}
+
+/**
+ * @brief Invokes the model with the given input data, using an idle instance of the pool.
+ */
+int
+ml_single_pool_invoke (ml_single_pool_h pool, const ml_tensors_data_h input,
+    ml_tensors_data_h * output)
+{
+  ml_single_group *group;
+  ml_single_pool *pool_h;
+  ml_single_pool_instance *inst;
+  ml_single_pool_request request;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!pool)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'single' (ml_single_h), is NULL. It should be a valid ml_single_h instance, usually created by ml_single_open().");
+        "The parameter, pool (ml_single_pool_h), is NULL. It should be a valid instance of ml_single_pool_h, usually created by ml_single_pool_open().");
+  if (!input)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+  if (!output)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, output (ml_tensors_data_h *), is NULL. It should be a valid pointer to an instance of ml_tensors_data_h to store the inference results.");
 
-  _option = (ml_option_s *) option;
-  table = _option->option_table;
+  /* init null */
+  *output = NULL;
 
-  g_hash_table_iter_init (&iter, table);
-  while (g_hash_table_iter_next (&iter, (gpointer *) & key,
-          (gpointer *) & _option_value)) {
-    if (g_ascii_strcasecmp (key, "input_info") == 0) {
-      info.input_info = _option_value->value;
-    } else if (g_ascii_strcasecmp (key, "output_info") == 0) {
-      info.output_info = _option_value->value;
-    } else if (g_ascii_strcasecmp (key, "nnfw") == 0) {
-      info.nnfw = *((ml_nnfw_type_e *) _option_value->value);
-    } else if (g_ascii_strcasecmp (key, "hw") == 0) {
-      info.hw = *((ml_nnfw_hw_e *) _option_value->value);
-    } else if (g_ascii_strcasecmp (key, "models") == 0) {
-      info.models = (gchar *) _option_value->value;
-    } else if (g_ascii_strcasecmp (key, "custom") == 0) {
-      info.custom_option = (gchar *) _option_value->value;
-    } else if (g_ascii_strcasecmp (key, "framework_name") == 0) {
-      info.fw_name = (gchar *) _option_value->value;
-    } else {
-      _ml_logw ("Ignore unknown key for ml_option: %s", key);
+  /* The pool is not released until this request is done. */
+  status = __group_begin (pool, ML_SINGLE_POOL_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  pool_h = (ml_single_pool *) group;
+  g_mutex_lock (&group->lock);
+
+  request.input = input;
+  request.output = NULL;
+  request.status = ML_ERROR_NONE;
+  request.done = FALSE;
+
+  inst = __pool_get_idle_instance (pool_h);
+  if (inst) {
+    status = __pool_dispatch (inst, &request);
+    if (status != ML_ERROR_NONE) {
+      /* The instance is idle again, pass the requests queued in the meantime. */
+      __pool_dispatch_pending (inst);
+      goto exit;
     }
+  } else {
+    /* All instances are busy. The first instance to finish takes this. */
+    g_queue_push_tail (&pool_h->pending, &request);
   }
 
-  return ml_single_open_custom (single, &info);
+  while (!request.done)
+    g_cond_wait (&group->cond, &group->lock);
+
+  status = request.status;
+  if (status == ML_ERROR_NONE)
+    *output = request.output;
+
+exit:
+  g_mutex_unlock (&group->lock);
+  __group_end (group);
+  return status;
 }
 
 /**
- * @brief Closes the opened model handle.
- *
- * @details State changes performed by this function:
- *          ANY STATE -> JOIN REQUESTED - on receiving a request to close
- *
- *          Once requested to close, invoke_thread() will exit after processing
- *          the current input (if any).
+ * @brief Gets the information of required input data for the model of the pool.
  */
 int
-ml_single_close (ml_single_h single)
+ml_single_pool_get_input_info (ml_single_pool_h pool,
+    ml_tensors_info_h * info)
 {
-  ml_single *single_h;
-  gboolean invoking;
+  ml_single_group *group;
+  int status;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
-  if (!single)
+  if (!pool)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'single' (ml_single_h), is NULL. It should be a valid ml_single_h instance, usually created by ml_single_open().");
+        "The parameter, pool (ml_single_pool_h), is NULL. It should be a valid instance of ml_single_pool_h, usually created by ml_single_pool_open().");
 
-  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 1);
+  status = __group_begin (pool, ML_SINGLE_POOL_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-  single_h->state = JOIN_REQUESTED;
-  g_cond_broadcast (&single_h->cond);
-  invoking = single_h->invoking;
-  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  status = ml_single_get_input_info (group->singles[0], info);
 
-  /** Wait until invoke process is finished */
-  while (invoking) {
-    _ml_logd ("Wait 1 ms until invoke is finished and close the handle.");
-    g_usleep (1000);
-    invoking = single_h->invoking;
-    /**
-     * single_h->invoking is the only protected value here and we are
-     * doing a read-only operation and do not need to project its value
-     * after the assignment.
-     * Thus, we do not need to lock single_h here.
-     */
-  }
+  __group_end (group);
+  return status;
+}
 
-  if (single_h->thread != NULL)
-    g_thread_join (single_h->thread);
+/**
+ * @brief Gets the information of output data for the model of the pool.
+ */
+int
+ml_single_pool_get_output_info (ml_single_pool_h pool,
+    ml_tensors_info_h * info)
+{
+  ml_single_group *group;
+  int status;
 
-  /** locking ensures correctness with parallel calls on close */
-  if (single_h->filter) {
-    g_list_foreach (single_h->destroy_data_list, __destroy_notify, single_h);
-    g_list_free (single_h->destroy_data_list);
+  check_feature_state (ML_FEATURE_INFERENCE);
 
-    if (single_h->klass)
-      single_h->klass->stop (single_h->filter);
+  if (!pool)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pool (ml_single_pool_h), is NULL. It should be a valid instance of ml_single_pool_h, usually created by ml_single_pool_open().");
 
-    g_object_unref (single_h->filter);
-    single_h->filter = NULL;
-  }
+  status = __group_begin (pool, ML_SINGLE_POOL_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-  if (single_h->klass) {
-    g_type_class_unref (single_h->klass);
-    single_h->klass = NULL;
+  status = ml_single_get_output_info (group->singles[0], info);
+
+  __group_end (group);
+  return status;
+}
+
+/**
+ * @brief Internal function to cancel the requests of the pool not dispatched yet.
+ * @note This is called with the pool locked, when closing the pool.
+ */
+static void
+__pool_cancel_pending (ml_single_group * group)
+{
+  ml_single_pool *pool_h = (ml_single_pool *) group;
+  ml_single_pool_request *request;
+
+  while ((request = (ml_single_pool_request *)
+          g_queue_pop_head (&pool_h->pending)) != NULL) {
+    request->status = ML_ERROR_STREAMS_PIPE;
+    request->done = TRUE;
   }
+  g_cond_broadcast (&group->cond);
+}
 
-  _ml_tensors_info_free (&single_h->in_info);
-  _ml_tensors_info_free (&single_h->out_info);
+/**
+ * @brief Closes the pool and all the single-shot instances.
+ */
+int
+ml_single_pool_close (ml_single_pool_h pool)
+{
+  ml_single_pool *pool_h = (ml_single_pool *) pool;
+  int status;
 
-  g_cond_clear (&single_h->cond);
-  g_mutex_clear (&single_h->mutex);
+  check_feature_state (ML_FEATURE_INFERENCE);
 
-  g_free (single_h);
+  if (!pool)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pool (ml_single_pool_h), is NULL. It should be a valid instance of ml_single_pool_h, usually created by ml_single_pool_open().");
+
+  status = __group_close (pool, ML_SINGLE_POOL_MAGIC, __pool_cancel_pending);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  g_queue_clear (&pool_h->pending);
+  g_free (pool_h->instances);
+  g_free (pool_h);
   return ML_ERROR_NONE;
 }
 
+#define ML_SINGLE_SERIES_MAGIC 0xfeedf00d
+
+/** ML single api data structure for the series handle */
+typedef struct
+{
+  ml_single_group group;              /**< single-shot handles of the models in order, should be the first member */
+} ml_single_series;
+
+/** Asynchronous request passing through the stages of the series */
+typedef struct
+{
+  ml_single_series *series;           /**< the series which this request belongs to */
+  guint stage;                        /**< index of the stage processing the request */
+  ml_tensors_data_h input;            /**< output of the previous stage lent to the stage, NULL for the first stage */
+  ml_single_invoke_cb cb;             /**< callback to notify the result */
+  void *user_data;                    /**< user data for the callback */
+} ml_single_series_request;
+
 /**
- * @brief Internal function to validate input/output data.
+ * @brief Callback for the result from a stage of the series.
+ * @details The output of the stage is lent to the next stage without copying, and released when the next stage is done.
+ *          Each stage has its own invoke thread, so the stages process the consecutive requests at the same time.
  */
-static int
-_ml_single_invoke_validate_data (ml_single_h single,
-    const ml_tensors_data_h data, const gboolean is_input)
+static void
+__series_invoke_cb (int status, ml_tensors_data_h output, void *user_data)
 {
-  ml_single *single_h;
-  ml_tensors_data_s *_data;
-  ml_tensors_data_s *_model;
-  guint i;
-  size_t raw_size;
+  ml_single_series_request *request = (ml_single_series_request *) user_data;
+  ml_single_group *group = &request->series->group;
 
-  single_h = (ml_single *) single;
-  _data = (ml_tensors_data_s *) data;
+  /* The output of the previous stage is no longer used. */
+  if (request->input)
+    ml_tensors_data_destroy (request->input);
+  request->input = NULL;
 
-  if (G_UNLIKELY (!_data))
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "(internal function) The parameter, 'data' (const ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+  if (status == ML_ERROR_NONE && request->stage + 1 < group->num_singles) {
+    request->stage++;
+    request->input = output;
 
-  if (is_input)
-    _model = &single_h->in_tensors;
-  else
-    _model = &single_h->out_tensors;
+    status = ml_single_invoke_async (group->singles[request->stage], output,
+        __series_invoke_cb, request);
+    if (status == ML_ERROR_NONE)
+      return;
 
-  if (G_UNLIKELY (_data->num_tensors != _model->num_tensors))
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "(internal function) The number of %s tensors is not compatible with model. Given: %u, Expected: %u.",
-        (is_input) ? "input" : "output", _data->num_tensors,
-        _model->num_tensors);
+    _ml_error_report_continue
+        ("Failed to pass the request to the %u-th model of the series. Error code: %d",
+        request->stage, status);
+    ml_tensors_data_destroy (output);
+    request->input = NULL;
+    output = NULL;
+  }
 
-  for (i = 0; i < _data->num_tensors; i++) {
-    if (G_UNLIKELY (!_data->tensors[i].tensor))
-      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-          "The %d-th input tensor is not valid. There is no valid dimension metadata for this tensor.",
-          i);
+  request->cb (status, output, request->user_data);
+
+  g_free (request);
+  __group_end (group);
+}
+
+/**
+ * @brief Internal function to check the tensors of the given information have the same number and size.
+ * @param[in] check_type TRUE to check the type of each tensor as well.
+ */
+static gboolean
+__tensors_info_is_compatible (const ml_tensors_info_h info1,
+    const ml_tensors_info_h info2, gboolean check_type)
+{
+  unsigned int count1, count2;
+  size_t size1, size2;
+  ml_tensor_type_e type1, type2;
+  guint i;
 
-    raw_size = _model->tensors[i].size;
-    if (G_UNLIKELY (_data->tensors[i].size != raw_size))
-      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-          "The size of %d-th %s tensor is not compatible with model. Given: %zu, Expected: %zu (type: %d).",
-          i, (is_input) ? "input" : "output", _data->tensors[i].size, raw_size,
-          single_h->in_info.info[i].type);
+  ml_tensors_info_get_count (info1, &count1);
+  ml_tensors_info_get_count (info2, &count2);
+  if (count1 != count2)
+    return FALSE;
+
+  for (i = 0; i < count1; i++) {
+    ml_tensors_info_get_tensor_size (info1, i, &size1);
+    ml_tensors_info_get_tensor_size (info2, i, &size2);
+    if (size1 != size2)
+      return FALSE;
+
+    if (check_type) {
+      ml_tensors_info_get_tensor_type (info1, i, &type1);
+      ml_tensors_info_get_tensor_type (info2, i, &type2);
+      if (type1 != type2)
+        return FALSE;
+    }
   }
 
-  return ML_ERROR_NONE;
+  return TRUE;
 }
 
 /**
- * @brief Internal function to invoke the model.
- *
- * @details State changes performed by this function:
- *          IDLE -> RUNNING - on receiving a valid request
- *
- *          Invoke returns error if the current state is not IDLE.
- *          If IDLE, then invoke is requested to the thread.
- *          Invoke waits for the processing to be complete, and returns back
- *          the result once notified by the processing thread.
- *
- * @note IDLE is the valid thread state before and after this function call.
+ * @brief Opens the series of the models, of which output is the input of the next model.
  */
-static int
-_ml_single_invoke_internal (ml_single_h single,
-    const ml_tensors_data_h input, ml_tensors_data_h * output,
-    const gboolean need_alloc)
+int
+ml_single_series_open (ml_single_series_h * series,
+    const ml_option_h * options, unsigned int num_models)
 {
-  ml_single *single_h;
-  gint64 end_time;
+  ml_single_series *series_h;
+  ml_tensors_info_h out_info, in_info;
+  guint i;
   int status = ML_ERROR_NONE;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
-  if (G_UNLIKELY (!single))
+  if (!series)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "(internal function) The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, usually created by ml_single_open().");
-
-  if (G_UNLIKELY (!input))
+        "The parameter, series (ml_single_series_h *), is NULL. It should be a valid pointer to store the series handle.");
+  if (!options)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "(internal function) The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
-
-  if (G_UNLIKELY (!output))
+        "The parameter, options (const ml_option_h *), is NULL. It should be a valid array of ml_option_h to open each model.");
+  if (num_models == 0)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "(internal functino) The parameter, output (ml_tensors_data_h *), is NULL. It should be a valid pointer to an instance of ml_tensors_data_h to store the inference results.");
+        "The parameter, num_models, is 0. It should be the positive number of the models in the series.");
 
-  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+  /* init null */
+  *series = NULL;
 
-  if (G_UNLIKELY (!single_h->filter)) {
-    _ml_error_report
-        ("The tensor_filter element of this single handle (single_h) is not valid. It appears that the handle (ml_single_h single) is not appropriately created by ml_single_open(), user thread has touched its internal data, or the handle is already closed or freed by user.");
-    status = ML_ERROR_INVALID_PARAMETER;
-    goto exit;
-  }
+  series_h = g_new0 (ml_single_series, 1);
+  __group_init (&series_h->group, "series", num_models);
 
-  /* Validate input/output data */
-  status = _ml_single_invoke_validate_data (single, input, TRUE);
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue
-        ("The input data for the inference is not valid: error code %d. Please check the dimensions, type, number-of-tensors, and size information of the input data.",
-        status);
-    goto exit;
-  }
+  for (i = 0; i < num_models; i++) {
+    /* The output of the previous model is given to this model without copying. */
+    status = __group_open_single (&series_h->group, options[i], (i > 0));
+    if (status != ML_ERROR_NONE)
+      goto error;
 
-  if (!need_alloc) {
-    status = _ml_single_invoke_validate_data (single, *output, FALSE);
+    if (i == 0)
+      continue;
+
+    status = ml_single_get_output_info (series_h->group.singles[i - 1],
+        &out_info);
+    if (status != ML_ERROR_NONE)
+      goto error;
+
+    status = ml_single_get_input_info (series_h->group.singles[i], &in_info);
     if (status != ML_ERROR_NONE) {
-      _ml_error_report_continue
-          ("The output data buffer provided by the user is not valid for the given neural network mode: error code %d. Please check the dimensions, type, number-of-tensors, and size information of the output data buffer.",
-          status);
-      goto exit;
+      ml_tensors_info_destroy (out_info);
+      goto error;
     }
-  }
 
-  if (single_h->state != IDLE) {
-    if (G_UNLIKELY (single_h->state == JOIN_REQUESTED)) {
+    if (!__tensors_info_is_compatible (out_info, in_info, FALSE))
+      status = ML_ERROR_INVALID_PARAMETER;
+
+    ml_tensors_info_destroy (out_info);
+    ml_tensors_info_destroy (in_info);
+
+    if (status != ML_ERROR_NONE) {
       _ml_error_report
-          ("The handle (single_h single) is closed or being closed awaiting for the last ongoing invocation. Invoking with such a handle is not allowed. Please open another single_h handle to invoke.");
-      status = ML_ERROR_STREAMS_PIPE;
-      goto exit;
+          ("The output of the %u-th model is not compatible with the input of the %u-th model. The number and size of the tensors should be same.",
+          i - 1, i);
+      goto error;
     }
-    _ml_error_report
-        ("The handle (single_h single) is busy. There is another thread waiting for inference results with this handle. Please retry invoking again later when the handle becomes idle after completing the current inference task.");
-    status = ML_ERROR_TRY_AGAIN;
-    goto exit;
   }
 
-  /* prepare output data */
-  if (need_alloc) {
-    *output = NULL;
+  series_h->group.magic = ML_SINGLE_SERIES_MAGIC;
+  *series = series_h;
+  return ML_ERROR_NONE;
 
-    status = _ml_tensors_data_clone_no_alloc (&single_h->out_tensors,
-        &single_h->output);
-    if (status != ML_ERROR_NONE)
-      goto exit;
-  } else {
-    single_h->output = *output;
-  }
+error:
+  __group_clear (&series_h->group);
+  g_free (series_h);
+  return status;
+}
 
-  /**
-   * Clone input data here to prevent use-after-free case.
-   * We should release single_h->input after calling __invoke() function.
-   */
-  status = ml_tensors_data_clone (input, &single_h->input);
-  if (status != ML_ERROR_NONE)
-    goto exit;
+/**
+ * @brief Invokes the models of the series in order with the given input data.
+ */
+int
+ml_single_series_invoke (ml_single_series_h series,
+    const ml_tensors_data_h input, ml_tensors_data_h * output)
+{
+  ml_single_group *group;
+  ml_tensors_data_h in_data, out_data;
+  guint i;
+  int status;
 
-  single_h->state = RUNNING;
-  single_h->free_output = need_alloc;
+  check_feature_state (ML_FEATURE_INFERENCE);
 
-  if (single_h->timeout > 0) {
-    /* Wake up "invoke_thread" */
-    g_cond_broadcast (&single_h->cond);
+  if (!series)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, series (ml_single_series_h), is NULL. It should be a valid instance of ml_single_series_h, usually created by ml_single_series_open().");
+  if (!input)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+  if (!output)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, output (ml_tensors_data_h *), is NULL. It should be a valid pointer to an instance of ml_tensors_data_h to store the inference results.");
 
-    /* set timeout */
-    end_time = g_get_monotonic_time () +
-        single_h->timeout * G_TIME_SPAN_MILLISECOND;
+  /* init null */
+  *output = NULL;
 
-    if (g_cond_wait_until (&single_h->cond, &single_h->mutex, end_time)) {
-      status = single_h->status;
-    } else {
-      _ml_logw ("Wait for invoke has timed out");
-      status = ML_ERROR_TIMED_OUT;
-      /** This is set to notify invoke_thread to not process if timed out */
-      if (need_alloc)
-        set_destroy_notify (single_h, single_h->output, TRUE);
-    }
-  } else {
-    /**
-     * Don't worry. We have locked single_h->mutex, thus there is no
-     * other thread with ml_single_invoke function on the same handle
-     * that are in this if-then-else block, which means that there is
-     * no other thread with active invoke-thread (calling __invoke())
-     * with the same handle. Thus we can call __invoke without
-     * having yet another mutex for __invoke.
-     */
-    single_h->invoking = TRUE;
-    status = __invoke (single_h, single_h->input, single_h->output);
-    ml_tensors_data_destroy (single_h->input);
-    single_h->input = NULL;
-    single_h->invoking = FALSE;
-    single_h->state = IDLE;
+  status = __group_begin (series, ML_SINGLE_SERIES_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  in_data = input;
+  for (i = 0; i < group->num_singles; i++) {
+    status = ml_single_invoke (group->singles[i], in_data, &out_data);
+
+    /* The output of the previous model is lent to this model. */
+    if (i > 0)
+      ml_tensors_data_destroy (in_data);
 
     if (status != ML_ERROR_NONE) {
-      if (need_alloc)
-        ml_tensors_data_destroy (single_h->output);
-      goto exit;
+      _ml_error_report_continue
+          ("Failed to invoke the %u-th model of the series. Error code: %d",
+          i, status);
+      goto done;
     }
 
-    __process_output (single_h, single_h->output);
+    in_data = out_data;
   }
 
-exit:
-  if (status == ML_ERROR_NONE) {
-    if (need_alloc)
-      *output = single_h->output;
-  }
+  *output = in_data;
 
-  single_h->output = NULL;
-  ML_SINGLE_HANDLE_UNLOCK (single_h);
+done:
+  __group_end (group);
   return status;
 }
 
 /**
- * @brief Invokes the model with the given input data.
- */
-int
-ml_single_invoke (ml_single_h single,
-    const ml_tensors_data_h input, ml_tensors_data_h * output)
-{
-  return _ml_single_invoke_internal (single, input, output, TRUE);
-}
-
-/**
- * @brief Invokes the model with the given input data and fills the output data handle.
+ * @brief Requests to invoke the models of the series in order with the given input data, and returns immediately.
  */
 int
-ml_single_invoke_fast (ml_single_h single,
-    const ml_tensors_data_h input, ml_tensors_data_h output)
-{
-  return _ml_single_invoke_internal (single, input, &output, FALSE);
-}
-
-/**
- * @brief Gets the tensors info for the given handle.
- * @param[out] info A pointer to a NULL (unallocated) instance.
- */
-static int
-ml_single_get_tensors_info (ml_single_h single, gboolean is_input,
-    ml_tensors_info_h * info)
+ml_single_series_invoke_async (ml_single_series_h series,
+    const ml_tensors_data_h input, ml_single_invoke_cb cb, void *user_data)
 {
-  ml_single *single_h;
-  int status = ML_ERROR_NONE;
-  ml_tensors_info_s *input_info;
+  ml_single_group *group;
+  ml_single_series_request *request;
+  int status;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
-  if (!single)
+  if (!series)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "(internal function) The parameter, 'single' (ml_single_h), is NULL. It should be a valid ml_single_h instance, usually created by ml_single_open().");
-  if (!info)
+        "The parameter, series (ml_single_series_h), is NULL. It should be a valid instance of ml_single_series_h, usually created by ml_single_series_open().");
+  if (!input)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "(internal function) The parameter, 'info' (ml_tensors_info_h *) is NULL. It should be a valid pointer to an empty (NULL) instance of ml_tensor_info_h, which is supposed to be filled with the fetched info by this function.");
-
-  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
-
-  /* allocate handle for tensors info */
-  status = ml_tensors_info_create (info);
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue
-        ("(internal function) Failed to create an entry for the ml_tensors_info_h instance. Error code: %d",
-        status);
-    goto exit;
-  }
+        "The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+  if (!cb)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, cb (ml_single_invoke_cb), is NULL. It should be a valid function to get the result of the inference.");
 
-  input_info = (ml_tensors_info_s *) (*info);
+  status = __group_begin (series, ML_SINGLE_SERIES_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-  if (is_input)
-    status = ml_tensors_info_clone (input_info, &single_h->in_info);
-  else
-    status = ml_tensors_info_clone (input_info, &single_h->out_info);
+  request = g_new0 (ml_single_series_request, 1);
+  request->series = (ml_single_series *) group;
+  request->cb = cb;
+  request->user_data = user_data;
 
+  /* The first model copies the input, unless its property 'borrow-input' is set. */
+  status = ml_single_invoke_async (group->singles[0], input,
+      __series_invoke_cb, request);
   if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue
-        ("(internal function) Failed to clone fetched input/output metadata to output pointer (ml_tensors_info *info). Error code: %d",
-        status);
-    ml_tensors_info_destroy (input_info);
+    g_free (request);
+    __group_end (group);
   }
 
-exit:
-  ML_SINGLE_HANDLE_UNLOCK (single_h);
   return status;
 }
 
 /**
- * @brief Gets the information of required input data for the given handle.
- * @note information = (tensor dimension, type, name and so on)
+ * @brief Gets the information of required input data for the first model of the series.
  */
 int
-ml_single_get_input_info (ml_single_h single, ml_tensors_info_h * info)
+ml_single_series_get_input_info (ml_single_series_h series,
+    ml_tensors_info_h * info)
 {
-  return ml_single_get_tensors_info (single, TRUE, info);
-}
+  ml_single_group *group;
+  int status;
 
-/**
- * @brief Gets the information of output data for the given handle.
- * @note information = (tensor dimension, type, name and so on)
- */
-int
-ml_single_get_output_info (ml_single_h single, ml_tensors_info_h * info)
-{
-  return ml_single_get_tensors_info (single, FALSE, info);
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!series)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, series (ml_single_series_h), is NULL. It should be a valid instance of ml_single_series_h, usually created by ml_single_series_open().");
+
+  status = __group_begin (series, ML_SINGLE_SERIES_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  status = ml_single_get_input_info (group->singles[0], info);
+
+  __group_end (group);
+  return status;
 }
 
 /**
- * @brief Sets the maximum amount of time to wait for an output, in milliseconds.
+ * @brief Gets the information of output data for the last model of the series.
  */
 int
-ml_single_set_timeout (ml_single_h single, unsigned int timeout)
+ml_single_series_get_output_info (ml_single_series_h series,
+    ml_tensors_info_h * info)
 {
-  ml_single *single_h;
+  ml_single_group *group;
+  int status;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
-  if (!single)
+  if (!series)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+        "The parameter, series (ml_single_series_h), is NULL. It should be a valid instance of ml_single_series_h, usually created by ml_single_series_open().");
 
-  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+  status = __group_begin (series, ML_SINGLE_SERIES_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-  single_h->timeout = (guint) timeout;
+  status = ml_single_get_output_info (group->singles[group->num_singles - 1],
+      info);
 
-  ML_SINGLE_HANDLE_UNLOCK (single_h);
-  return ML_ERROR_NONE;
+  __group_end (group);
+  return status;
 }
 
 /**
- * @brief Sets the information (tensor dimension, type, name and so on) of required input data for the given model.
+ * @brief Closes the series and all the single-shot handles of the models.
  */
 int
-ml_single_set_input_info (ml_single_h single, const ml_tensors_info_h info)
+ml_single_series_close (ml_single_series_h series)
 {
-  ml_single *single_h;
-  int status = ML_ERROR_NONE;
+  int status;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
-  if (!single)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
-  if (!info)
+  if (!series)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, info (const ml_tensors_info_h), is NULL. It should be a valid instance of ml_tensors_info_h, which is usually created by ml_tensors_info_create() or other APIs.");
+        "The parameter, series (ml_single_series_h), is NULL. It should be a valid instance of ml_single_series_h, usually created by ml_single_series_open().");
 
-  if (!ml_tensors_info_is_valid (info))
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, info (const ml_tensors_info_h), is not valid. Although it is not NULL, the content of 'info' is invalid. If it is created by ml_tensors_info_create(), which creates an empty instance, it should be filled by users afterwards. Please check if 'info' has all elements filled with valid values.");
+  /** Wait until the requests in progress pass through all the models */
+  status = __group_close (series, ML_SINGLE_SERIES_MAGIC, NULL);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
-  status = ml_single_set_gst_info (single_h, info);
-  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  g_free (series);
+  return ML_ERROR_NONE;
+}
 
-  if (status != ML_ERROR_NONE)
-    _ml_error_report_continue
-        ("ml_single_set_gst_info() has failed to configure the single_h handle with the given info. Error code: %d",
-        status);
+#define ML_SINGLE_ENSEMBLE_MAGIC 0xfacef00d
+
+/** ML single api data structure for the ensemble handle */
+typedef struct
+{
+  ml_single_group group;              /**< single-shot handles of the models, should be the first member */
+  gboolean reducible;                 /**< true if all the models have the same output (number, type and size of the tensors) */
+} ml_single_ensemble;
+
+/** Invocation of the ensemble waiting for the result from all the models */
+typedef struct
+{
+  ml_single_ensemble *ensemble;       /**< the ensemble which this invocation belongs to */
+  ml_tensors_data_h *outputs;         /**< outputs of the models */
+  guint remaining;                    /**< number of the models not done */
+  int status;                         /**< the first error from the models */
+} ml_single_ensemble_invocation;
+
+/** Slot of the invocation for each model of the ensemble */
+typedef struct
+{
+  ml_single_ensemble_invocation *invocation;  /**< the invocation which this slot belongs to */
+  guint index;                        /**< index of the model */
+} ml_single_ensemble_slot;
 
-  return status;
+/**
+ * @brief Callback for the result from a model of the ensemble.
+ */
+static void
+__ensemble_invoke_cb (int status, ml_tensors_data_h output, void *user_data)
+{
+  ml_single_ensemble_slot *slot = (ml_single_ensemble_slot *) user_data;
+  ml_single_ensemble_invocation *invocation = slot->invocation;
+  ml_single_group *group = &invocation->ensemble->group;
+
+  g_mutex_lock (&group->lock);
+  invocation->outputs[slot->index] = output;
+  if (status != ML_ERROR_NONE && invocation->status == ML_ERROR_NONE)
+    invocation->status = status;
+  invocation->remaining--;
+  g_cond_broadcast (&group->cond);
+  g_mutex_unlock (&group->lock);
 }
 
 /**
- * @brief Invokes the model with the given input data with the given info.
+ * @brief Internal function to invoke all the models of the ensemble at the same time.
+ * @details Each model has its own invoke thread and borrows the input, so the input is shared without copying.
+ *          The latency is close to the one of the slowest model. The outputs are released when any model fails.
  */
-int
-ml_single_invoke_dynamic (ml_single_h single,
-    const ml_tensors_data_h input, const ml_tensors_info_h in_info,
-    ml_tensors_data_h * output, ml_tensors_info_h * out_info)
+static int
+__ensemble_invoke (ml_single_ensemble * ensemble_h,
+    const ml_tensors_data_h input, ml_tensors_data_h * outputs)
 {
+  ml_single_group *group = &ensemble_h->group;
+  ml_single_ensemble_invocation invocation;
+  ml_single_ensemble_slot *slots;
+  guint i;
   int status;
-  ml_tensors_info_h cur_in_info = NULL;
 
-  if (!single)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
-  if (!input)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, input (const ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h with input data frame for inference.");
-  if (!in_info)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, in_info (const ml_tensors_info_h), is NULL. It should be a valid instance of ml_tensor_info_h that describes metadata of the given input for inference (input).");
-  if (!output)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, output (ml_tensors_data_h *), is NULL. It should be a pointer to an empty (NULL or do-not-care) instance of ml_tensors_data_h, which is filled by this API with the result of inference.");
-  if (!out_info)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, out_info (ml_tensors_info_h *), is NULL. It should be a pointer to an empty (NULL or do-not-care) instance of ml_tensors_info_h, which is filled by this API with the neural network model info.");
+  slots = g_try_new0 (ml_single_ensemble_slot, group->num_singles);
+  if (!slots)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory to invoke the %u models of the ensemble. Out of memory?",
+        group->num_singles);
 
-  /* init null */
-  *output = NULL;
-  *out_info = NULL;
+  memset (outputs, 0, sizeof (ml_tensors_data_h) * group->num_singles);
 
-  status = ml_single_get_input_info (single, &cur_in_info);
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue
-        ("Failed to get input metadata configured by the opened single_h handle instance. Error code: %d.",
-        status);
-    goto exit;
-  }
-  status = ml_single_update_info (single, in_info, out_info);
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue
-        ("Failed to reconfigure the opened single_h handle instance with the updated input/output metadata. Error code: %d.",
-        status);
-    goto exit;
-  }
+  invocation.ensemble = ensemble_h;
+  invocation.outputs = outputs;
+  invocation.remaining = group->num_singles;
+  invocation.status = ML_ERROR_NONE;
 
-  status = ml_single_invoke (single, input, output);
-  if (status != ML_ERROR_NONE) {
-    ml_single_set_input_info (single, cur_in_info);
-    if (status != ML_ERROR_TRY_AGAIN) {
-      /* If it's TRY_AGAIN, ml_single_invoke() has already gave enough info. */
+  for (i = 0; i < group->num_singles; i++) {
+    slots[i].invocation = &invocation;
+    slots[i].index = i;
+
+    status = ml_single_invoke_async (group->singles[i], input,
+        __ensemble_invoke_cb, &slots[i]);
+    if (status != ML_ERROR_NONE) {
       _ml_error_report_continue
-          ("Invoking the given neural network has failed. Error code: %d.",
-          status);
+          ("Failed to request to invoke the %u-th model of the ensemble. Error code: %d",
+          i, status);
+
+      g_mutex_lock (&group->lock);
+      if (invocation.status == ML_ERROR_NONE)
+        invocation.status = status;
+      invocation.remaining--;
+      g_mutex_unlock (&group->lock);
     }
   }
 
-exit:
-  if (cur_in_info)
-    ml_tensors_info_destroy (cur_in_info);
+  /** The input is lent to the models, wait for all of them. */
+  g_mutex_lock (&group->lock);
+  while (invocation.remaining > 0)
+    g_cond_wait (&group->cond, &group->lock);
+  status = invocation.status;
+  g_mutex_unlock (&group->lock);
+
+  g_free (slots);
 
   if (status != ML_ERROR_NONE) {
-    if (*out_info) {
-      ml_tensors_info_destroy (*out_info);
-      *out_info = NULL;
+    for (i = 0; i < group->num_singles; i++) {
+      if (outputs[i])
+        ml_tensors_data_destroy (outputs[i]);
+      outputs[i] = NULL;
     }
   }
 
@@ -1739,401 +5831,475 @@ exit:
 }
 
 /**
- * @brief Sets the property value for the given model.
+ * @brief Internal function to get the value of the element as double.
  */
-int
-ml_single_set_property (ml_single_h single, const char *name, const char *value)
+static gdouble
+__tensor_element_get (ml_tensor_type_e type, const void *data, gsize idx)
 {
-  ml_single *single_h;
-  int status = ML_ERROR_NONE;
-  char *old_value = NULL;
-
-  check_feature_state (ML_FEATURE_INFERENCE);
-
-  if (!single)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
-  if (!name)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, name (const char *), is NULL. It should be a valid string representing a property key.");
-
-  /* get old value, also check the property is updatable. */
-  _ml_error_report_return_continue_iferr
-      (ml_single_get_property (single, name, &old_value),
-      "Cannot fetch the previous value for the given property name, '%s'. It appears that the property key, '%s', is invalid (not supported).",
-      name, name);
-
-  /* if sets same value, do not change. */
-  if (old_value && value && g_ascii_strcasecmp (old_value, value) == 0) {
-    g_free (old_value);
-    return ML_ERROR_NONE;
+  switch (type) {
+    case ML_TENSOR_TYPE_INT32:
+      return ((const gint32 *) data)[idx];
+    case ML_TENSOR_TYPE_UINT32:
+      return ((const guint32 *) data)[idx];
+    case ML_TENSOR_TYPE_INT16:
+      return ((const gint16 *) data)[idx];
+    case ML_TENSOR_TYPE_UINT16:
+      return ((const guint16 *) data)[idx];
+    case ML_TENSOR_TYPE_INT8:
+      return ((const gint8 *) data)[idx];
+    case ML_TENSOR_TYPE_UINT8:
+      return ((const guint8 *) data)[idx];
+    case ML_TENSOR_TYPE_FLOAT64:
+      return ((const gdouble *) data)[idx];
+    case ML_TENSOR_TYPE_FLOAT32:
+      return ((const gfloat *) data)[idx];
+    case ML_TENSOR_TYPE_INT64:
+      return (gdouble) ((const gint64 *) data)[idx];
+    case ML_TENSOR_TYPE_UINT64:
+      return (gdouble) ((const guint64 *) data)[idx];
+    default:
+      break;
   }
 
-  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
-
-  /* update property */
-  if (g_str_equal (name, "is-updatable")) {
-    if (!value)
-      goto error;
-    /* boolean */
-    if (g_ascii_strcasecmp (value, "true") == 0) {
-      if (g_ascii_strcasecmp (old_value, "true") != 0)
-        g_object_set (G_OBJECT (single_h->filter), name, (gboolean) TRUE, NULL);
-    } else if (g_ascii_strcasecmp (value, "false") == 0) {
-      if (g_ascii_strcasecmp (old_value, "false") != 0)
-        g_object_set (G_OBJECT (single_h->filter), name, (gboolean) FALSE,
-            NULL);
-    } else {
-      _ml_error_report
-          ("The property value, '%s', is not appropriate for a boolean property 'is-updatable'. It should be either 'true' or 'false'.",
-          value);
-      status = ML_ERROR_INVALID_PARAMETER;
-    }
-  } else if (g_str_equal (name, "input") || g_str_equal (name, "inputtype")
-      || g_str_equal (name, "inputname") || g_str_equal (name, "output")
-      || g_str_equal (name, "outputtype") || g_str_equal (name, "outputname")) {
-    GstTensorsInfo gst_info;
-    gboolean is_input = g_str_has_prefix (name, "input");
-    guint num;
-
-    if (!value)
-      goto error;
-
-    ml_single_get_gst_info (single_h, is_input, &gst_info);
-
-    if (g_str_has_suffix (name, "type"))
-      num = gst_tensors_info_parse_types_string (&gst_info, value);
-    else if (g_str_has_suffix (name, "name"))
-      num = gst_tensors_info_parse_names_string (&gst_info, value);
-    else {
-      guint *rank;
-      gchar **str_dims;
-      guint i;
-
-      if (is_input) {
-        rank = single_h->input_ranks;
-      } else {
-        rank = single_h->output_ranks;
-      }
+  return 0.0;
+}
 
-      str_dims = g_strsplit_set (value, ",.", -1);
-      num = g_strv_length (str_dims);
+/**
+ * @brief Internal function to set the value of the element, rounded to the nearest integer and saturated for the integer types.
+ */
+static void
+__tensor_element_set (ml_tensor_type_e type, void *data, gsize idx,
+    gdouble value)
+{
+  gdouble rounded = (value < 0.0) ? value - 0.5 : value + 0.5;
 
-      if (num > ML_TENSOR_SIZE_LIMIT) {
-        _ml_error_report ("Invalid param, dimensions (%d) max (%d)\n",
-            num, ML_TENSOR_SIZE_LIMIT);
+  switch (type) {
+    case ML_TENSOR_TYPE_INT32:
+      ((gint32 *) data)[idx] = (gint32) CLAMP (rounded, G_MININT32, G_MAXINT32);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      ((guint32 *) data)[idx] = (guint32) CLAMP (rounded, 0, G_MAXUINT32);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      ((gint16 *) data)[idx] = (gint16) CLAMP (rounded, G_MININT16, G_MAXINT16);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      ((guint16 *) data)[idx] = (guint16) CLAMP (rounded, 0, G_MAXUINT16);
+      break;
+    case ML_TENSOR_TYPE_INT8:
+      ((gint8 *) data)[idx] = (gint8) CLAMP (rounded, G_MININT8, G_MAXINT8);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      ((guint8 *) data)[idx] = (guint8) CLAMP (rounded, 0, G_MAXUINT8);
+      break;
+    case ML_TENSOR_TYPE_FLOAT64:
+      ((gdouble *) data)[idx] = value;
+      break;
+    case ML_TENSOR_TYPE_FLOAT32:
+      ((gfloat *) data)[idx] = (gfloat) value;
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      /* (gdouble) G_MAXINT64 is 2^63, which is out of the range of gint64. */
+      ((gint64 *) data)[idx] = (rounded >= (gdouble) G_MAXINT64) ?
+          G_MAXINT64 : (gint64) MAX (rounded, (gdouble) G_MININT64);
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      ((guint64 *) data)[idx] = (rounded >= (gdouble) G_MAXUINT64) ?
+          G_MAXUINT64 : (guint64) MAX (rounded, 0.0);
+      break;
+    default:
+      break;
+  }
+}
 
-        num = ML_TENSOR_SIZE_LIMIT;
+/**
+ * @brief Internal function to reduce the outputs of the models into a single output.
+ * @details AVERAGE: the element-wise mean of the outputs.
+ *          VOTE: each model votes for the element of its maximum value in each innermost row of the tensor (e.g., the class of the highest score for each batch),
+ *          and the output has the number of votes for each element.
+ */
+static int
+__ensemble_reduce (ml_single_ensemble * ensemble_h,
+    ml_single_ensemble_reduce_e reduce, const ml_tensors_data_h * outputs,
+    ml_tensors_data_h result)
+{
+  ml_tensors_data_s *_result = (ml_tensors_data_s *) result;
+  ml_tensors_data_s *_output;
+  ml_tensor_type_e type;
+  ml_tensor_dimension dim;
+  gsize elem_size, num_elem, row_size, row, e, best;
+  gdouble *acc = NULL;
+  guint *votes = NULL;
+  gdouble value, best_value;
+  guint t, m;
+
+  for (t = 0; t < _result->num_tensors; t++) {
+    ml_tensors_info_get_tensor_type (_result->info, t, &type);
+
+    if (type == ML_TENSOR_TYPE_FLOAT16 || type >= ML_TENSOR_TYPE_UNKNOWN)
+      _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+          "The type of the %u-th output tensor is not supported to reduce the outputs of the ensemble.",
+          t);
+
+    elem_size = gst_tensor_get_element_size ((tensor_type) type);
+    num_elem = _result->tensors[t].size / elem_size;
+
+    /* The votes are counted apart from the output, of which type may not hold the number of the models. */
+    if (reduce == ML_SINGLE_ENSEMBLE_REDUCE_AVERAGE)
+      acc = g_try_new0 (gdouble, num_elem);
+    else
+      votes = g_try_new0 (guint, num_elem);
+
+    if (!acc && !votes)
+      _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+          "Failed to allocate memory to reduce the %u-th output tensor of the ensemble. Out of memory?",
+          t);
+
+    /* Each model votes in each innermost row, e.g., for each batch of the scores. */
+    row_size = num_elem;
+    if (ml_tensors_info_get_tensor_dimension (_result->info, t,
+            dim) == ML_ERROR_NONE && dim[0] > 0 && num_elem % dim[0] == 0)
+      row_size = dim[0];
+
+    for (m = 0; m < ensemble_h->group.num_singles; m++) {
+      _output = (ml_tensors_data_s *) outputs[m];
+
+      if (reduce == ML_SINGLE_ENSEMBLE_REDUCE_AVERAGE) {
+        for (e = 0; e < num_elem; e++)
+          acc[e] += __tensor_element_get (type, _output->tensors[t].tensor, e);
+        continue;
       }
 
-      for (i = 0; i < num; ++i) {
-        rank[i] = gst_tensor_parse_dimension (str_dims[i],
-            gst_info.info[i].dimension);
+      for (row = 0; row < num_elem; row += row_size) {
+        best = row;
+        best_value =
+            __tensor_element_get (type, _output->tensors[t].tensor, row);
+        for (e = row + 1; e < row + row_size; e++) {
+          value = __tensor_element_get (type, _output->tensors[t].tensor, e);
+          if (value > best_value) {
+            best = e;
+            best_value = value;
+          }
+        }
+        votes[best]++;
       }
-      g_strfreev (str_dims);
     }
 
-    if (num == gst_info.num_tensors) {
-      ml_tensors_info_h ml_info;
-
-      _ml_tensors_info_create_from_gst (&ml_info, &gst_info);
-
-      /* change configuration */
-      status = ml_single_set_gst_info (single_h, ml_info);
-
-      ml_tensors_info_destroy (ml_info);
-    } else {
-      _ml_error_report
-          ("The property value, '%s', is not appropriate for the given property key, '%s'. The API has failed to parse the given property value.",
-          value, name);
-      status = ML_ERROR_INVALID_PARAMETER;
+    for (e = 0; e < num_elem; e++) {
+      if (reduce == ML_SINGLE_ENSEMBLE_REDUCE_AVERAGE)
+        value = acc[e] / ensemble_h->group.num_singles;
+      else
+        value = (gdouble) votes[e];
+      __tensor_element_set (type, _result->tensors[t].tensor, e, value);
     }
 
-    gst_tensors_info_free (&gst_info);
-  } else {
-    g_object_set (G_OBJECT (single_h->filter), name, value, NULL);
+    g_free (acc);
+    g_free (votes);
+    acc = NULL;
+    votes = NULL;
   }
-  goto done;
-error:
-  _ml_error_report
-      ("The parameter, value (const char *), is NULL. It should be a valid string representing the value to be set for the given property key, '%s'",
-      name);
-  status = ML_ERROR_INVALID_PARAMETER;
-done:
-  ML_SINGLE_HANDLE_UNLOCK (single_h);
 
-  g_free (old_value);
-  return status;
+  return ML_ERROR_NONE;
 }
 
 /**
- * @brief Gets the property value for the given model.
+ * @brief Opens the ensemble of the models, which are invoked at the same time with the same input.
  */
 int
-ml_single_get_property (ml_single_h single, const char *name, char **value)
+ml_single_ensemble_open (ml_single_ensemble_h * ensemble,
+    const ml_option_h * options, unsigned int num_models)
 {
-  ml_single *single_h;
+  ml_single_ensemble *ensemble_h;
+  ml_single_h *members;
+  ml_tensors_info_h first_info, info;
+  gboolean compatible;
+  guint i;
   int status = ML_ERROR_NONE;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
-  if (!single)
+  if (!ensemble)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
-  if (!name)
+        "The parameter, ensemble (ml_single_ensemble_h *), is NULL. It should be a valid pointer to store the ensemble handle.");
+  if (!options)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, name (const char *), is NULL. It should be a valid string representing a property key.");
-  if (!value)
+        "The parameter, options (const ml_option_h *), is NULL. It should be a valid array of ml_option_h to open each model.");
+  if (num_models == 0)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, value (const char *), is NULL. It should be a valid string representing the value to be set for the given property key, '%s'",
-        name);
+        "The parameter, num_models, is 0. It should be the positive number of the models in the ensemble.");
 
   /* init null */
-  *value = NULL;
+  *ensemble = NULL;
 
-  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+  ensemble_h = g_new0 (ml_single_ensemble, 1);
+  __group_init (&ensemble_h->group, "ensemble", num_models);
+  members = ensemble_h->group.singles;
+  ensemble_h->reducible = TRUE;
 
-  if (g_str_equal (name, "inputtype") || g_str_equal (name, "inputname") ||
-      g_str_equal (name, "inputlayout") || g_str_equal (name, "outputtype") ||
-      g_str_equal (name, "outputname") || g_str_equal (name, "outputlayout") ||
-      g_str_equal (name, "accelerator") || g_str_equal (name, "custom")) {
-    /* string */
-    g_object_get (G_OBJECT (single_h->filter), name, value, NULL);
-  } else if (g_str_equal (name, "is-updatable")) {
-    gboolean bool_value = FALSE;
+  for (i = 0; i < num_models; i++) {
+    /* All the models share the input without copying. */
+    status = __group_open_single (&ensemble_h->group, options[i], TRUE);
+    if (status != ML_ERROR_NONE)
+      goto error;
 
-    /* boolean */
-    g_object_get (G_OBJECT (single_h->filter), name, &bool_value, NULL);
-    *value = (bool_value) ? g_strdup ("true") : g_strdup ("false");
-  } else if (g_str_equal (name, "input") || g_str_equal (name, "output")) {
-    gchar *dim_str = NULL;
-    const guint *rank;
-    gboolean is_input = g_str_has_prefix (name, "input");
-    GstTensorsInfo gst_info;
+    if (i == 0)
+      continue;
 
-    if (is_input) {
-      rank = single_h->input_ranks;
-    } else {
-      rank = single_h->output_ranks;
-    }
+    status = ml_single_get_input_info (members[0], &first_info);
+    if (status != ML_ERROR_NONE)
+      goto error;
 
-    ml_single_get_gst_info (single_h, is_input, &gst_info);
+    status = ml_single_get_input_info (members[i], &info);
+    if (status != ML_ERROR_NONE) {
+      ml_tensors_info_destroy (first_info);
+      goto error;
+    }
 
-    if (gst_info.num_tensors > 0) {
-      guint i;
-      GString *dimensions = g_string_new (NULL);
+    compatible = __tensors_info_is_compatible (first_info, info, TRUE);
+    ml_tensors_info_destroy (first_info);
+    ml_tensors_info_destroy (info);
 
-      for (i = 0; i < gst_info.num_tensors; ++i) {
-        dim_str =
-            gst_tensor_get_rank_dimension_string (gst_info.info[i].dimension,
-            *(rank + i));
-        g_string_append (dimensions, dim_str);
+    if (!compatible) {
+      _ml_error_report
+          ("The input of the %u-th model is not compatible with the input of the first model. The number, type and size of the tensors should be same.",
+          i);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto error;
+    }
 
-        if (i < gst_info.num_tensors - 1) {
-          g_string_append (dimensions, ",");
-        }
-        g_free (dim_str);
+    /* The outputs can be reduced only if all the models have the same output. */
+    if (ensemble_h->reducible) {
+      status = ml_single_get_output_info (members[0], &first_info);
+      if (status != ML_ERROR_NONE)
+        goto error;
+
+      status = ml_single_get_output_info (members[i], &info);
+      if (status != ML_ERROR_NONE) {
+        ml_tensors_info_destroy (first_info);
+        goto error;
       }
-      dim_str = g_string_free (dimensions, FALSE);
-    } else {
-      dim_str = g_strdup ("");
+
+      ensemble_h->reducible =
+          __tensors_info_is_compatible (first_info, info, TRUE);
+      ml_tensors_info_destroy (first_info);
+      ml_tensors_info_destroy (info);
     }
-    *value = dim_str;
-  } else {
-    _ml_error_report
-        ("The property key, '%s', is not available for get_property and not recognized by the API. It should be one of {input, inputtype, inputname, inputlayout, output, outputtype, outputname, outputlayout, accelerator, custom, is-updatable}.",
-        name);
-    status = ML_ERROR_NOT_SUPPORTED;
   }
 
-  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  ensemble_h->group.magic = ML_SINGLE_ENSEMBLE_MAGIC;
+  *ensemble = ensemble_h;
+  return ML_ERROR_NONE;
+
+error:
+  __group_clear (&ensemble_h->group);
+  g_free (ensemble_h);
   return status;
 }
 
 /**
- * @brief Internal helper function to validate model files.
+ * @brief Invokes all the models of the ensemble at the same time with the given input data.
  */
-static int
-__ml_validate_model_file (const char *const *model,
-    const unsigned int num_models, gboolean * is_dir)
+int
+ml_single_ensemble_invoke (ml_single_ensemble_h ensemble,
+    const ml_tensors_data_h input, ml_tensors_data_h * outputs)
 {
-  guint i;
+  ml_single_group *group;
+  int status;
 
-  if (!model)
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!ensemble)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, model, is NULL. It should be a valid array of strings, where each string is a valid file path for a neural network model file.");
-  if (num_models < 1)
+        "The parameter, ensemble (ml_single_ensemble_h), is NULL. It should be a valid instance of ml_single_ensemble_h, usually created by ml_single_ensemble_open().");
+  if (!input)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, num_models, is 0. It should be the number of files for the given neural network model.");
-
-  if (g_file_test (model[0], G_FILE_TEST_IS_DIR)) {
-    *is_dir = TRUE;
-    return ML_ERROR_NONE;
-  }
+        "The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+  if (!outputs)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, outputs (ml_tensors_data_h *), is NULL. It should be a valid array of ml_tensors_data_h, of which length is the number of the models, to store the inference results.");
 
-  for (i = 0; i < num_models; i++) {
-    if (!model[i] || !g_file_test (model[i], G_FILE_TEST_IS_REGULAR)) {
-      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-          "The given param, model path [%d] = \"%s\" is invalid or the file is not found or accessible.",
-          i, _STR_NULL (model[i]));
-    }
-  }
+  status = __group_begin (ensemble, ML_SINGLE_ENSEMBLE_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-  *is_dir = FALSE;
+  status = __ensemble_invoke ((ml_single_ensemble *) group, input, outputs);
 
-  return ML_ERROR_NONE;
+  __group_end (group);
+  return status;
 }
 
 /**
- * @brief Validates the nnfw model file.
- * @since_tizen 5.5
- * @param[in] model The path of model file.
- * @param[in/out] nnfw The type of NNFW.
- * @return @c 0 on success. Otherwise a negative error value.
- * @retval #ML_ERROR_NONE Successful
- * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or framework to support this model file is unavailable in the environment.
- * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @brief Invokes all the models of the ensemble at the same time with the given input data, and reduces the outputs into a single output.
  */
 int
-_ml_validate_model_file (const char *const *model,
-    const unsigned int num_models, ml_nnfw_type_e * nnfw)
+ml_single_ensemble_invoke_reduce (ml_single_ensemble_h ensemble,
+    const ml_tensors_data_h input, ml_single_ensemble_reduce_e reduce,
+    ml_tensors_data_h * output)
 {
-  int status = ML_ERROR_NONE;
-  ml_nnfw_type_e detected = ML_NNFW_TYPE_ANY;
-  gboolean is_dir = FALSE;
-  gchar *pos, *fw_name;
-  gchar **file_ext = NULL;
+  ml_single_group *group;
+  ml_single_ensemble *ensemble_h;
+  ml_tensors_data_h *outputs = NULL;
+  ml_tensors_data_h result = NULL;
+  ml_tensors_info_h info;
   guint i;
+  int status;
 
-  if (!nnfw)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, nnfw, is NULL. It should be a valid pointer of ml_nnfw_type_e.");
+  check_feature_state (ML_FEATURE_INFERENCE);
 
-  _ml_error_report_return_continue_iferr (__ml_validate_model_file (model,
-          num_models, &is_dir),
-      "The parameters, model and num_models, are not valid.");
+  if (!ensemble)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, ensemble (ml_single_ensemble_h), is NULL. It should be a valid instance of ml_single_ensemble_h, usually created by ml_single_ensemble_open().");
+  if (!input)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+  if (reduce != ML_SINGLE_ENSEMBLE_REDUCE_AVERAGE &&
+      reduce != ML_SINGLE_ENSEMBLE_REDUCE_VOTE)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, reduce (ml_single_ensemble_reduce_e), is invalid. It should be one of ML_SINGLE_ENSEMBLE_REDUCE_AVERAGE and ML_SINGLE_ENSEMBLE_REDUCE_VOTE.");
+  if (!output)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, output (ml_tensors_data_h *), is NULL. It should be a valid pointer to an instance of ml_tensors_data_h to store the reduced result.");
 
-  /**
-   * @note detect-fw checks the file ext and returns proper fw name for given models.
-   * If detected fw and given nnfw are same, we don't need to check the file extension.
-   * If any condition for auto detection is added later, below code also should be updated.
-   */
-  fw_name = gst_tensor_filter_detect_framework (model, num_models, TRUE);
-  detected = _ml_get_nnfw_type_by_subplugin_name (fw_name);
-  g_free (fw_name);
+  /* init null */
+  *output = NULL;
 
-  if (*nnfw == ML_NNFW_TYPE_ANY) {
-    if (detected == ML_NNFW_TYPE_ANY) {
-      _ml_error_report
-          ("The given neural network model (1st path is \"%s\", and there are %d paths declared) has unknown or unsupported extension. Please check its corresponding neural network framework and try to specify it instead of \"ML_NNFW_TYPE_ANY\".",
-          model[0], num_models);
-      status = ML_ERROR_INVALID_PARAMETER;
-    } else {
-      _ml_logi ("The given model is supposed a %s model.",
-          _ml_get_nnfw_subplugin_name (detected));
-      *nnfw = detected;
-    }
+  status = __group_begin (ensemble, ML_SINGLE_ENSEMBLE_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
 
-    goto done;
-  } else if (is_dir && *nnfw != ML_NNFW_TYPE_NNFW) {
-    /* supposed it is ONE if given model is directory */
+  ensemble_h = (ml_single_ensemble *) group;
+  if (!ensemble_h->reducible) {
     _ml_error_report
-        ("The given model (1st path is \"%s\", and there are %d paths declared) is directory, which is allowed by \"NNFW (One Runtime)\" only, Please check the model and framework.",
-        model[0], num_models);
-    status = ML_ERROR_INVALID_PARAMETER;
+        ("The outputs of the ensemble cannot be reduced. All the models should have the same number, type and size of the output tensors.");
+    status = ML_ERROR_NOT_SUPPORTED;
     goto done;
-  } else if (detected == *nnfw) {
-    /* Expected framework, nothing to do. */
+  }
+
+  outputs = g_try_new0 (ml_tensors_data_h, group->num_singles);
+  if (!outputs) {
+    _ml_error_report
+        ("Failed to allocate memory for the outputs of the %u models of the ensemble. Out of memory?",
+        group->num_singles);
+    status = ML_ERROR_OUT_OF_MEMORY;
     goto done;
   }
 
-  /* Handle mismatched case, check file extension. */
-  file_ext = g_malloc0 (sizeof (char *) * (num_models + 1));
-  for (i = 0; i < num_models; i++) {
-    if ((pos = strrchr (model[i], '.')) == NULL) {
-      _ml_error_report ("The given model [%d]=\"%s\" has invalid extension.", i,
-          model[i]);
-      status = ML_ERROR_INVALID_PARAMETER;
-      goto done;
-    }
+  status = __ensemble_invoke (ensemble_h, input, outputs);
+  if (status != ML_ERROR_NONE)
+    goto done;
 
-    file_ext[i] = g_ascii_strdown (pos, -1);
+  status = ml_single_get_output_info (group->singles[0], &info);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  status = ml_tensors_data_create (info, &result);
+  ml_tensors_info_destroy (info);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to create the output to reduce the outputs of the ensemble. Error code: %d",
+        status);
+    goto done;
   }
 
-  /** @todo Make sure num_models is correct for each nnfw type */
-  switch (*nnfw) {
-    case ML_NNFW_TYPE_NNFW:
-    case ML_NNFW_TYPE_TVM:
-      /**
-       * We cannot check the file ext with NNFW.
-       * NNFW itself will validate metadata and model file.
-       */
-      break;
-    case ML_NNFW_TYPE_MVNC:
-    case ML_NNFW_TYPE_OPENVINO:
-    case ML_NNFW_TYPE_EDGE_TPU:
-      /**
-       * @todo Need to check method to validate model
-       * Although nnstreamer supports these frameworks,
-       * ML-API implementation is not ready.
-       */
-      _ml_error_report
-          ("Given NNFW is not supported by ML-API Inference.Single, yet, although it is supported by NNStreamer. If you have such NNFW integrated into your machine and want to access via ML-API, please update the corresponding implementation or report and discuss at github.com/nnstreamer/nnstreamer/issues.");
-      status = ML_ERROR_NOT_SUPPORTED;
-      break;
-    case ML_NNFW_TYPE_VD_AIFW:
-      if (!g_str_equal (file_ext[0], ".nb") &&
-          !g_str_equal (file_ext[0], ".ncp") &&
-          !g_str_equal (file_ext[0], ".tvn") &&
-          !g_str_equal (file_ext[0], ".bin")) {
-        status = ML_ERROR_INVALID_PARAMETER;
-      }
-      break;
-    case ML_NNFW_TYPE_SNAP:
-#if !defined (__ANDROID__)
-      _ml_error_report ("SNAP is supported by Android/arm64-v8a devices only.");
-      status = ML_ERROR_NOT_SUPPORTED;
-#endif
-      /* SNAP requires multiple files, set supported if model file exists. */
-      break;
-    case ML_NNFW_TYPE_ARMNN:
-      if (!g_str_equal (file_ext[0], ".caffemodel") &&
-          !g_str_equal (file_ext[0], ".tflite") &&
-          !g_str_equal (file_ext[0], ".pb") &&
-          !g_str_equal (file_ext[0], ".prototxt")) {
-        _ml_error_report
-            ("ARMNN accepts .caffemodel, .tflite, .pb, and .prototxt files only. Please support correct file extension. You have specified: \"%s\"",
-            file_ext[0]);
-        status = ML_ERROR_INVALID_PARAMETER;
-      }
-      break;
-    case ML_NNFW_TYPE_MXNET:
-      if (!g_str_equal (file_ext[0], ".params") &&
-          !g_str_equal (file_ext[0], ".json")) {
-        status = ML_ERROR_INVALID_PARAMETER;
-      }
-      break;
-    default:
-      _ml_error_report
-          ("You have designated an incorrect neural network framework (out of bound).");
-      status = ML_ERROR_INVALID_PARAMETER;
-      break;
+  status = __ensemble_reduce (ensemble_h, reduce, outputs, result);
+  if (status != ML_ERROR_NONE) {
+    ml_tensors_data_destroy (result);
+    goto done;
   }
 
+  *output = result;
+
 done:
-  if (status == ML_ERROR_NONE) {
-    if (!_ml_nnfw_is_available (*nnfw, ML_NNFW_HW_ANY)) {
-      status = ML_ERROR_NOT_SUPPORTED;
-      _ml_error_report
-          ("The subplugin for tensor-filter \"%s\" is not available. Please install the corresponding tensor-filter subplugin file (usually, \"libnnstreamer_filter_${NAME}.so\") at the correct path. Please use \"nnstreamer-check\" utility to check related configurations. If you do not have the utility ready, build and install \"confchk\", which is located at ${nnstreamer_source}/tools/development/confchk/ .",
-          _ml_get_nnfw_subplugin_name (*nnfw));
+  if (outputs) {
+    for (i = 0; i < group->num_singles; i++) {
+      if (outputs[i])
+        ml_tensors_data_destroy (outputs[i]);
     }
+    g_free (outputs);
+  }
+
+  __group_end (group);
+  return status;
+}
+
+/**
+ * @brief Gets the information of required input data for the models of the ensemble.
+ */
+int
+ml_single_ensemble_get_input_info (ml_single_ensemble_h ensemble,
+    ml_tensors_info_h * info)
+{
+  ml_single_group *group;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!ensemble)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, ensemble (ml_single_ensemble_h), is NULL. It should be a valid instance of ml_single_ensemble_h, usually created by ml_single_ensemble_open().");
+
+  status = __group_begin (ensemble, ML_SINGLE_ENSEMBLE_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  status = ml_single_get_input_info (group->singles[0], info);
+
+  __group_end (group);
+  return status;
+}
+
+/**
+ * @brief Gets the information of output data for the given model of the ensemble.
+ */
+int
+ml_single_ensemble_get_output_info (ml_single_ensemble_h ensemble,
+    unsigned int index, ml_tensors_info_h * info)
+{
+  ml_single_group *group;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!ensemble)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, ensemble (ml_single_ensemble_h), is NULL. It should be a valid instance of ml_single_ensemble_h, usually created by ml_single_ensemble_open().");
+
+  status = __group_begin (ensemble, ML_SINGLE_ENSEMBLE_MAGIC, &group);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  if (index < group->num_singles) {
+    status = ml_single_get_output_info (group->singles[index], info);
   } else {
     _ml_error_report
-        ("The given model file, \"%s\" (1st of %d files), is invalid.",
-        model[0], num_models);
+        ("The parameter, index (%u), is out of range. It should be less than the number of the models in the ensemble (%u).",
+        index, group->num_singles);
+    status = ML_ERROR_INVALID_PARAMETER;
   }
 
-  g_strfreev (file_ext);
+  __group_end (group);
   return status;
 }
+
+/**
+ * @brief Closes the ensemble and all the single-shot handles of the models.
+ */
+int
+ml_single_ensemble_close (ml_single_ensemble_h ensemble)
+{
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!ensemble)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, ensemble (ml_single_ensemble_h), is NULL. It should be a valid instance of ml_single_ensemble_h, usually created by ml_single_ensemble_open().");
+
+  /** Wait until the requests in progress are done by all the models */
+  status = __group_close (ensemble, ML_SINGLE_ENSEMBLE_MAGIC, NULL);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  g_free (ensemble);
+  return ML_ERROR_NONE;
+}
@@ -135,6 +135,17 @@ typedef enum {
  */
 #define ML_TENSOR_RANK_LIMIT_PREV  (4)
 
+/**
+ * @brief Data structure for the affine quantization parameters of a tensor, real = (quantized - zero_point) * scale.
+ * @details The scales and zero points are allocated in the same block with the structure.
+ */
+typedef struct {
+  unsigned int axis;         /**< The index of the dimension for the per-channel parameters. */
+  unsigned int num_channels; /**< The number of the parameters, 1 for the per-tensor parameters. */
+  float *scales;             /**< The scales of the channels. */
+  int32_t *zero_points;      /**< The zero points of the channels. */
+} ml_tensor_quant_s;
+
 /**
  * @brief Data structure for tensor information.
  * @since_tizen 5.5
@@ -143,6 +154,7 @@ typedef struct {
   char *name;              /**< Name of each element in the tensor. */
   ml_tensor_type_e type;   /**< Type of each element in the tensor. */
   ml_tensor_dimension dimension;     /**< Dimension information. */
+  ml_tensor_quant_s *quant; /**< The quantization parameters, NULL if the tensor is not quantized. */
 } ml_tensor_info_s;
 
 /**
@@ -155,6 +167,9 @@ typedef struct {
   GMutex lock; /**< Lock for thread safety */
   int nolock; /**< Set non-zero to avoid using m (giving up thread safety) */
   bool is_extended; /**< True if tensors are extended */
+  int ref_count; /**< The number of references of the frozen information shared by the handles, 0 if it is not frozen */
+  unsigned int alloc_policy; /**< The policy to allocate the buffers of tensors data (ml_tensors_alloc_policy_e), 0 to follow the default policy */
+  GThread *owner; /**< The thread owning the single-owner handle, NULL if the handle is shared by the threads */
 } ml_tensors_info_s;
 
 /**
@@ -176,25 +191,48 @@ typedef struct
   GHashTable *option_table; /**< hash table used by ml_option. */
 } ml_option_s;
 
+#if defined (__THREAD_CONFINED_CHECK__)
+/**
+ * @brief Macro to abort if the single-owner handle is accessed out of the owner thread.
+ * @param sname The name of struct (ml_tensors_info_s or ml_tensors_data_s)
+ */
+#define G_CHECK_OWNER_THREAD(sname) \
+  do { \
+    GThread *o = (sname).owner; \
+    if (o && o != g_thread_self ()) \
+      g_error ("The single-owner handle %s of the thread %p is accessed in the thread %p.", \
+          #sname, (void *) o, (void *) g_thread_self ()); \
+  } while (0)
+#else
+#define G_CHECK_OWNER_THREAD(sname) do { } while (0)
+#endif /* __THREAD_CONFINED_CHECK__ */
+
 /**
  * @brief Macro to control private lock with nolock condition (lock)
+ * @details The condition is read once, because the handle may be bound to its owner thread while waiting for the lock.
+ *          Give the same variable to G_UNLOCK_UNLESS_NOLOCK() to unlock the handle.
  * @param sname The name of struct (ml_tensors_info_s or ml_tensors_data_s)
+ * @param cond The local variable (int) to keep the nolock condition until unlocked
  */
-#define G_LOCK_UNLESS_NOLOCK(sname) \
+#define G_LOCK_UNLESS_NOLOCK(sname,cond) \
   do { \
     GMutex *l = (GMutex *) &(sname).lock; \
-    if (!(sname).nolock) \
+    cond = g_atomic_int_get (&(sname).nolock); \
+    if (!cond) \
       g_mutex_lock (l); \
+    else \
+      G_CHECK_OWNER_THREAD (sname); \
   } while (0)
 
 /**
  * @brief Macro to control private lock with nolock condition (unlock)
  * @param sname The name of struct (ml_tensors_info_s or ml_tensors_data_s)
+ * @param cond The nolock condition read by G_LOCK_UNLESS_NOLOCK()
  */
-#define G_UNLOCK_UNLESS_NOLOCK(sname) \
+#define G_UNLOCK_UNLESS_NOLOCK(sname,cond) \
   do { \
     GMutex *l = (GMutex *) &(sname).lock; \
-    if (!(sname).nolock) \
+    if (!cond) \
       g_mutex_unlock (l); \
   } while (0)
 
@@ -257,6 +295,7 @@ typedef struct {
   ml_handle_destroy_cb destroy; /**< The function to be called to release the allocated buffer */
   GMutex lock; /**< Lock for thread safety */
   int nolock; /**< Set non-zero to avoid using m (giving up thread safety) */
+  GThread *owner; /**< The thread owning the single-owner handle, NULL if the handle is shared by the threads */
 } ml_tensors_data_s;
 
 /**
@@ -275,6 +314,25 @@ size_t _ml_tensor_info_get_size (const ml_tensor_info_s *info, bool is_extended)
  */
 int _ml_tensors_info_initialize (ml_tensors_info_s *info);
 
+/**
+ * @brief Freezes the tensors information to share it without copying.
+ * @details The frozen information cannot be updated and is not locked. It has a reference, and is released when ml_tensors_info_destroy() drops the last reference.
+ * @param[in] info The tensors info handle owned by the caller.
+ */
+void _ml_tensors_info_freeze (ml_tensors_info_h info);
+
+/**
+ * @brief Gets the frozen tensors information sharing the given information.
+ * @details If @a info is frozen, this adds a reference of it. Otherwise, this creates a frozen copy of it.
+ * @param[in] info The tensors info handle to be shared.
+ * @param[out] shared The frozen tensors info handle. The caller should release it with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int _ml_tensors_info_share (const ml_tensors_info_h info, ml_tensors_info_h *shared);
+
 /**
  * @brief Frees and initialize the data in tensors info.
  * @since_tizen 5.5
@@ -352,6 +410,57 @@ int _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_dat
  */
 int _ml_tensors_data_create_no_alloc (const ml_tensors_info_h info, ml_tensors_data_h *data);
 
+/**
+ * @brief Allocates a buffer of tensor data with the allocation policy of the given tensors information.
+ * @details The buffer should be released with g_free().
+ * @param[in] info The tensors information of the data. NULL to apply the default policy.
+ * @param[in] size The byte size of the buffer.
+ * @param[in] zero_fill FALSE if the caller overwrites the whole buffer, which is not filled with zero regardless of the policy.
+ * @return The allocated buffer, or NULL if failed to allocate.
+ */
+void * _ml_tensors_data_alloc_buffer (const ml_tensors_info_h info, size_t size, gboolean zero_fill);
+
+/**
+ * @brief Gets the single buffer of all the tensors if the data is allocated with the contiguous layout (ML_TENSORS_ALLOC_CONTIGUOUS).
+ * @note This is not thread safe. The caller should lock the data.
+ * @param[in] data The tensors data.
+ * @param[out] block The single buffer of all the tensors.
+ * @param[out] block_size The byte size of the buffer.
+ * @return TRUE if the data is allocated with the contiguous layout.
+ */
+gboolean _ml_tensors_data_get_block (const ml_tensors_data_s *data, void **block, size_t *block_size);
+
+/**
+ * @brief Selects the instruction set of the kernels to convert the tensors data, for the tests and benchmarks.
+ * @param[in] isa The name of the instruction set ("scalar", "sse2", "avx2" or "neon"). NULL to select the best one for the CPU.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED The instruction set is not supported in this build or CPU.
+ */
+int _ml_tensors_convert_set_isa (const char *isa);
+
+/**
+ * @brief Gets the name of the instruction set of the kernels to convert the tensors data.
+ */
+const char * _ml_tensors_convert_get_isa (void);
+
+/**
+ * @brief The counters of the handles of tensors data and information.
+ * @details The destroyed handles are cached and reused for the next allocation without initializing the lock again.
+ */
+typedef struct {
+  unsigned int data_allocated; /**< The number of tensors data handles allocated from the heap. */
+  unsigned int data_reused; /**< The number of tensors data handles reused from the cache. */
+  unsigned int info_allocated; /**< The number of tensors info handles allocated from the heap. */
+  unsigned int info_reused; /**< The number of tensors info handles reused from the cache. */
+} ml_tensors_cache_stats_s;
+
+/**
+ * @brief Gets the counters of the handles of tensors data and information allocated from the heap and reused from the cache.
+ * @param[out] stats The counters since the library is loaded.
+ */
+void _ml_tensors_cache_get_stats (ml_tensors_cache_stats_s *stats);
+
 #if defined (__TIZEN__)
 /****** TIZEN CHECK FEATURE BEGINS *****/
 /**
@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 #include <glib.h>
 #include <glib/gstdio.h> /* GStatBuf */
+#include <unistd.h>
 #include <nnstreamer.h>
 #include <nnstreamer_plugin_api.h>
 #include <nnstreamer_internal.h>
@@ -1152,6 +1153,91 @@ TEST (nnstreamer_capi_src, dummy_01)
   g_free (file1);
 }
 
+/**
+ * @brief Test NNStreamer pipeline src
+ * @detail Push the data of which tensors are in a single buffer (contiguous layout).
+ */
+TEST (nnstreamer_capi_src, contiguous_data)
+{
+  const gchar *_tmpdir = g_get_tmp_dir ();
+  const gchar *_dirname = "nns-tizen-XXXXXX";
+  gchar *fullpath = g_build_path ("/", _tmpdir, _dirname, NULL);
+  gchar *dir = g_mkdtemp ((gchar *)fullpath);
+  gchar *file1 = g_build_path ("/", dir, "output", NULL);
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensors,num_tensors=(int)2,dimensions=(string)3:1:1:1.5:1:1:1,types=(string)uint8.uint8,framerate=(fraction)0/1 ! filesink location=\"%s\" buffer-mode=unbuffered",
+      file1);
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  uint8_t tensor1[3] = { 1, 2, 3 };
+  uint8_t tensor2[5] = { 4, 5, 6, 7, 8 };
+  uint8_t *content = NULL;
+  gsize len;
+  int i, j;
+
+  EXPECT_TRUE (dir != NULL);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_alloc_policy (info, ML_TENSORS_ALLOC_CONTIGUOUS);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 4; i++) {
+    status = ml_tensors_data_create (info, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_set_tensor_data (data, 0, tensor1, 3);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_data_set_tensor_data (data, 1, tensor2, 5);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    if (i % 2 == 0) {
+      status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+    } else {
+      status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      g_usleep (50000); /* 50ms. Wait a bit. */
+      ml_tensors_data_destroy (data);
+    }
+  }
+
+  g_usleep (50000); /* Wait for the pipeline to flush all */
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The padding between the tensors is not pushed. */
+  EXPECT_TRUE (g_file_get_contents (file1, (gchar **)&content, &len, NULL));
+  EXPECT_EQ (len, 8U * 4);
+
+  if (content && len == 32U) {
+    for (i = 0; i < 4; i++) {
+      for (j = 0; j < 8; j++)
+        EXPECT_EQ (content[i * 8 + j], j + 1);
+    }
+  }
+
+  g_free (content);
+  ml_tensors_info_destroy (info);
+  g_free (pipeline);
+  g_free (fullpath);
+  g_free (file1);
+}
+
 /**
  * @brief Test NNStreamer pipeline src
  * @detail Failure case when pipeline is NULL.
@@ -2844,6 +2930,1091 @@ TEST (nnstreamer_capi_util, info_init_n)
   ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 }
 
+/**
+ * @brief Test utility functions (internal)
+ * @detail The destroyed handles are reused for the next allocation, and cleared.
+ */
+TEST (nnstreamer_capi_util, tensors_cache_p)
+{
+  ml_tensors_cache_stats_s before, after;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  ml_tensor_type_e type;
+  unsigned int count;
+  int status, i;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  /* warm up the cache of this thread */
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (data);
+
+  _ml_tensors_cache_get_stats (&before);
+
+  for (i = 0; i < 10; i++) {
+    status = ml_tensors_data_create (info, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_destroy (data);
+  }
+
+  _ml_tensors_cache_get_stats (&after);
+  EXPECT_GE (after.data_reused - before.data_reused, 10U);
+  EXPECT_GE (after.info_reused - before.info_reused, 10U);
+
+  ml_tensors_info_destroy (info);
+
+  /* the reused handle has the default value */
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_get_count (info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 0U);
+  status = ml_tensors_info_get_tensor_type (info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ * @detail The data handles created from the same data share the frozen info.
+ */
+TEST (nnstreamer_capi_util, info_share_p)
+{
+  ml_tensors_info_h info, shared, frozen;
+  ml_tensors_data_h data, cloned;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_clone (data, &cloned);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the info of the data is a frozen copy, the info of the clone is a reference */
+  EXPECT_NE (((ml_tensors_data_s *) data)->info, info);
+  EXPECT_EQ (((ml_tensors_data_s *) data)->info, ((ml_tensors_data_s *) cloned)->info);
+  EXPECT_EQ (((ml_tensors_info_s *) ((ml_tensors_data_s *) data)->info)->ref_count, 2);
+
+  ml_tensors_data_destroy (data);
+  EXPECT_EQ (((ml_tensors_info_s *) ((ml_tensors_data_s *) cloned)->info)->ref_count, 1);
+  ml_tensors_data_destroy (cloned);
+
+  /* the frozen info cannot be updated */
+  status = _ml_tensors_info_share (info, &frozen);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (ml_tensors_info_is_equal (info, frozen));
+
+  status = ml_tensors_info_set_tensor_type (frozen, 0, ML_TENSOR_TYPE_INT8);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_clone (frozen, info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = _ml_tensors_info_share (frozen, &shared);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (shared, frozen);
+
+  ml_tensors_info_destroy (shared);
+  ml_tensors_info_destroy (frozen);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_share_n)
+{
+  ml_tensors_info_h info, shared;
+  int status;
+
+  status = _ml_tensors_info_share (nullptr, &shared);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* cannot share the info without valid data */
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_info_share (info, &shared);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = _ml_tensors_info_share (info, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail The buffers of tensors data are allocated with the policy of the info.
+ */
+TEST (nnstreamer_capi_util, data_alloc_policy_p)
+{
+  ml_tensors_info_h info, cloned;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 1024, 1024, 3, 1 };
+  unsigned int policy;
+  void *raw_data;
+  size_t data_size;
+  long page_size = sysconf (_SC_PAGESIZE);
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_info_get_alloc_policy (info, &policy);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (policy, (unsigned int) ML_TENSORS_ALLOC_DEFAULT);
+
+  status = ml_tensors_info_set_alloc_policy (info, ML_TENSORS_ALLOC_ALIGN_CACHE_LINE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw_data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ ((uintptr_t) raw_data % 64U, 0U);
+  EXPECT_EQ (((uint8_t *) raw_data)[data_size - 1], 0U);
+  ml_tensors_data_destroy (data);
+
+  status = ml_tensors_info_set_alloc_policy (info,
+      ML_TENSORS_ALLOC_ALIGN_PAGE | ML_TENSORS_ALLOC_NO_ZERO_FILL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw_data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ ((uintptr_t) raw_data % (uintptr_t) page_size, 0U);
+  ml_tensors_data_destroy (data);
+
+  /* 3 MiB tensor is aligned to the huge page, and the policy is cloned */
+  status = ml_tensors_info_set_alloc_policy (info, ML_TENSORS_ALLOC_HUGE_PAGE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_create (&cloned);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_clone (cloned, info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_get_alloc_policy (cloned, &policy);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (policy, (unsigned int) ML_TENSORS_ALLOC_HUGE_PAGE);
+
+  status = ml_tensors_data_create (cloned, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw_data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ ((uintptr_t) raw_data % (2U * 1024U * 1024U), 0U);
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (cloned);
+
+  /* the info without its own policy follows the default policy */
+  status = ml_tensors_info_set_alloc_policy (info, ML_TENSORS_ALLOC_DEFAULT);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_default_alloc_policy (ML_TENSORS_ALLOC_ALIGN_PAGE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw_data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ ((uintptr_t) raw_data % (uintptr_t) page_size, 0U);
+  ml_tensors_data_destroy (data);
+
+  status = ml_tensors_data_set_default_alloc_policy (ML_TENSORS_ALLOC_DEFAULT);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail All the tensors are in a single buffer with aligned offsets.
+ */
+TEST (nnstreamer_capi_util, data_contiguous_p)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, cloned;
+  ml_tensor_dimension dim = { 3, 1, 1, 1 };
+  void *block, *raw_data;
+  size_t block_size, data_size;
+  uintptr_t prev_end = 0;
+  unsigned int i;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 3);
+  for (i = 0; i < 3; i++) {
+    dim[0] = 3 + i * 2;
+    ml_tensors_info_set_tensor_type (info, i, ML_TENSOR_TYPE_UINT8);
+    ml_tensors_info_set_tensor_dimension (info, i, dim);
+  }
+  status = ml_tensors_info_set_alloc_policy (info, ML_TENSORS_ALLOC_CONTIGUOUS);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_contiguous_buffer (data, &block, &block_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ ((uintptr_t) block % 64U, 0U);
+
+  for (i = 0; i < 3; i++) {
+    status = ml_tensors_data_get_tensor_data (data, i, &raw_data, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (data_size, 3U + i * 2);
+    EXPECT_EQ ((uintptr_t) raw_data % 64U, 0U);
+    EXPECT_GE ((uintptr_t) raw_data, prev_end);
+    prev_end = (uintptr_t) raw_data + data_size;
+  }
+  EXPECT_EQ ((uintptr_t) block + block_size, prev_end);
+
+  /* the clone has the same layout */
+  status = ml_tensors_data_clone (data, &cloned);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_contiguous_buffer (cloned, &block, &block_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (cloned);
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_contiguous_n)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  void *block;
+  size_t block_size;
+  int status;
+
+  status = ml_tensors_data_get_contiguous_buffer (nullptr, &block, &block_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* each tensor has its own buffer */
+  status = ml_tensors_data_get_contiguous_buffer (data, &block, &block_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_get_contiguous_buffer (data, nullptr, &block_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_alloc_policy_n)
+{
+  ml_tensors_info_h info;
+  unsigned int policy;
+  int status;
+
+  status = ml_tensors_data_set_default_alloc_policy (0x100);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_set_alloc_policy (nullptr, ML_TENSORS_ALLOC_ALIGN_PAGE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_get_alloc_policy (nullptr, &policy);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_alloc_policy (info, 0x100);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_get_alloc_policy (info, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, tensors_cache_n)
+{
+  ml_tensors_cache_stats_s stats = { 0, 0, 0, 0 };
+
+  /* nothing happens with null */
+  _ml_tensors_cache_get_stats (nullptr);
+  EXPECT_EQ (stats.data_allocated, 0U);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Convert the tensors data with every instruction set, and compare the result with the scalar kernels.
+ */
+TEST (nnstreamer_capi_util, data_convert_p)
+{
+  const char *isa[] = { "avx2", "sse2", "neon", "scalar" };
+  ml_tensors_info_h src_info, dest_info;
+  ml_tensors_data_h src, dest;
+  ml_tensor_dimension dim = { 37, 1, 1, 1 };
+  const uint16_t half_src[4] = { 0x3c00, 0xc000, 0x3800, 0x7bff };
+  const float half_f32[4] = { 1.0f, -2.0f, 0.5f, 65504.0f };
+  const uint16_t half_dest[4] = { 0x4100, 0xc300, 0x3e00, 0x7c00 };
+  uint8_t *u8;
+  uint16_t *f16;
+  float *f32;
+  size_t data_size;
+  unsigned int i, j;
+  int status;
+
+  status = ml_tensors_info_create (&src_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (src_info, 2);
+  ml_tensors_info_set_tensor_type (src_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (src_info, 0, dim);
+  ml_tensors_info_set_tensor_type (src_info, 1, ML_TENSOR_TYPE_FLOAT16);
+  ml_tensors_info_set_tensor_dimension (src_info, 1, dim);
+
+  status = ml_tensors_info_create (&dest_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (dest_info, 2);
+  ml_tensors_info_set_tensor_type (dest_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (dest_info, 0, dim);
+  ml_tensors_info_set_tensor_type (dest_info, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (dest_info, 1, dim);
+
+  status = ml_tensors_data_create (src_info, &src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (dest_info, &dest);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* 65504 is the max of float16 */
+  ml_tensors_data_get_tensor_data (src, 0, (void **) &u8, &data_size);
+  ml_tensors_data_get_tensor_data (src, 1, (void **) &f16, &data_size);
+  for (i = 0; i < 37; i++) {
+    u8[i] = (uint8_t) (i * 7);
+    f16[i] = half_src[i % 4];
+  }
+
+  for (j = 0; j < G_N_ELEMENTS (isa); j++) {
+    if (_ml_tensors_convert_set_isa (isa[j]) != ML_ERROR_NONE)
+      continue;
+
+    status = ml_tensors_data_normalize (src, dest, 1.0f / 127.5f, -1.0f);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_get_tensor_data (dest, 0, (void **) &f32, &data_size);
+    EXPECT_EQ (data_size, 37U * sizeof (float));
+    for (i = 0; i < 37; i++)
+      EXPECT_FLOAT_EQ (f32[i], (float) (i * 7) * (1.0f / 127.5f) - 1.0f);
+
+    status = ml_tensors_data_convert (src, dest);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_get_tensor_data (dest, 1, (void **) &f32, &data_size);
+    for (i = 0; i < 37; i++)
+      EXPECT_FLOAT_EQ (f32[i], half_f32[i % 4]);
+
+    /* back to uint8 and float16, the tie is rounded to even and the value out of range is saturated */
+    status = ml_tensors_data_normalize (dest, src, 2.0f, 0.5f);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    for (i = 0; i < 37; i++)
+      EXPECT_EQ (u8[i], (i * 14 > 255) ? 255U : i * 14);
+    for (i = 0; i < 37; i++)
+      EXPECT_EQ (f16[i], half_dest[i % 4]);
+
+    /* restore the source for the next instruction set */
+    for (i = 0; i < 37; i++) {
+      u8[i] = (uint8_t) (i * 7);
+      f16[i] = half_src[i % 4];
+    }
+  }
+
+  EXPECT_EQ (_ml_tensors_convert_set_isa (nullptr), ML_ERROR_NONE);
+  EXPECT_TRUE (_ml_tensors_convert_get_isa () != nullptr);
+
+  ml_tensors_data_destroy (src);
+  ml_tensors_data_destroy (dest);
+  ml_tensors_info_destroy (src_info);
+  ml_tensors_info_destroy (dest_info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Failure case with invalid parameters or different number of elements.
+ */
+TEST (nnstreamer_capi_util, data_convert_n)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h src, dest;
+  ml_tensor_dimension dim = { 10, 1, 1, 1 };
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  status = ml_tensors_data_create (info, &src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* 10 uint8 and 5 uint16 elements, of the same byte size */
+  dim[0] = 5;
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT16);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  status = ml_tensors_data_create (info, &dest);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_convert (src, dest);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_normalize (src, dest, 1.0f, 0.0f);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_convert (nullptr, dest);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_normalize (src, nullptr, 1.0f, 0.0f);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (_ml_tensors_convert_set_isa ("mmx"), ML_ERROR_NOT_SUPPORTED);
+
+  ml_tensors_data_destroy (src);
+  ml_tensors_data_destroy (dest);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Set and get the quantization parameters, which are copied when the information is cloned.
+ */
+TEST (nnstreamer_capi_util, info_quantization_p)
+{
+  ml_tensors_info_h info, cloned;
+  ml_tensor_dimension dim = { 3, 4, 1, 1 };
+  const float scales[3] = { 0.5f, 0.25f, 0.125f };
+  const int32_t zero_points[3] = { 1, -2, 3 };
+  unsigned int axis, num_channels, i;
+  float *out_scales;
+  int32_t *out_zero_points;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  status = ml_tensors_info_set_tensor_quantization (info, 0, 0, 3, scales, zero_points);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_create (&cloned);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_clone (cloned, info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_quantization (
+      cloned, 0, &axis, &num_channels, &out_scales, &out_zero_points);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (axis, 0U);
+  EXPECT_EQ (num_channels, 3U);
+  for (i = 0; i < 3; i++) {
+    EXPECT_FLOAT_EQ (out_scales[i], scales[i]);
+    EXPECT_EQ (out_zero_points[i], zero_points[i]);
+  }
+  g_free (out_scales);
+  g_free (out_zero_points);
+
+  /* the tensor without the parameters, and clearing the parameters */
+  status = ml_tensors_info_get_tensor_quantization (
+      cloned, 1, &axis, &num_channels, &out_scales, &out_zero_points);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (num_channels, 0U);
+  EXPECT_TRUE (out_scales == nullptr);
+
+  status = ml_tensors_info_set_tensor_quantization (info, 0, 0, 0, nullptr, nullptr);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_get_tensor_quantization (
+      info, 0, &axis, &num_channels, &out_scales, &out_zero_points);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (num_channels, 0U);
+
+  ml_tensors_info_destroy (cloned);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Failure case to set the invalid quantization parameters.
+ */
+TEST (nnstreamer_capi_util, info_quantization_n)
+{
+  ml_tensors_info_h info;
+  const float scales[2] = { 0.5f, 0.0f };
+  unsigned int axis, num_channels;
+  float *out_scales;
+  int32_t *out_zero_points;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+
+  status = ml_tensors_info_set_tensor_quantization (nullptr, 0, 0, 1, scales, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_set_tensor_quantization (info, 1, 0, 1, scales, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_set_tensor_quantization (info, 0, 0, 0, scales, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_set_tensor_quantization (info, 0, 0, 2, scales, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_set_tensor_quantization (
+      info, 0, ML_TENSOR_RANK_LIMIT, 1, scales, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_get_tensor_quantization (
+      info, 0, &axis, &num_channels, &out_scales, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_get_tensor_quantization (
+      info, 1, &axis, &num_channels, &out_scales, &out_zero_points);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Quantize and dequantize with the per-tensor and per-channel parameters.
+ */
+TEST (nnstreamer_capi_util, data_quantize_p)
+{
+  const char *isa[] = { "avx2", "sse2", "neon", "scalar" };
+  ml_tensors_info_h float_info, quant_info;
+  ml_tensors_data_h real, quantized, restored;
+  ml_tensor_dimension dim = { 16, 2, 1, 1 };
+  const float scale = 0.5f;
+  const int32_t zero_point = -10;
+  const float scales[2] = { 0.5f, 2.0f };
+  const int32_t zero_points[2] = { 0, 128 };
+  float *f32, *r32;
+  int8_t *i8;
+  uint8_t *u8;
+  size_t data_size;
+  unsigned int i, j;
+  int status;
+
+  status = ml_tensors_info_create (&float_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (float_info, 2);
+  ml_tensors_info_set_tensor_type (float_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (float_info, 0, dim);
+  ml_tensors_info_set_tensor_type (float_info, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (float_info, 1, dim);
+
+  /* int8 per-tensor, and uint8 per-channel at axis 1 (16 elements in a channel) */
+  status = ml_tensors_info_create (&quant_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_clone (quant_info, float_info);
+  ml_tensors_info_set_tensor_type (quant_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_type (quant_info, 1, ML_TENSOR_TYPE_UINT8);
+  status = ml_tensors_info_set_tensor_quantization (quant_info, 0, 0, 1, &scale, &zero_point);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_quantization (quant_info, 1, 1, 2, scales, zero_points);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_create (float_info, &real);
+  ml_tensors_data_create (quant_info, &quantized);
+  ml_tensors_data_create (float_info, &restored);
+
+  ml_tensors_data_get_tensor_data (real, 0, (void **) &f32, &data_size);
+  for (i = 0; i < 32; i++)
+    f32[i] = (float) i * 4.0f - 40.0f;
+  ml_tensors_data_get_tensor_data (real, 1, (void **) &f32, &data_size);
+  for (i = 0; i < 32; i++)
+    f32[i] = (float) i * 8.0f - 64.0f;
+
+  for (j = 0; j < G_N_ELEMENTS (isa); j++) {
+    if (_ml_tensors_convert_set_isa (isa[j]) != ML_ERROR_NONE)
+      continue;
+
+    status = ml_tensors_data_quantize (real, quantized);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    /* int8 saturates at 127: (x / 0.5) - 10 */
+    ml_tensors_data_get_tensor_data (quantized, 0, (void **) &i8, &data_size);
+    for (i = 0; i < 32; i++)
+      EXPECT_EQ (i8[i], (int8_t) MIN ((int) i * 8 - 90, 127));
+
+    /* channel 0 saturates at 0: x / 0.5, channel 1: x / 2 + 128 */
+    ml_tensors_data_get_tensor_data (quantized, 1, (void **) &u8, &data_size);
+    for (i = 0; i < 16; i++)
+      EXPECT_EQ (u8[i], (uint8_t) MAX ((int) i * 16 - 128, 0));
+    for (i = 16; i < 32; i++)
+      EXPECT_EQ (u8[i], (uint8_t) (i * 4 - 32 + 128));
+
+    status = ml_tensors_data_dequantize (quantized, restored);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    ml_tensors_data_get_tensor_data (restored, 0, (void **) &r32, &data_size);
+    for (i = 0; i < 32; i++)
+      EXPECT_FLOAT_EQ (r32[i], MIN ((float) i * 4.0f - 40.0f, 68.5f));
+    ml_tensors_data_get_tensor_data (restored, 1, (void **) &r32, &data_size);
+    for (i = 16; i < 32; i++)
+      EXPECT_FLOAT_EQ (r32[i], (float) i * 8.0f - 64.0f);
+  }
+
+  _ml_tensors_convert_set_isa (nullptr);
+
+  ml_tensors_data_destroy (real);
+  ml_tensors_data_destroy (quantized);
+  ml_tensors_data_destroy (restored);
+  ml_tensors_info_destroy (float_info);
+  ml_tensors_info_destroy (quant_info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Quantize the values near a tie, rounding the quotient of the scale to even.
+ */
+TEST (nnstreamer_capi_util, data_quantize_tie_p)
+{
+  const char *isa[] = { "avx2", "sse2", "neon", "scalar" };
+  ml_tensors_info_h float_info, quant_info;
+  ml_tensors_data_h real, quantized;
+  ml_tensor_dimension dim = { 32, 1, 1, 1 };
+  const float scale = 0.1f;
+  const int32_t zero_points[2] = { 0, 100 };
+  /* 1.55 / 0.1 is 15.499999 (1.55 * 10 is 15.5), and 3.2500002 / 0.1 is exactly 32.5 */
+  const float values[4] = { 1.55f, -1.55f, 3.2500002f, -3.2500002f };
+  const int expected[4] = { 15, -15, 32, -32 };
+  float *f32;
+  int8_t *i8;
+  uint8_t *u8;
+  size_t data_size;
+  unsigned int i, j;
+  int status;
+
+  status = ml_tensors_info_create (&float_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (float_info, 2);
+  ml_tensors_info_set_tensor_type (float_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (float_info, 0, dim);
+  ml_tensors_info_set_tensor_type (float_info, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (float_info, 1, dim);
+
+  status = ml_tensors_info_create (&quant_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_clone (quant_info, float_info);
+  ml_tensors_info_set_tensor_type (quant_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_type (quant_info, 1, ML_TENSOR_TYPE_UINT8);
+  status = ml_tensors_info_set_tensor_quantization (
+      quant_info, 0, 0, 1, &scale, &zero_points[0]);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_quantization (
+      quant_info, 1, 0, 1, &scale, &zero_points[1]);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_create (float_info, &real);
+  ml_tensors_data_create (quant_info, &quantized);
+
+  for (j = 0; j < 2; j++) {
+    ml_tensors_data_get_tensor_data (real, j, (void **) &f32, &data_size);
+    for (i = 0; i < 32; i++)
+      f32[i] = values[i % 4];
+  }
+
+  for (j = 0; j < G_N_ELEMENTS (isa); j++) {
+    if (_ml_tensors_convert_set_isa (isa[j]) != ML_ERROR_NONE)
+      continue;
+
+    status = ml_tensors_data_quantize (real, quantized);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    /* the zero point is added after rounding */
+    ml_tensors_data_get_tensor_data (quantized, 0, (void **) &i8, &data_size);
+    for (i = 0; i < 32; i++)
+      EXPECT_EQ (i8[i], (int8_t) expected[i % 4]);
+    ml_tensors_data_get_tensor_data (quantized, 1, (void **) &u8, &data_size);
+    for (i = 0; i < 32; i++)
+      EXPECT_EQ (u8[i], (uint8_t) (expected[i % 4] + 100));
+  }
+
+  _ml_tensors_convert_set_isa (nullptr);
+
+  ml_tensors_data_destroy (real);
+  ml_tensors_data_destroy (quantized);
+  ml_tensors_info_destroy (float_info);
+  ml_tensors_info_destroy (quant_info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Failure case when the per-channel parameters do not match the dimension.
+ */
+TEST (nnstreamer_capi_util, data_quantize_n)
+{
+  ml_tensors_info_h float_info, quant_info;
+  ml_tensors_data_h real, quantized;
+  ml_tensor_dimension dim = { 4, 3, 1, 1 };
+  const float scales[2] = { 0.5f, 0.5f };
+  int status;
+
+  status = ml_tensors_info_create (&float_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (float_info, 1);
+  ml_tensors_info_set_tensor_type (float_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (float_info, 0, dim);
+
+  status = ml_tensors_info_create (&quant_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_clone (quant_info, float_info);
+  ml_tensors_info_set_tensor_type (quant_info, 0, ML_TENSOR_TYPE_INT8);
+  status = ml_tensors_info_set_tensor_quantization (quant_info, 0, 1, 2, scales, nullptr);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_create (float_info, &real);
+  ml_tensors_data_create (quant_info, &quantized);
+
+  status = ml_tensors_data_quantize (real, quantized);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_dequantize (quantized, real);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_quantize (nullptr, quantized);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_dequantize (quantized, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (real);
+  ml_tensors_data_destroy (quantized);
+  ml_tensors_info_destroy (float_info);
+  ml_tensors_info_destroy (quant_info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Change the layout of the RGB image from NHWC to NCHW with BGR, and back to NHWC.
+ */
+TEST (nnstreamer_capi_util, data_permute_p)
+{
+  const char *isa[] = { "avx2", "sse2", "neon", "scalar" };
+  const unsigned int to_nchw[4] = { 1, 2, 0, 3 };
+  const unsigned int to_nhwc[4] = { 2, 0, 1, 3 };
+  const unsigned int bgr[3] = { 2, 1, 0 };
+  ml_tensors_info_h nhwc_info, nchw_info;
+  ml_tensors_data_h nhwc, nchw, restored;
+  ml_tensor_dimension nhwc_dim = { 3, 21, 5, 2 };
+  ml_tensor_dimension nchw_dim = { 21, 5, 3, 2 };
+  uint8_t *image, *planes, *out;
+  size_t data_size;
+  unsigned int i, n, c, p, k;
+  int status;
+
+  status = ml_tensors_info_create (&nhwc_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (nhwc_info, 1);
+  ml_tensors_info_set_tensor_type (nhwc_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (nhwc_info, 0, nhwc_dim);
+
+  status = ml_tensors_info_create (&nchw_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_clone (nchw_info, nhwc_info);
+  ml_tensors_info_set_tensor_dimension (nchw_info, 0, nchw_dim);
+
+  ml_tensors_data_create (nhwc_info, &nhwc);
+  ml_tensors_data_create (nchw_info, &nchw);
+  ml_tensors_data_create (nhwc_info, &restored);
+
+  ml_tensors_data_get_tensor_data (nhwc, 0, (void **) &image, &data_size);
+  for (i = 0; i < data_size; i++)
+    image[i] = (uint8_t) (i * 7 + 1);
+
+  for (k = 0; k < G_N_ELEMENTS (isa); k++) {
+    if (_ml_tensors_convert_set_isa (isa[k]) != ML_ERROR_NONE)
+      continue;
+
+    status = ml_tensors_data_permute_with_channel_order (
+        nhwc, nchw, 0, to_nchw, 4, 0, bgr);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    /* 105 pixels in a plane, the plane c is the channel (2 - c) of the image */
+    ml_tensors_data_get_tensor_data (nchw, 0, (void **) &planes, &data_size);
+    for (n = 0; n < 2; n++) {
+      for (c = 0; c < 3; c++) {
+        for (p = 0; p < 105; p++)
+          EXPECT_EQ (planes[(n * 3 + c) * 105 + p], image[(n * 105 + p) * 3 + 2 - c]);
+      }
+    }
+
+    status = ml_tensors_data_permute_with_channel_order (
+        nchw, restored, 0, to_nhwc, 4, 2, bgr);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_get_tensor_data (restored, 0, (void **) &out, &data_size);
+    EXPECT_EQ (memcmp (out, image, data_size), 0);
+
+    /* without the channel order */
+    status = ml_tensors_data_permute (nhwc, nchw, 0, to_nchw, 4);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    for (p = 0; p < 105; p++)
+      EXPECT_EQ (planes[p], image[p * 3]);
+    status = ml_tensors_data_permute (nchw, restored, 0, to_nhwc, 4);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (memcmp (out, image, data_size), 0);
+  }
+
+  _ml_tensors_convert_set_isa (nullptr);
+
+  ml_tensors_data_destroy (nhwc);
+  ml_tensors_data_destroy (nchw);
+  ml_tensors_data_destroy (restored);
+  ml_tensors_info_destroy (nhwc_info);
+  ml_tensors_info_destroy (nchw_info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Transpose the float32 matrices of a batch, larger than the tile.
+ */
+TEST (nnstreamer_capi_util, data_permute_transpose_p)
+{
+  const unsigned int transpose[2] = { 1, 0 };
+  ml_tensors_info_h info, transposed_info;
+  ml_tensors_data_h data, transposed;
+  ml_tensor_dimension dim = { 70, 45, 3, 1 };
+  float *in, *out;
+  size_t data_size;
+  unsigned int b, r, c;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_info_create (&transposed_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_clone (transposed_info, info);
+  dim[0] = 45;
+  dim[1] = 70;
+  ml_tensors_info_set_tensor_dimension (transposed_info, 0, dim);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_create (transposed_info, &transposed);
+
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &in, &data_size);
+  for (c = 0; c < data_size / sizeof (float); c++)
+    in[c] = (float) c;
+
+  /* the batch axis out of the rank is kept */
+  status = ml_tensors_data_permute (data, transposed, 0, transpose, 2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (transposed, 0, (void **) &out, &data_size);
+  for (b = 0; b < 3; b++) {
+    for (r = 0; r < 70; r++) {
+      for (c = 0; c < 45; c++)
+        EXPECT_FLOAT_EQ (out[b * 3150 + r * 45 + c], in[b * 3150 + c * 70 + r]);
+    }
+  }
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (transposed);
+  ml_tensors_info_destroy (info);
+  ml_tensors_info_destroy (transposed_info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Failure case with the invalid axes, channel order or dimension.
+ */
+TEST (nnstreamer_capi_util, data_permute_n)
+{
+  const unsigned int to_nchw[4] = { 1, 2, 0, 3 };
+  const unsigned int invalid_axes[4] = { 1, 1, 0, 3 };
+  const unsigned int invalid_order[3] = { 0, 0, 1 };
+  ml_tensors_info_h info;
+  ml_tensors_data_h src, dest;
+  ml_tensor_dimension dim = { 3, 4, 5, 1 };
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_tensors_data_create (info, &src);
+  /* the same dimension as src, not permuted */
+  ml_tensors_data_create (info, &dest);
+
+  status = ml_tensors_data_permute (src, dest, 0, to_nchw, 4);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_permute (src, dest, 0, invalid_axes, 4);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_permute (src, dest, 0, to_nchw, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_permute (src, dest, 1, to_nchw, 4);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_permute (src, src, 0, to_nchw, 4);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_permute (src, dest, 0, nullptr, 4);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_permute_with_channel_order (
+      src, dest, 0, to_nchw, 4, 0, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_permute_with_channel_order (
+      src, dest, 0, to_nchw, 4, 4, invalid_order);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the order of the channels is checked with the dimension of the channel axis */
+  dim[0] = 4;
+  dim[1] = 5;
+  dim[2] = 3;
+  ml_tensors_data_destroy (dest);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &dest);
+  status = ml_tensors_data_permute_with_channel_order (
+      src, dest, 0, to_nchw, 4, 0, invalid_order);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (src);
+  ml_tensors_data_destroy (dest);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Thread to access the tensors data released by the owner thread.
+ */
+static gpointer
+single_owner_access_data (gpointer data)
+{
+  void *raw = NULL;
+  size_t size = 0;
+
+  if (ml_tensors_data_get_tensor_data ((ml_tensors_data_h) data, 0, &raw, &size) != ML_ERROR_NONE)
+    return GINT_TO_POINTER (FALSE);
+
+  return GINT_TO_POINTER (raw != NULL && size == 10U);
+}
+
+/**
+ * @brief Thread to set or release the single-owner handle owned by another thread.
+ */
+static gpointer
+single_owner_take_handle (gpointer data)
+{
+  ml_tensors_data_h handle = (ml_tensors_data_h) data;
+
+  if (ml_tensors_data_set_single_owner (handle, true) != ML_ERROR_INVALID_PARAMETER)
+    return GINT_TO_POINTER (FALSE);
+  if (ml_tensors_data_set_single_owner (handle, false) != ML_ERROR_INVALID_PARAMETER)
+    return GINT_TO_POINTER (FALSE);
+
+  return GINT_TO_POINTER (TRUE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail The single-owner handles skip the locks and can be shared again after releasing them.
+ */
+TEST (nnstreamer_capi_util, single_owner_p)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 10, 1, 1, 1 };
+  GThread *thread;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_single_owner (info, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* setting it again in the owner thread does nothing */
+  status = ml_tensors_info_set_single_owner (info, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (((ml_tensors_info_s *) info)->nolock, 1);
+  EXPECT_EQ (((ml_tensors_info_s *) info)->owner, g_thread_self ());
+
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  /* the data created in the owner thread is also the single-owner handle */
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (((ml_tensors_data_s *) data)->nolock, 1);
+  EXPECT_EQ (((ml_tensors_data_s *) data)->owner, g_thread_self ());
+
+  /* release the data and pass it to another thread */
+  status = ml_tensors_data_set_single_owner (data, false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (((ml_tensors_data_s *) data)->nolock, 0);
+  EXPECT_TRUE (((ml_tensors_data_s *) data)->owner == NULL);
+
+  thread = g_thread_new ("single-owner", single_owner_access_data, data);
+  EXPECT_TRUE (GPOINTER_TO_INT (g_thread_join (thread)));
+
+  ml_tensors_data_destroy (data);
+
+  status = ml_tensors_info_set_single_owner (info, false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (((ml_tensors_info_s *) info)->nolock, 0);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (((ml_tensors_data_s *) data)->nolock, 0);
+  EXPECT_TRUE (((ml_tensors_data_s *) data)->owner == NULL);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @detail Failure case with the invalid handle, or the handle owned by another thread.
+ */
+TEST (nnstreamer_capi_util, single_owner_n)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 10, 1, 1, 1 };
+  GThread *thread;
+  int status;
+
+  status = ml_tensors_info_set_single_owner (NULL, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_set_single_owner (NULL, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_single_owner (data, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  thread = g_thread_new ("single-owner", single_owner_take_handle, data);
+  EXPECT_TRUE (GPOINTER_TO_INT (g_thread_join (thread)));
+  EXPECT_EQ (((ml_tensors_data_s *) data)->owner, g_thread_self ());
+
+  /* the frozen information shared by the data cannot be the single-owner handle */
+  status = ml_tensors_info_set_single_owner (((ml_tensors_data_s *) data)->info, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+}
+
 /**
  * @brief Test utility functions (public)
  */
@@ -145,16 +145,32 @@ class nnstreamer_capi_singleshot_latency : public ::testing::Test
   /**
    * @brief Benchmark the invoke time for the single API
    */
-  void benchmarkSingleInvoke (ml_nnfw_type_e nnfw, const bool no_alloc)
+  void benchmarkSingleInvoke (ml_nnfw_type_e nnfw, const bool no_alloc,
+      const bool borrow_input, const char *handoff_spin_us)
   {
     ml_single_h single;
     ml_tensors_info_h in_info, out_info;
     ml_tensors_data_h input, output;
+    gchar *latency_stats = NULL;
 
     /** Open the single handle */
     status = ml_single_open (&single, model_file, NULL, NULL, nnfw, ML_NNFW_HW_ANY);
     ASSERT_EQ (status, ML_ERROR_NONE);
 
+    /** Skip copying the input data in each invoke */
+    if (borrow_input) {
+      status = ml_single_set_property (single, "borrow-input", "true");
+      EXPECT_EQ (status, ML_ERROR_NONE);
+    }
+
+    /** Pass the requests to the invoke thread with timeout, and spin in the hand-off */
+    if (handoff_spin_us) {
+      status = ml_single_set_timeout (single, 10000);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      status = ml_single_set_property (single, "handoff-spin-us", handoff_spin_us);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+    }
+
     /** Get input/output data info */
     status = ml_single_get_input_info (single, &in_info);
     EXPECT_EQ (status, ML_ERROR_NONE);
@@ -177,6 +193,10 @@ class nnstreamer_capi_singleshot_latency : public ::testing::Test
       EXPECT_EQ ((size_t)data_read, data_size);
     }
 
+    /** Exclude the lazy initialization of the framework */
+    status = ml_single_warmup (single, 3);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
     /** Benchmark the invoke duration */
     for (int idx = 0; idx < RUN_COUNT; ++idx) {
       if (no_alloc) {
@@ -208,6 +228,12 @@ class nnstreamer_capi_singleshot_latency : public ::testing::Test
     single_invoke_duration_f = (single_total_invoke_duration * 1.0) / RUN_COUNT;
     g_warning ("Time to invoke single = %f us", single_invoke_duration_f);
 
+    /** Percentiles of the latency measured by the handle */
+    status = ml_single_get_property (single, "latency-stats", &latency_stats);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_warning ("Latency of single = %s us", latency_stats);
+    g_free (latency_stats);
+
     /** Close the single handle */
     status = ml_single_close (single);
     EXPECT_EQ (status, ML_ERROR_NONE);
@@ -220,12 +246,14 @@ class nnstreamer_capi_singleshot_latency : public ::testing::Test
   /**
    * @brief Benchmark the latency by the single API invoke
    */
-  void benchmarkSingleInvokeLatency (ml_nnfw_type_e nnfw, const char *fw, const bool no_alloc)
+  void benchmarkSingleInvokeLatency (ml_nnfw_type_e nnfw, const char *fw,
+      const bool no_alloc, const bool borrow_input = false,
+      const char *handoff_spin_us = NULL)
   {
     /** sleep 30 sec for cooldown from any previous runs */
     sleep (30);
 
-    benchmarkSingleInvoke (nnfw, no_alloc);
+    benchmarkSingleInvoke (nnfw, no_alloc, borrow_input, handoff_spin_us);
     extractInternalInvokeTime (fw);
 
     g_warning ("Total Latency added by single API over framework %s for invoke"
@@ -267,6 +295,42 @@ TEST_F (nnstreamer_capi_singleshot_latency, benchmarkTensorflowLite_no_alloc)
 {
   benchmarkSingleInvokeLatency (ML_NNFW_TYPE_TENSORFLOW_LITE, "tensorflow-lite", true);
 }
+
+/**
+ * @brief Measure latency for NNStreamer single shot (tensorflow-lite, borrowed input without copying)
+ * @note Measure the invoke latency added by NNStreamer single shot
+ */
+TEST_F (nnstreamer_capi_singleshot_latency, benchmarkTensorflowLite_borrow_input)
+{
+  benchmarkSingleInvokeLatency (ML_NNFW_TYPE_TENSORFLOW_LITE, "tensorflow-lite", false, true);
+}
+
+/**
+ * @brief Measure latency for NNStreamer single shot (tensorflow-lite, borrowed input and no output alloc in invoke)
+ * @note Measure the invoke latency added by NNStreamer single shot
+ */
+TEST_F (nnstreamer_capi_singleshot_latency, benchmarkTensorflowLite_no_alloc_borrow_input)
+{
+  benchmarkSingleInvokeLatency (ML_NNFW_TYPE_TENSORFLOW_LITE, "tensorflow-lite", true, true);
+}
+
+/**
+ * @brief Measure latency for NNStreamer single shot (tensorflow-lite, invoke thread with timeout)
+ * @note Measure the invoke latency added by the hand-off to the invoke thread
+ */
+TEST_F (nnstreamer_capi_singleshot_latency, benchmarkTensorflowLite_timeout)
+{
+  benchmarkSingleInvokeLatency (ML_NNFW_TYPE_TENSORFLOW_LITE, "tensorflow-lite", false, false, "0");
+}
+
+/**
+ * @brief Measure latency for NNStreamer single shot (tensorflow-lite, invoke thread with timeout, spinning hand-off)
+ * @note Measure the invoke latency added by the hand-off to the invoke thread
+ */
+TEST_F (nnstreamer_capi_singleshot_latency, benchmarkTensorflowLite_timeout_spin)
+{
+  benchmarkSingleInvokeLatency (ML_NNFW_TYPE_TENSORFLOW_LITE, "tensorflow-lite", false, false, "200");
+}
 #endif
 
 #if defined(ENABLE_NNFW_RUNTIME)
@@ -280,6 +344,58 @@ TEST_F (nnstreamer_capi_singleshot_latency, benchmarkNNFWRuntime)
 }
 #endif
 
+/**
+ * @brief Measure the time to normalize a uint8 image to float32, with each instruction set of the conversion kernels
+ * @note Compare the SIMD kernels with the scalar reference
+ */
+TEST (nnstreamer_capi_convert_latency, benchmarkNormalize)
+{
+  const char *isa[] = { "scalar", "sse2", "avx2", "neon" };
+  ml_tensors_info_h src_info, dest_info;
+  ml_tensors_data_h src, dest;
+  ml_tensor_dimension dim = { 3, 224, 224, 1 };
+  int64_t start, end;
+  int status;
+  unsigned int i;
+
+  status = ml_tensors_info_create (&src_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (src_info, 1);
+  ml_tensors_info_set_tensor_type (src_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (src_info, 0, dim);
+  status = ml_tensors_info_create (&dest_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_clone (dest_info, src_info);
+  ml_tensors_info_set_tensor_type (dest_info, 0, ML_TENSOR_TYPE_FLOAT32);
+
+  status = ml_tensors_data_create (src_info, &src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (dest_info, &dest);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < G_N_ELEMENTS (isa); i++) {
+    if (_ml_tensors_convert_set_isa (isa[i]) != ML_ERROR_NONE)
+      continue;
+
+    start = g_get_monotonic_time ();
+    for (int idx = 0; idx < RUN_COUNT; ++idx) {
+      status = ml_tensors_data_normalize (src, dest, 1.0f / 127.5f, -1.0f);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+    }
+    end = g_get_monotonic_time ();
+
+    g_warning ("Time to normalize uint8 to float32 (%s) = %f us", isa[i],
+        (end - start) * 1.0 / RUN_COUNT);
+  }
+
+  _ml_tensors_convert_set_isa (NULL);
+
+  ml_tensors_data_destroy (src);
+  ml_tensors_data_destroy (dest);
+  ml_tensors_info_destroy (src_info);
+  ml_tensors_info_destroy (dest_info);
+}
+
 /**
  * @brief Main gtest
  */
@@ -9,6 +9,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <glib.h>
 #include <nnstreamer.h>
 #include <nnstreamer-single.h>
@@ -3772,6 +3774,2511 @@ skip_test:
   g_free (test_model);
 }
 
+/**
+ * @brief Test NNStreamer single shot (tflite)
+ * @detail Invoke the model with borrowed input data (no copy of input).
+ */
+TEST (nnstreamer_capi_singleshot, invoke_borrow_input_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+  char *prop_value;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_property (single, "borrow-input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "false");
+  g_free (prop_value);
+
+  status = ml_single_set_property (single, "borrow-input", "invalid");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_set_property (single, "borrow-input", "true");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "borrow-input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "true");
+  g_free (prop_value);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, sizeof (float));
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  /* input is still valid after invoke */
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Data to check the result of ml_single_invoke_async().
+ */
+typedef struct {
+  GMutex lock; /**< lock for the data */
+  GCond cond; /**< signaled when the callback is called */
+  guint received; /**< the number of the callbacks called */
+  guint failed; /**< the number of the callbacks with error */
+  float value; /**< the output value of the last callback */
+} async_invoke_result_s;
+
+/**
+ * @brief Callback for ml_single_invoke_async().
+ */
+static void
+test_cb_single_invoke_async (int status, ml_tensors_data_h output, void *user_data)
+{
+  async_invoke_result_s *result = (async_invoke_result_s *) user_data;
+  float *output_buf = NULL;
+  size_t data_size;
+
+  g_mutex_lock (&result->lock);
+
+  if (status == ML_ERROR_NONE) {
+    EXPECT_TRUE (output != NULL);
+    ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+    EXPECT_EQ (data_size, sizeof (float));
+    result->value = output_buf[0];
+    ml_tensors_data_destroy (output);
+  } else {
+    EXPECT_TRUE (output == NULL);
+    result->failed++;
+  }
+
+  result->received++;
+  g_cond_signal (&result->cond);
+  g_mutex_unlock (&result->lock);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Invoke the model asynchronously.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_async_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+  async_invoke_result_s result;
+  gint64 end_time;
+  guint i;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_mutex_init (&result.lock);
+  g_cond_init (&result.cond);
+  result.received = result.failed = 0;
+  result.value = 0.0f;
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 5; i++) {
+    status = ml_single_invoke_async (
+        single, input, test_cb_single_invoke_async, &result);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* sync invoke is available while the requests are processed */
+  do {
+    status = ml_single_invoke (single, input, &output);
+  } while (status == ML_ERROR_TRY_AGAIN);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  /* wait for the results */
+  end_time = g_get_monotonic_time () + SINGLE_DEF_TIMEOUT_MSEC * G_TIME_SPAN_MILLISECOND;
+  g_mutex_lock (&result.lock);
+  while (result.received < 5) {
+    if (!g_cond_wait_until (&result.cond, &result.lock, end_time))
+      break;
+  }
+  EXPECT_EQ (result.received, 5U);
+  EXPECT_EQ (result.failed, 0U);
+  EXPECT_FLOAT_EQ (result.value, 3.0f);
+  g_mutex_unlock (&result.lock);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_cond_clear (&result.cond);
+  g_mutex_clear (&result.lock);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case with invalid parameters.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_async_invalid_param_n)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke_async (NULL, input, test_cb_single_invoke_async, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_invoke_async (single, NULL, test_cb_single_invoke_async, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_invoke_async (single, input, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Data to invoke the model synchronously in the callback of ml_single_invoke_async().
+ */
+typedef struct {
+  GMutex lock; /**< lock for the data */
+  GCond cond; /**< signaled when the callback is called */
+  ml_single_h single; /**< the handle invoking the request */
+  ml_tensors_data_h input; /**< the input data to be invoked in the callback */
+  gboolean called; /**< the callback is called */
+  int status; /**< the result of the synchronous invoke in the callback */
+} async_invoke_sync_s;
+
+/**
+ * @brief Callback for ml_single_invoke_async(), which invokes the same handle synchronously.
+ */
+static void
+test_cb_single_invoke_sync (int status, ml_tensors_data_h output, void *user_data)
+{
+  async_invoke_sync_s *data = (async_invoke_sync_s *) user_data;
+  ml_tensors_data_h sync_output = NULL;
+
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  if (output)
+    ml_tensors_data_destroy (output);
+
+  status = ml_single_invoke (data->single, data->input, &sync_output);
+  if (sync_output)
+    ml_tensors_data_destroy (sync_output);
+
+  g_mutex_lock (&data->lock);
+  data->status = status;
+  data->called = TRUE;
+  g_cond_signal (&data->cond);
+  g_mutex_unlock (&data->lock);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case to invoke the model synchronously in the callback, which would wait for itself.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_async_sync_in_cb_n)
+{
+  int status;
+  ml_tensors_info_h in_info;
+  async_invoke_sync_s data;
+  gint64 end_time;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_mutex_init (&data.lock);
+  g_cond_init (&data.cond);
+  data.called = FALSE;
+  data.status = ML_ERROR_NONE;
+
+  status = ml_single_open (&data.single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (data.single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &data.input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke_async (
+      data.single, data.input, test_cb_single_invoke_sync, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  end_time = g_get_monotonic_time () + SINGLE_DEF_TIMEOUT_MSEC * G_TIME_SPAN_MILLISECOND;
+  g_mutex_lock (&data.lock);
+  while (!data.called) {
+    if (!g_cond_wait_until (&data.cond, &data.lock, end_time))
+      break;
+  }
+  EXPECT_TRUE (data.called);
+  EXPECT_EQ (data.status, ML_ERROR_INVALID_PARAMETER);
+  g_mutex_unlock (&data.lock);
+
+  status = ml_single_close (data.single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (data.input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_cond_clear (&data.cond);
+  g_mutex_clear (&data.lock);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Set and get the properties of the request queue.
+ */
+TEST (nnstreamer_capi_singleshot, property_queue_p)
+{
+  ml_single_h single;
+  int status;
+  char *prop_value;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_property (single, "queue-size", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "16");
+  g_free (prop_value);
+
+  status = ml_single_get_property (single, "queue-policy", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "block");
+  g_free (prop_value);
+
+  status = ml_single_set_property (single, "queue-size", "4");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "queue-size", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "4");
+  g_free (prop_value);
+
+  status = ml_single_set_property (single, "queue-policy", "drop-oldest");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "queue-policy", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "drop-oldest");
+  g_free (prop_value);
+
+  status = ml_single_get_property (single, "queue-depth", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "0");
+  g_free (prop_value);
+
+  status = ml_single_get_property (single, "queue-wait-time", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "0");
+  g_free (prop_value);
+
+  status = ml_single_get_property (single, "queue-dropped", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "0");
+  g_free (prop_value);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case to set the properties of the request queue with invalid value.
+ */
+TEST (nnstreamer_capi_singleshot, property_queue_n)
+{
+  ml_single_h single;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_set_property (single, "queue-size", "0");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_set_property (single, "queue-size", "invalid");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_set_property (single, "queue-policy", "invalid");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* read-only */
+  status = ml_single_set_property (single, "queue-depth", "1");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_set_property (single, "queue-dropped", "1");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Drop the oldest request when the request queue is full.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_queue_drop_oldest_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  float tmp_input[] = { 1.0 };
+  async_invoke_result_s result;
+  gint64 end_time;
+  guint i;
+  char *prop_value;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_mutex_init (&result.lock);
+  g_cond_init (&result.cond);
+  result.received = result.failed = 0;
+  result.value = 0.0f;
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_set_property (single, "queue-size", "1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_set_property (single, "queue-policy", "drop-oldest");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the requests are never rejected with drop-oldest */
+  for (i = 0; i < 10; i++) {
+    status = ml_single_invoke_async (
+        single, input, test_cb_single_invoke_async, &result);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* wait for the results */
+  end_time = g_get_monotonic_time () + SINGLE_DEF_TIMEOUT_MSEC * G_TIME_SPAN_MILLISECOND;
+  g_mutex_lock (&result.lock);
+  while (result.received < 10) {
+    if (!g_cond_wait_until (&result.cond, &result.lock, end_time))
+      break;
+  }
+  EXPECT_EQ (result.received, 10U);
+  EXPECT_LT (result.failed, 10U);
+  g_mutex_unlock (&result.lock);
+
+  /* the dropped requests are completed with an error */
+  status = ml_single_get_property (single, "queue-dropped", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (g_ascii_strtoull (prop_value, NULL, 10), (guint64) result.failed);
+  g_free (prop_value);
+
+  status = ml_single_get_property (single, "queue-depth", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "0");
+  g_free (prop_value);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_cond_clear (&result.cond);
+  g_mutex_clear (&result.lock);
+  g_free (test_model);
+}
+
+/**
+ * @brief Data for the thread to invoke the model with the pool.
+ */
+typedef struct {
+  ml_single_pool_h pool; /**< the pool handle */
+  ml_tensors_data_h input; /**< input data shared by the threads */
+  guint num_runs; /**< the number of invocations */
+  guint succeeded; /**< the number of the invocations with correct output */
+} pool_invoke_data_s;
+
+/**
+ * @brief Thread to invoke the model with the pool.
+ */
+static void *
+pool_invoke_thread (void *arg)
+{
+  pool_invoke_data_s *data = (pool_invoke_data_s *) arg;
+  ml_tensors_data_h output;
+  float *output_buf;
+  size_t data_size;
+  guint i;
+  int status;
+
+  for (i = 0; i < data->num_runs; i++) {
+    status = ml_single_pool_invoke (data->pool, data->input, &output);
+    if (status != ML_ERROR_NONE)
+      continue;
+
+    status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+    if (status == ML_ERROR_NONE && output_buf[0] == 3.0f)
+      data->succeeded++;
+
+    ml_tensors_data_destroy (output);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Invoke the model with the pool from multiple threads.
+ */
+TEST (nnstreamer_capi_singleshot, pool_invoke_p)
+{
+  ml_single_pool_h pool;
+  ml_option_h option;
+  ml_nnfw_type_e nnfw_type;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  float tmp_input[] = { 1.0 };
+  pool_invoke_data_s data[4];
+  GThread *threads[4];
+  guint i;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "models", test_model, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  nnfw_type = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  status = ml_option_set (option, "nnfw", &nnfw_type, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_pool_open (&pool, option, 2);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_pool_get_input_info (pool, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* more threads than instances */
+  for (i = 0; i < 4; i++) {
+    data[i].pool = pool;
+    data[i].input = input;
+    data[i].num_runs = 10;
+    data[i].succeeded = 0;
+    threads[i] = g_thread_new ("pool_invoke", pool_invoke_thread, &data[i]);
+  }
+
+  for (i = 0; i < 4; i++) {
+    g_thread_join (threads[i]);
+    EXPECT_EQ (data[i].succeeded, 10U);
+  }
+
+  status = ml_single_pool_close (pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  ml_option_destroy (option);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot
+ * @detail Failure case with invalid parameters for the pool.
+ */
+TEST (nnstreamer_capi_singleshot, pool_invalid_param_n)
+{
+  ml_single_pool_h pool;
+  ml_option_h option;
+  ml_tensors_data_h output;
+  ml_tensors_info_h info;
+  int status;
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_pool_open (NULL, option, 2);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_pool_open (&pool, NULL, 2);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* too many instances */
+  status = ml_single_pool_open (&pool, option, 65);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_pool_get_input_info (NULL, &info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_pool_get_output_info (NULL, &info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_pool_invoke (NULL, NULL, &output);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_pool_close (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_destroy (option);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Invoke the model with the requests gathered for a batch.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_batch_option_p)
+{
+  ml_single_h single;
+  ml_option_h option;
+  ml_nnfw_type_e nnfw_type;
+  unsigned int max_batch, max_wait_us;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+  async_invoke_result_s result;
+  gint64 end_time;
+  guint i;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_mutex_init (&result.lock);
+  g_cond_init (&result.cond);
+  result.received = result.failed = 0;
+  result.value = 0.0f;
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "models", test_model, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  nnfw_type = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  status = ml_option_set (option, "nnfw", &nnfw_type, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  max_batch = 4;
+  status = ml_option_set (option, "max-batch", &max_batch, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  max_wait_us = 10000;
+  status = ml_option_set (option, "max-wait-us", &max_wait_us, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_open_with_option (&single, option);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  /* the input information of the handle is not changed */
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 8; i++) {
+    status = ml_single_invoke_async (
+        single, input, test_cb_single_invoke_async, &result);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* wait for the results */
+  end_time = g_get_monotonic_time () + SINGLE_DEF_TIMEOUT_MSEC * G_TIME_SPAN_MILLISECOND;
+  g_mutex_lock (&result.lock);
+  while (result.received < 8) {
+    if (!g_cond_wait_until (&result.cond, &result.lock, end_time))
+      break;
+  }
+  EXPECT_EQ (result.received, 8U);
+  EXPECT_EQ (result.failed, 0U);
+  EXPECT_FLOAT_EQ (result.value, 3.0f);
+  g_mutex_unlock (&result.lock);
+
+  /* a single request after the batch */
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, sizeof (float));
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  ml_option_destroy (option);
+  g_cond_clear (&result.cond);
+  g_mutex_clear (&result.lock);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Reuse the output buffers.
+ */
+TEST (nnstreamer_capi_singleshot, output_pool_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output1, output2;
+  float tmp_input[] = { 1.0 };
+  float *data_ptr;
+  size_t data_size;
+  gchar *value;
+  guint i;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_property (single, "output-pool-size", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "4");
+  g_free (value);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (tmp_input));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the buffer of the destroyed output is reused */
+  for (i = 0; i < 3; i++) {
+    status = ml_single_invoke (single, input, &output1);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_get_tensor_data (output1, 0, (void **) &data_ptr, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_FLOAT_EQ (data_ptr[0], 3.0);
+
+    ml_tensors_data_destroy (output1);
+  }
+
+  status = ml_single_get_property (single, "output-pool-available", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  status = ml_single_invoke (single, input, &output1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_invoke (single, input, &output2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "output-pool-high-water", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  g_free (value);
+
+  ml_tensors_data_destroy (output1);
+  ml_tensors_data_destroy (output2);
+
+  status = ml_single_get_property (single, "output-pool-available", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  g_free (value);
+
+  /* disable reusing, the buffers kept are freed */
+  status = ml_single_set_property (single, "output-pool-size", "0");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "output-pool-available", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  status = ml_single_invoke (single, input, &output1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output1, 0, (void **) &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (data_ptr[0], 3.0);
+
+  /* the output is still valid after closing the handle */
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (output1);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case with invalid property of the output pool.
+ */
+TEST (nnstreamer_capi_singleshot, output_pool_n)
+{
+  ml_single_h single;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_set_property (single, "output-pool-size", "-1");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_set_property (single, "output-pool-size", "invalid");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* read-only */
+  status = ml_single_set_property (single, "output-pool-available", "1");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_set_property (single, "output-pool-high-water", "1");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Share the loaded model among the handles.
+ */
+TEST (nnstreamer_capi_singleshot, shared_model_p)
+{
+  ml_single_h single1, single2;
+  ml_option_h option;
+  ml_nnfw_type_e nnfw_type;
+  unsigned int hits, misses, resident;
+  unsigned int hits_prev, misses_prev, resident_prev;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "models", test_model, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  nnfw_type = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  status = ml_option_set (option, "nnfw", &nnfw_type, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "shared-model", (void *) "true", NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_model_cache_stats (&hits_prev, &misses_prev, &resident_prev);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_open_with_option (&single1, option);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_open_with_option (&single2, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_model_cache_stats (&hits, &misses, &resident);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (hits, hits_prev + 1);
+  EXPECT_EQ (misses, misses_prev + 1);
+  EXPECT_EQ (resident, resident_prev + 1);
+
+  status = ml_single_get_input_info (single1, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* both handles invoke the shared model */
+  status = ml_single_invoke (single1, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_invoke (single2, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  /* cannot change the input information of the shared model */
+  status = ml_single_set_input_info (single1, in_info);
+  EXPECT_EQ (status, ML_ERROR_NOT_SUPPORTED);
+
+  status = ml_single_close (single2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_model_cache_stats (NULL, NULL, &resident);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (resident, resident_prev + 1);
+
+  /* the model changed by the sole handle is not shared with the handle opened later */
+  status = ml_single_set_input_info (single1, in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_open_with_option (&single2, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_model_cache_stats (&hits, &misses, &resident);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (hits, hits_prev + 1);
+  EXPECT_EQ (misses, misses_prev + 2);
+  EXPECT_EQ (resident, resident_prev + 1);
+
+  status = ml_single_close (single2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_close (single1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_model_cache_stats (NULL, NULL, &resident);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (resident, resident_prev);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  ml_option_destroy (option);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case to get the statistics of the model cache with invalid param.
+ */
+TEST (nnstreamer_capi_singleshot, shared_model_stats_n)
+{
+  int status;
+
+  status = ml_single_get_model_cache_stats (NULL, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Open the model in the memory.
+ */
+TEST (nnstreamer_capi_singleshot, open_from_buffer_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+  gchar *contents = NULL;
+  gsize length = 0;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  ASSERT_TRUE (g_file_get_contents (test_model, &contents, &length, NULL));
+
+  status = ml_single_open_from_buffer (&single, contents, length, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
+  /* the model is loaded from the memory, the buffer can be freed */
+  g_free (contents);
+
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Open the model in the file descriptor.
+ */
+TEST (nnstreamer_capi_singleshot, open_from_fd_p)
+{
+  ml_single_h single;
+  int status, fd;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  fd = open (test_model, O_RDONLY);
+  ASSERT_GE (fd, 0);
+
+  status = ml_single_open_from_fd (&single, fd, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
+  /* the handle keeps its own descriptor */
+  close (fd);
+
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot
+ * @detail Failure case to open the model in the memory with invalid param.
+ */
+TEST (nnstreamer_capi_singleshot, open_from_buffer_n)
+{
+  ml_single_h single;
+  int status;
+  char model[] = "invalid";
+
+  status = ml_single_open_from_buffer (NULL, model, sizeof (model), NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open_from_buffer (&single, NULL, sizeof (model), NULL,
+      NULL, ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open_from_buffer (&single, model, 0, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* cannot detect the framework */
+  status = ml_single_open_from_buffer (&single, model, sizeof (model), NULL,
+      NULL, ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open_from_fd (&single, -1, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Callback for ml_single_open_async().
+ */
+static void
+test_cb_single_open_async (ml_single_h single, int status, void *user_data)
+{
+  async_invoke_result_s *result = (async_invoke_result_s *) user_data;
+
+  EXPECT_TRUE (single != NULL);
+
+  g_mutex_lock (&result->lock);
+  if (status != ML_ERROR_NONE)
+    result->failed++;
+  result->received++;
+  g_cond_signal (&result->cond);
+  g_mutex_unlock (&result->lock);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Load the model in the background.
+ */
+TEST (nnstreamer_capi_singleshot, open_async_p)
+{
+  ml_single_h single, single2;
+  ml_option_h option;
+  ml_nnfw_type_e nnfw_type;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+  async_invoke_result_s result;
+  gint64 end_time;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_mutex_init (&result.lock);
+  g_cond_init (&result.cond);
+  result.received = result.failed = 0;
+  result.value = 0.0f;
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "models", test_model, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  nnfw_type = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  status = ml_option_set (option, "nnfw", &nnfw_type, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_open_async (&single, option, test_cb_single_open_async, &result);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  /* wait for the model to be loaded */
+  end_time = g_get_monotonic_time () + SINGLE_DEF_TIMEOUT_MSEC * G_TIME_SPAN_MILLISECOND;
+  g_mutex_lock (&result.lock);
+  while (result.received < 1) {
+    if (!g_cond_wait_until (&result.cond, &result.lock, end_time))
+      break;
+  }
+  EXPECT_EQ (result.received, 1U);
+  EXPECT_EQ (result.failed, 0U);
+  g_mutex_unlock (&result.lock);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* close while loading, the callback is called before close returns */
+  status = ml_single_open_async (&single2, option, test_cb_single_open_async, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_close (single2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_mutex_lock (&result.lock);
+  EXPECT_EQ (result.received, 2U);
+  g_mutex_unlock (&result.lock);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  ml_option_destroy (option);
+  g_cond_clear (&result.cond);
+  g_mutex_clear (&result.lock);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot
+ * @detail Failure case to load the model in the background with invalid param.
+ */
+TEST (nnstreamer_capi_singleshot, open_async_invalid_param_n)
+{
+  ml_single_h single;
+  ml_option_h option;
+  int status;
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_open_async (NULL, option, test_cb_single_open_async, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open_async (&single, NULL, test_cb_single_open_async, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open_async (&single, option, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* no model is given */
+  status = ml_single_open_async (&single, option, test_cb_single_open_async, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_destroy (option);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Warm up the model and get the latency statistics.
+ */
+TEST (nnstreamer_capi_singleshot, warmup_latency_stats_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  gchar *value;
+  guint64 count, p50, p90, p99, max;
+  guint i;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_warmup (single, 3);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the latency of the warm-up is not counted */
+  status = ml_single_get_property (single, "latency-stats", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (g_str_has_prefix (value, "count=0,"));
+  g_free (value);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (tmp_input));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 10; i++) {
+    status = ml_single_invoke (single, input, &output);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_destroy (output);
+  }
+
+  status = ml_single_get_property (single, "latency-stats", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (sscanf (value,
+                 "count=%" G_GUINT64_FORMAT ",p50=%" G_GUINT64_FORMAT
+                 ",p90=%" G_GUINT64_FORMAT ",p99=%" G_GUINT64_FORMAT
+                 ",max=%" G_GUINT64_FORMAT,
+                 &count, &p50, &p90, &p99, &max),
+      5);
+  EXPECT_EQ (count, 10U);
+  EXPECT_LE (p50, p90);
+  EXPECT_LE (p90, p99);
+  EXPECT_LE (p99, max);
+  g_free (value);
+
+  /* warming up again keeps the latency of the application */
+  status = ml_single_warmup (single, 3);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_get_property (single, "latency-stats", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (g_str_has_prefix (value, "count=10,"));
+  g_free (value);
+
+  /* read-only */
+  status = ml_single_set_property (single, "latency-stats", "count=0");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot
+ * @detail Failure case to warm up the model with invalid param.
+ */
+TEST (nnstreamer_capi_singleshot, warmup_n)
+{
+  ml_single_h single;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_warmup (NULL, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_warmup (single, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tflite)
+ * @detail Repeat and alternate the input shapes with `ml_single_invoke_dynamic`.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_dynamic_repeat_shape_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info[2], out_info;
+  ml_tensors_data_h input[2], output;
+  ml_tensor_dimension in_dim = { 5, 1, 1, 1 };
+  float tmp_input[] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+  float *output_buf;
+  size_t data_size;
+  /* the same shape is not configured again */
+  const guint order[] = { 0, 0, 1, 1, 0, 1 };
+  guint i, n;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /* dynamic dimension supported */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  /* 1:1:1:1 (configured when opened) and 5:1:1:1 */
+  status = ml_single_get_input_info (single, &in_info[0]);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_create (&in_info[1]);
+  ml_tensors_info_set_count (in_info[1], 1);
+  ml_tensors_info_set_tensor_type (in_info[1], 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (in_info[1], 0, in_dim);
+
+  for (i = 0; i < 2; i++) {
+    status = ml_tensors_data_create (in_info[i], &input[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_data_set_tensor_data (
+        input[i], 0, tmp_input, (i == 0 ? 1 : 5) * sizeof (float));
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (order); i++) {
+    n = order[i];
+
+    status = ml_single_invoke_dynamic (single, input[n], in_info[n], &output, &out_info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (data_size, (n == 0 ? 1 : 5) * sizeof (float));
+    EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+    if (n == 1)
+      EXPECT_FLOAT_EQ (output_buf[4], 7.0f);
+
+    ml_tensors_data_destroy (output);
+    ml_tensors_info_destroy (out_info);
+  }
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 2; i++) {
+    ml_tensors_data_destroy (input[i]);
+    ml_tensors_info_destroy (in_info[i]);
+  }
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tflite)
+ * @detail Invoke the array of the inputs with `ml_single_invoke_batch`, with and without timeout.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_batch_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h inputs[8], outputs[8];
+  float value;
+  float *output_buf;
+  size_t data_size;
+  guint i, n;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 8; i++) {
+    value = (float) i;
+
+    status = ml_tensors_data_create (in_info, &inputs[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_data_set_tensor_data (inputs[i], 0, &value, sizeof (float));
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* invoked in the caller's thread, and then by the invoke thread with timeout */
+  for (n = 0; n < 2; n++) {
+    if (n == 1) {
+      status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+    }
+
+    status = ml_single_invoke_batch (single, inputs, outputs, 8);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    for (i = 0; i < 8; i++) {
+      status = ml_tensors_data_get_tensor_data (outputs[i], 0, (void **) &output_buf, &data_size);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_EQ (data_size, sizeof (float));
+      EXPECT_FLOAT_EQ (output_buf[0], (float) i + 2.0f);
+
+      ml_tensors_data_destroy (outputs[i]);
+    }
+  }
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 8; i++)
+    ml_tensors_data_destroy (inputs[i]);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tflite)
+ * @detail Failure case of `ml_single_invoke_batch` with invalid parameters and input.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_batch_n)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h inputs[2], outputs[2];
+  ml_tensor_dimension in_dim = { 2, 1, 1, 1 };
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_invoke_batch (NULL, inputs, outputs, 2);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &inputs[0]);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the second input has invalid size */
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_tensors_data_create (in_info, &inputs[1]);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke_batch (single, NULL, outputs, 2);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_invoke_batch (single, inputs, NULL, 2);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_invoke_batch (single, inputs, outputs, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* nothing is invoked if an input is invalid */
+  status = ml_single_invoke_batch (single, inputs, outputs, 2);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_TRUE (outputs[0] == NULL);
+  EXPECT_TRUE (outputs[1] == NULL);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (inputs[0]);
+  ml_tensors_data_destroy (inputs[1]);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tflite)
+ * @detail Invoke with the spinning hand-off to the invoke thread.
+ */
+TEST (nnstreamer_capi_singleshot, handoff_spin_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+  gchar *value;
+  guint i;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_property (single, "handoff-spin-us", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  /* the requests are passed to the invoke thread with timeout */
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_set_property (single, "handoff-spin-us", "500");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (tmp_input));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 10; i++) {
+    status = ml_single_invoke (single, input, &output);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+    ml_tensors_data_destroy (output);
+  }
+
+  /* invalid value */
+  status = ml_single_set_property (single, "handoff-spin-us", "-1");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_single_set_property (single, "handoff-spin-us", "1000001");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* close while the invoke thread is spinning */
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Cancel the asynchronous requests.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_async_cancel_p)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  float tmp_input[] = { 1.0 };
+  async_invoke_result_s result;
+  unsigned int ids[32];
+  guint i, cancelled;
+  gint64 end_time;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_mutex_init (&result.lock);
+  g_cond_init (&result.cond);
+  result.received = result.failed = 0;
+  result.value = 0.0f;
+  cancelled = 0;
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_set_property (single, "queue-size", "32");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (float));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 32; i++) {
+    status = ml_single_invoke_async_full (single, input,
+        test_cb_single_invoke_async, &result, 0, &ids[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_NE (ids[i], 0U);
+  }
+
+  /* the request already completed cannot be cancelled */
+  for (i = 0; i < 32; i++) {
+    status = ml_single_cancel (single, ids[i]);
+    if (status == ML_ERROR_NONE)
+      cancelled++;
+    else
+      EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  }
+
+  /* the callback of the cancelled request gets an error */
+  end_time = g_get_monotonic_time () + SINGLE_DEF_TIMEOUT_MSEC * G_TIME_SPAN_MILLISECOND;
+  g_mutex_lock (&result.lock);
+  while (result.received < 32) {
+    if (!g_cond_wait_until (&result.cond, &result.lock, end_time))
+      break;
+  }
+  EXPECT_EQ (result.received, 32U);
+  EXPECT_EQ (result.failed, cancelled);
+  g_mutex_unlock (&result.lock);
+
+  /* cancelled twice */
+  status = ml_single_cancel (single, ids[31]);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_cond_clear (&result.cond);
+  g_mutex_clear (&result.lock);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case of `ml_single_cancel` with invalid parameters.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_async_cancel_n)
+{
+  ml_single_h single;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_cancel (NULL, 1U);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_cancel (single, 0U);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* unknown request */
+  status = ml_single_cancel (single, 12345U);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Open the model with the scheduling of the invoke thread.
+ */
+TEST (nnstreamer_capi_singleshot, thread_sched_option_p)
+{
+  ml_single_h single;
+  ml_option_h option;
+  ml_nnfw_type_e nnfw_type;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "models", test_model, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  nnfw_type = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  status = ml_option_set (option, "nnfw", &nnfw_type, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* available without the privilege */
+  status = ml_option_set (option, "cpu-affinity", (void *) "0", NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "sched-policy", (void *) "batch", NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "nice", (void *) "5", NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_open_with_option (&single, option);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  /* the requests are passed to the invoke thread with timeout */
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (tmp_input));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  ml_option_destroy (option);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case with invalid scheduling of the invoke thread.
+ */
+TEST (nnstreamer_capi_singleshot, thread_sched_option_n)
+{
+  ml_single_h single;
+  ml_option_h option;
+  ml_nnfw_type_e nnfw_type;
+  int status;
+  guint i;
+  const gchar *invalid[][2] = {
+    { "cpu-affinity", "abc" },
+    { "cpu-affinity", "3-1" },
+    { "sched-policy", "unknown" },
+    { "sched-priority", "10" }, /* without sched-policy */
+    { "nice", "100" },
+  };
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  if (!is_enabled_tensorflow_lite)
+    goto skip_test;
+
+  for (i = 0; i < G_N_ELEMENTS (invalid); i++) {
+    status = ml_option_create (&option);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_option_set (option, "models", test_model, NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    nnfw_type = ML_NNFW_TYPE_TENSORFLOW_LITE;
+    status = ml_option_set (option, "nnfw", &nnfw_type, NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_option_set (option, invalid[i][0], (void *) invalid[i][1], NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_single_open_with_option (&single, option);
+    EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+    ml_option_destroy (option);
+  }
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Invoke the series of two models, each of which adds 2 to the input.
+ */
+TEST (nnstreamer_capi_singleshot, series_invoke_p)
+{
+  ml_single_series_h series;
+  ml_option_h options[2];
+  ml_nnfw_type_e nnfw_type;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+  async_invoke_result_s result;
+  gint64 end_time;
+  guint i;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_mutex_init (&result.lock);
+  g_cond_init (&result.cond);
+  result.received = result.failed = 0;
+  result.value = 0.0f;
+
+  nnfw_type = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  for (i = 0; i < 2; i++) {
+    status = ml_option_create (&options[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_option_set (options[i], "models", test_model, NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_option_set (options[i], "nnfw", &nnfw_type, NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  status = ml_single_series_open (&series, options, 2);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_series_get_input_info (series, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (tmp_input));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_series_invoke (series, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, sizeof (float));
+  EXPECT_FLOAT_EQ (output_buf[0], 5.0f);
+  ml_tensors_data_destroy (output);
+
+  /* the requests pass through the models at the same time */
+  for (i = 0; i < 5; i++) {
+    status = ml_single_series_invoke_async (
+        series, input, test_cb_single_invoke_async, &result);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  end_time = g_get_monotonic_time () + SINGLE_DEF_TIMEOUT_MSEC * G_TIME_SPAN_MILLISECOND;
+  g_mutex_lock (&result.lock);
+  while (result.received < 5) {
+    if (!g_cond_wait_until (&result.cond, &result.lock, end_time))
+      break;
+  }
+  EXPECT_EQ (result.received, 5U);
+  EXPECT_EQ (result.failed, 0U);
+  EXPECT_FLOAT_EQ (result.value, 5.0f);
+  g_mutex_unlock (&result.lock);
+
+  status = ml_single_series_close (series);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  for (i = 0; i < 2; i++)
+    ml_option_destroy (options[i]);
+  g_cond_clear (&result.cond);
+  g_mutex_clear (&result.lock);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case of the series with invalid parameters.
+ */
+TEST (nnstreamer_capi_singleshot, series_invoke_n)
+{
+  ml_single_series_h series;
+  ml_option_h option;
+  ml_tensors_data_h output;
+  int status;
+
+  status = ml_single_series_open (NULL, &option, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_series_open (&series, NULL, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_series_open (&series, &option, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_series_invoke (NULL, NULL, &output);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_series_invoke_async (NULL, NULL, test_cb_single_invoke_async, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_series_close (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_destroy (option);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Invoke the ensemble of two models with the same input, each of which adds 2 to the input.
+ */
+TEST (nnstreamer_capi_singleshot, ensemble_invoke_p)
+{
+  ml_single_ensemble_h ensemble;
+  ml_option_h options[2];
+  ml_nnfw_type_e nnfw_type;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  ml_tensors_data_h outputs[2];
+  float tmp_input[] = { 1.0 };
+  float *output_buf;
+  size_t data_size;
+  guint i;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  nnfw_type = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  for (i = 0; i < 2; i++) {
+    status = ml_option_create (&options[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_option_set (options[i], "models", test_model, NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_option_set (options[i], "nnfw", &nnfw_type, NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  status = ml_single_ensemble_open (&ensemble, options, 2);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_ensemble_get_input_info (ensemble, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, sizeof (tmp_input));
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_ensemble_invoke (ensemble, input, outputs);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 2; i++) {
+    status = ml_tensors_data_get_tensor_data (outputs[i], 0, (void **) &output_buf, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (data_size, sizeof (float));
+    EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+    ml_tensors_data_destroy (outputs[i]);
+  }
+
+  status = ml_single_ensemble_invoke_reduce (
+      ensemble, input, ML_SINGLE_ENSEMBLE_REDUCE_AVERAGE, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+  ml_tensors_data_destroy (output);
+
+  /* both models vote for the only element */
+  status = ml_single_ensemble_invoke_reduce (
+      ensemble, input, ML_SINGLE_ENSEMBLE_REDUCE_VOTE, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &output_buf, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (output_buf[0], 2.0f);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_ensemble_close (ensemble);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  for (i = 0; i < 2; i++)
+    ml_option_destroy (options[i]);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case of the ensemble with invalid parameters.
+ */
+TEST (nnstreamer_capi_singleshot, ensemble_invoke_n)
+{
+  ml_single_ensemble_h ensemble;
+  ml_option_h option;
+  ml_tensors_data_h output;
+  ml_tensors_info_h info;
+  int status;
+
+  status = ml_single_ensemble_open (NULL, &option, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_ensemble_open (&ensemble, NULL, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_ensemble_open (&ensemble, &option, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_ensemble_invoke (NULL, NULL, &output);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_ensemble_invoke_reduce (
+      NULL, NULL, ML_SINGLE_ENSEMBLE_REDUCE_AVERAGE, &output);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_ensemble_get_output_info (NULL, 0, &info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_ensemble_close (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_destroy (option);
+}
+
 /**
  * @brief Test ml_option
  */